@@ -100,6 +100,16 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_MHA_MIN_KEY_LENGTH) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MHA_MIN_KEY_LENGTH
+                           << ". Expected only non-negative integer numbers";
+            mhaMinKeyLength = val_i;
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_avx512_core()) {
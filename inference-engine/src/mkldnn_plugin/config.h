@@ -28,6 +28,10 @@ struct Config {
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
+    // the number of streams the THROUGHPUT hint resolves to for the loaded network, 0 if it wasn't estimated
+    int throughputHintStreams = 0;
+    // the static key length from which the attention subgraphs are fused
+    int mhaMinKeyLength = 128;
 #if defined(__arm__) || defined(__aarch64__)
     // Currently INT8 mode is not optimized on ARM, fallback to FP32 mode.
     LPTransformsMode lpTransformsMode = LPTransformsMode::Off;
@@ -182,6 +182,13 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "NonMaxSuppressionIEInternal", NonMaxSuppression},
         { "MatrixNms", MatrixNms},
         { "MulticlassNms", MulticlassNms},
+        { "FusedPreprocess", Preprocess},
+        { "NV12toRGB", ColorConvert},
+        { "NV12toBGR", ColorConvert},
+        { "I420toRGB", ColorConvert},
+        { "I420toBGR", ColorConvert},
+        { "FusedColorConvert", ColorConvert},
+        { "MultiHeadAttention", MultiHeadAttention},
         { "Reference", Reference},
 };
 
@@ -362,6 +369,12 @@ std::string NameFromType(const Type type) {
             return "MatrixNms";
         case MulticlassNms:
             return "MulticlassNms";
+        case Preprocess:
+            return "Preprocess";
+        case ColorConvert:
+            return "ColorConvert";
+        case MultiHeadAttention:
+            return "MultiHeadAttention";
         case Reference:
             return "Reference";
         default:
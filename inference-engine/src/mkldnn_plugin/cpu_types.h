@@ -99,7 +99,10 @@ enum Type {
     ExtractImagePatches,
     NonMaxSuppression,
     MatrixNms,
-    MulticlassNms
+    MulticlassNms,
+    Preprocess,
+    ColorConvert,
+    MultiHeadAttention
 };
 
 enum Algorithm {
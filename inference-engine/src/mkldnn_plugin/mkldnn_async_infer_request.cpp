@@ -4,14 +4,60 @@
 
 #include "mkldnn_async_infer_request.h"
 #include <memory>
+#include <threading/ie_immediate_executor.hpp>
+
+namespace {
+// runs the synchronous inference in the calling thread as a part of the streams executor
+struct ImmediateStreamsExecutor : public InferenceEngine::ITaskExecutor {
+    explicit ImmediateStreamsExecutor(const InferenceEngine::IStreamsExecutor::Ptr& streamsExecutor)
+        : _streamsExecutor{streamsExecutor} {}
+    void run(InferenceEngine::Task task) override {
+        _streamsExecutor->Execute(std::move(task));
+    }
+    InferenceEngine::IStreamsExecutor::Ptr _streamsExecutor;
+};
+}  // namespace
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _inferRequest(static_cast<MKLDNNInferRequest*>(inferRequest.get())) {
+    _inferRequest->SetAsyncRequest(this);
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
     StopAndWait();
 }
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::StartAsync_ThreadUnsafe() {
+    UpdateStreams();
+    AsyncInferRequestThreadSafeDefault::StartAsync_ThreadUnsafe();
+}
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
+    UpdateStreams();
+    AsyncInferRequestThreadSafeDefault::Infer_ThreadUnsafe();
+}
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::UpdateStreams() {
+    const auto streams = _inferRequest->UpdateStreams();
+    if (streams->taskExecutor == _requestExecutor)
+        return;
+
+    _requestExecutor = streams->taskExecutor;
+    _callbackExecutor = streams->callbackExecutor;
+    _pipeline = {{_requestExecutor, [this] {
+        _inferRequest->InferImpl();
+    }}};
+    auto streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(_requestExecutor);
+    if (streamsExecutor != nullptr) {
+        _syncPipeline = {{std::make_shared<ImmediateStreamsExecutor>(streamsExecutor), [this] {
+            _inferRequest->InferImpl();
+        }}};
+    } else {
+        _syncPipeline = {{std::make_shared<InferenceEngine::ImmediateExecutor>(), [this] {
+            _inferRequest->InferImpl();
+        }}};
+    }
+}
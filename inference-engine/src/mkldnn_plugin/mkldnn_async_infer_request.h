@@ -17,6 +17,16 @@ public:
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~MKLDNNAsyncInferRequest();
+
+protected:
+    void StartAsync_ThreadUnsafe() override;
+    void Infer_ThreadUnsafe() override;
+
+private:
+    // rebuilds the pipelines if the request has moved to other streams, the request is idle when it is called
+    void UpdateStreams();
+
+    MKLDNNInferRequest* _inferRequest = nullptr;
 };
 
 }  // namespace MKLDNNPlugin
@@ -8,10 +8,10 @@
 
 #include "mkldnn_async_infer_request.h"
 #include "mkldnn_infer_request.h"
-#include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_plugin.h"
 #include "mkldnn_serialize.h"
-#include "nodes/mkldnn_memory_node.hpp"
+#include "utils/general_utils.h"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -68,7 +68,6 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
     }
-    bool isFloatModel = !ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
 
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
@@ -77,85 +76,105 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    _streams = CreateStreams(_cfg);
+    _taskExecutor = _streams->taskExecutor;
+    _callbackExecutor = _streams->callbackExecutor;
+}
+
+MKLDNNExecNetwork::Streams::Ptr MKLDNNExecNetwork::CreateStreams(const Config &cfg, const Streams::Ptr &current) const {
+    auto streams = std::make_shared<Streams>();
+    streams->config = cfg;
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
-        _taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
+        streams->taskExecutor = InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
-        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig, isFloatModel);
+        bool isFloatModel = !ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(_network.getFunction());
+        auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(cfg.streamExecutorConfig, isFloatModel);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
+        streams->threadsPerStream = streamsExecutorConfig._threadsPerStream;
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
-        _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
+        streams->taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        streams->taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
 #endif
     }
     if (0 != cfg.streamExecutorConfig._streams) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         // There is no additional threads but we still need serialize callback execution to preserve legacy behaviour
-        _callbackExecutor = std::make_shared<ImmediateSerialExecutor>();
+        streams->callbackExecutor = std::make_shared<ImmediateSerialExecutor>();
 #else
-        _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        streams->callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
                                 IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
 #endif
     } else {
-        _callbackExecutor = _taskExecutor;
+        streams->callbackExecutor = streams->taskExecutor;
     }
 
-    int streams = std::max(1, _cfg.streamExecutorConfig._streams);
-    std::vector<Task> tasks; tasks.resize(streams);
-    _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
+    int numStreams = std::max(1, cfg.streamExecutorConfig._streams);
+    streams->graphs.resize(numStreams);
+    // the oneDNN implementations may depend on the number of threads, so the descriptors are shared between the streams
+    // with the same threads only
+    if (current && current->threadsPerStream == streams->threadsPerStream)
+        streams->primitiveDescriptors = current->primitiveDescriptors;
+    if (cfg.streamExecutorConfig._streams != 0) {
+        if (!streams->primitiveDescriptors) {
+            // the template graph is created alone, the graphs of the other streams take its primitive descriptors
+            streams->taskExecutor->runAndWait({[&] {
+                GetGraph(streams);
+            }});
+            for (auto&& graph : streams->graphs) {
+                if (graph.IsReady()) {
+                    streams->primitiveDescriptors = graph.GetKeptPrimitiveDescriptors();
+                    break;
+                }
+            }
+        }
+        std::vector<Task> tasks; tasks.resize(numStreams);
         for (auto&& task : tasks) {
-            task = [this] {
-                MKLDNNExecNetwork::GetGraph();
+            task = [&] {
+                GetGraph(streams);
             };
         }
-        _taskExecutor->runAndWait(tasks);
+        streams->taskExecutor->runAndWait(tasks);
     } else {
-        MKLDNNExecNetwork::GetGraph();
+        GetGraph(streams);
     }
-
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
-    if (_graphs.size() == 1) {
-        for (auto &node : GetGraph()._graph.GetNodes()) {
-            if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                if (!memoryNode) {
-                    IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-                }
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
-            }
+    // the graph which answers the queries that don't depend on the stream
+    for (auto&& graph : streams->graphs) {
+        if (graph.IsReady()) {
+            streams->templateGraph = &graph;
+            break;
         }
     }
+    return streams;
+}
+
+MKLDNNExecNetwork::Streams::Ptr MKLDNNExecNetwork::GetStreams() const {
+    std::lock_guard<std::mutex> lock{_streamsMutex};
+    return _streams;
 }
 
-MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph(const Streams::Ptr &streams) const {
     int streamId = 0;
     int numaNodeId = 0;
-    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(streams->taskExecutor.get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
     }
-    auto graphLock = Graph::Lock(_graphs[streamId % _graphs.size()]);
+    auto graphLock = Graph::Lock(streams->graphs[streamId % streams->graphs.size()], streams);
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
-                    graphLock._graph.setConfig(_cfg);
+                    graphLock._graph.setConfig(streams->config);
                 }
+                if (streams->primitiveDescriptors)
+                    graphLock._graph.SetSharedPrimitiveDescriptors(streams->primitiveDescriptors);
+                else if (streams->graphs.size() > 1)
+                    graphLock._graph.KeepPrimitiveDescriptors();
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -173,33 +192,110 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
     return graphLock;
 }
 
+MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetTemplateGraph() const {
+    auto streams = GetStreams();
+    if (streams->templateGraph == nullptr)
+        return GetGraph(streams);
+    auto& graph = *streams->templateGraph;
+    return Graph::Lock(graph, std::move(streams));
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
+    auto streams = GetStreams();
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
         _cfg.readProperties(properties);
+        streams->config.readProperties(properties);
     }
-    for (auto& g : _graphs) {
-        auto graphLock = Graph::Lock(g);
+    for (auto& g : streams->graphs) {
+        auto graphLock = Graph::Lock(g, streams);
         if (graphLock._graph.IsReady()) {
             graphLock._graph.setProperty(properties);
         }
     }
 }
 
+void MKLDNNExecNetwork::SetConfig(const std::map<std::string, Parameter> &config) {
+    std::map<std::string, std::string> properties;
+    for (const auto& kvp : config) {
+        if (!one_of(kvp.first, PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, PluginConfigParams::KEY_CPU_THREADS_NUM,
+                    PluginConfigParams::KEY_PERFORMANCE_HINT, PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS)) {
+            IE_THROW(NotImplemented) << "Unsupported ExecutableNetwork config key: " << kvp.first;
+        }
+        properties[kvp.first] = kvp.second.as<std::string>();
+    }
+
+    // the calls are serialized, but the new streams are created without blocking the creation of infer requests
+    std::lock_guard<std::mutex> setConfigLock{_setConfigMutex};
+    Config cfg;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        cfg = _cfg;
+    }
+    if (cfg.exclusiveAsyncRequests)
+        IE_THROW() << "The streams of ExecutableNetwork can't be changed when the exclusive async requests are enabled";
+    cfg.readProperties(properties);
+
+    // the hint is turned into the streams the same way as on load, unless the streams are set explicitly
+    const auto hint = properties.find(PluginConfigParams::KEY_PERFORMANCE_HINT);
+    if (hint != properties.end() && properties.count(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) == 0) {
+        std::string streams = CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
+        if (cfg.perfHintsConfig.ovPerfHint == CONFIG_VALUE(LATENCY)) {
+            streams = CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
+        } else if (cfg.perfHintsConfig.ovPerfHint == CONFIG_VALUE(THROUGHPUT)) {
+            if (cfg.throughputHintStreams == 0) {
+                // estimated on the first switch to THROUGHPUT only (if the network was not loaded with it),
+                // from the network converted to the CPU opset
+                cfg.throughputHintStreams = Engine::GetNumStreamsForThroughput(_network.getFunction());
+                std::lock_guard<std::mutex> lock{_cfgMutex};
+                _cfg.throughputHintStreams = cfg.throughputHintStreams;
+            }
+            int numStreams = cfg.throughputHintStreams;
+            if (cfg.perfHintsConfig.ovPerfHintNumRequests)
+                numStreams = std::min(numStreams, cfg.perfHintsConfig.ovPerfHintNumRequests);
+            streams = std::to_string(numStreams);
+        }
+        cfg.readProperties({{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, streams}});
+    }
+
+    const auto currentStreams = GetStreams();
+    const auto& current = currentStreams->config.streamExecutorConfig;
+    if (cfg.streamExecutorConfig._streams == current._streams && cfg.streamExecutorConfig._threads == current._threads) {
+        setProperty(properties);
+        return;
+    }
+
+    // the new streams are ready to run before any request moves to them
+    auto streams = CreateStreams(cfg, currentStreams);
+    std::lock_guard<std::mutex> reconfigLock{_reconfigMutex};
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        _cfg = cfg;
+    }
+    {
+        std::lock_guard<std::mutex> lock{_streamsMutex};
+        std::swap(_streams, streams);
+        _taskExecutor = _streams->taskExecutor;
+        _callbackExecutor = _streams->callbackExecutor;
+    }
+}
+
 InferenceEngine::IInferRequestInternal::Ptr MKLDNNExecNetwork::CreateInferRequest() {
+    // the executors are replaced by SetConfig
+    std::lock_guard<std::mutex> lock{_reconfigMutex};
     return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
 }
 
 std::shared_ptr<ngraph::Function> MKLDNNExecNetwork::GetExecGraphInfo() {
-    if (_graphs.size() == 0)
+    if (GetStreams()->graphs.size() == 0)
         IE_THROW() << "No graph was found";
 
-    return GetGraph()._graph.dump();
+    return GetTemplateGraph()._graph.dump();
 }
 
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
-    if (_graphs.size() == 0) IE_THROW() << "No graph was found";
-    Config engConfig = GetGraph()._graph.getProperty();
+    if (GetStreams()->graphs.size() == 0) IE_THROW() << "No graph was found";
+    Config engConfig = GetTemplateGraph()._graph.getProperty();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
         return option->second;
@@ -209,11 +305,11 @@ Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
 }
 
 InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name) const {
-    if (_graphs.size() == 0)
+    if (GetStreams()->graphs.size() == 0)
         IE_THROW() << "No graph was found";
 
     if (name == METRIC_KEY(NETWORK_NAME)) {
-        IE_SET_METRIC_RETURN(NETWORK_NAME, GetGraph()._graph.dump()->get_friendly_name());
+        IE_SET_METRIC_RETURN(NETWORK_NAME, GetTemplateGraph()._graph.dump()->get_friendly_name());
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         std::vector<std::string> metrics;
         metrics.push_back(METRIC_KEY(NETWORK_NAME));
@@ -223,12 +319,12 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
-        for (auto && key : GetGraph()._graph.getProperty()._config) {
+        for (auto && key : GetTemplateGraph()._graph.getProperty()._config) {
             configKeys.push_back(key.first);
         }
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
-        Config engConfig = GetGraph()._graph.getProperty();
+        Config engConfig = GetTemplateGraph()._graph.getProperty();
         auto option = engConfig._config.find(CONFIG_KEY(CPU_THROUGHPUT_STREAMS));
         IE_ASSERT(option != engConfig._config.end());
         auto streams = std::stoi(option->second);
@@ -38,6 +38,15 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    /**
+     * @brief Changes the streams and threads partitioning of the loaded network.
+     * Supports CPU_THROUGHPUT_STREAMS, CPU_THREADS_NUM, PERFORMANCE_HINT and PERFORMANCE_HINT_NUM_REQUESTS keys.
+     * The graphs of the new streams are created before they are used, from the primitive descriptors of the current
+     * streams if the threads per stream don't change. Infer requests can be created meanwhile. The idle infer requests
+     * move to the new streams on their next start and the running ones complete on the previous streams.
+     */
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -48,31 +57,65 @@ public:
 
 protected:
     friend class MKLDNNInferRequest;
+    friend class MKLDNNAsyncInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
-    std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
     mutable std::mutex                          _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    struct Streams;
     struct Graph : public MKLDNNGraph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
-            explicit Lock(Graph& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
+            Lock(Graph& graph, std::shared_ptr<Streams> streams)
+                : std::unique_lock<std::mutex>(graph._mutex), _graph(graph), _streams(std::move(streams)) {}
+            Lock(Lock&&) = default;
+            // the graph is unlocked before the streams owning it may be released
+            ~Lock() {
+                if (owns_lock())
+                    unlock();
+            }
             Graph&                          _graph;
+            std::shared_ptr<Streams>        _streams;
         };
     };
 
-    // WARNING: Do not use _graphs directly.
-    mutable std::deque<Graph>                   _graphs;
+    // The executors and the graphs of the streams. SetConfig replaces them as a whole, an infer request keeps
+    // the streams it was started on until it is idle.
+    struct Streams {
+        typedef std::shared_ptr<Streams> Ptr;
+        Config                                  config;
+        InferenceEngine::ITaskExecutor::Ptr     taskExecutor;
+        InferenceEngine::ITaskExecutor::Ptr     callbackExecutor;
+        // WARNING: Do not use graphs directly.
+        std::deque<Graph>                       graphs;
+        // the graph created first, it answers the queries which don't depend on the stream
+        Graph*                                  templateGraph = nullptr;
+        // found by the first graph of these or the previous streams, the other graphs are created with them
+        std::shared_ptr<const MKLDNNGraph::PrimitiveDescriptorsList> primitiveDescriptors;
+        int                                     threadsPerStream = 0;
+    };
+
     NumaNodesWeights&                           _numaNodesWeights;
+    Streams::Ptr                                _streams;
+    mutable std::mutex                          _streamsMutex;
+    std::mutex                                  _reconfigMutex;
+    std::mutex                                  _setConfigMutex;
+
+    Streams::Ptr CreateStreams(const Config &cfg, const Streams::Ptr &current = nullptr) const;
+    Streams::Ptr GetStreams() const;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
      *       even from main thread
      */
-    Graph::Lock GetGraph() const;
+    Graph::Lock GetGraph(const Streams::Ptr &streams) const;
 
+    /* The graph compiled when the streams were created. Use it instead of GetGraph() to query the network structure
+     * and the config from threads which don't run inferences, so no graph is created for them.
+     */
+    Graph::Lock GetTemplateGraph() const;
 
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
@@ -4,7 +4,10 @@
 
 #include "mkldnn_extension.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/fused_color_convert.hpp"
+#include "ngraph_transformations/op/fused_preprocess.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/multi_head_attention.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
 
@@ -35,7 +38,10 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
 
 #define NGRAPH_OP(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
         NGRAPH_OP(FullyConnectedNode, MKLDNNPlugin)
+        NGRAPH_OP(FusedColorConvertNode, MKLDNNPlugin)
+        NGRAPH_OP(FusedPreprocessNode, MKLDNNPlugin)
         NGRAPH_OP(LeakyReluNode, MKLDNNPlugin)
+        NGRAPH_OP(MultiHeadAttentionNode, MKLDNNPlugin)
         NGRAPH_OP(PowerStaticNode, MKLDNNPlugin)
         NGRAPH_OP(SwishNode, MKLDNNPlugin)
 #undef NGRAPH_OP
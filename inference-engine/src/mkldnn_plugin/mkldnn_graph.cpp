@@ -25,6 +25,7 @@
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_convert_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -71,6 +72,7 @@ void MKLDNNGraph::CreateGraph(NET &net, const MKLDNNExtensionManager::Ptr& extMg
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
     Replicate(net, extMgr);
+    LinkMemoryNodes();
     InitGraph();
 
     status = Ready;
@@ -230,6 +232,13 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
             }
         }
 
+        if (node->getType() == MemoryInput) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            if (!memoryNode)
+                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+            memoryInputNodesMap[memoryNode->getId()] = node;
+        }
+
         op2node[op] = node;
 
         for (size_t port = 0; port < op->get_input_size(); port++) {
@@ -308,6 +317,30 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
     }
 }
 
+void MKLDNNGraph::LinkMemoryNodes() {
+    // Each graph pairs its own ReadValue and Assign nodes, so the graphs of different streams built on the same
+    // thread never share the state storage
+    std::map<std::string, MKLDNNMemoryInputNode*> memoryInputs;
+    for (const auto& node : graphNodes) {
+        if (node->getType() != MemoryInput)
+            continue;
+        auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+        if (!memoryNode)
+            IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+        memoryInputs[memoryNode->getId()] = memoryNode;
+    }
+    for (const auto& node : graphNodes) {
+        if (node->getType() != MemoryOutput)
+            continue;
+        auto memoryNode = dynamic_cast<MKLDNNMemoryOutputNode*>(node.get());
+        if (!memoryNode)
+            IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryOutputNode";
+        auto memoryInput = memoryInputs.find(memoryNode->getId());
+        if (memoryInput != memoryInputs.end())
+            memoryNode->setInputNode(memoryInput->second);
+    }
+}
+
 void MKLDNNGraph::InitGraph() {
     MKLDNNGraphOptimizer optimizer;
     CPU_DEBUG_CAP_ENABLE(initNodeDumper(config.debugCaps));
@@ -352,7 +385,14 @@ void MKLDNNGraph::InitNodes() {
 void MKLDNNGraph::InitDescriptors() {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "InitDescriptors", "Prepare");
 
-    for (auto &node : graphNodes) {
+    // the graphs created from the same network and config have the same nodes at this point
+    if (sharedPrimitiveDescriptors && sharedPrimitiveDescriptors->size() != graphNodes.size())
+        sharedPrimitiveDescriptors = nullptr;
+    if (keptPrimitiveDescriptors)
+        keptPrimitiveDescriptors->resize(graphNodes.size());
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto &node = graphNodes[i];
         if (node->getType() == Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
             if (inputNode)
@@ -362,7 +402,16 @@ void MKLDNNGraph::InitDescriptors() {
         node->getSupportedDescriptors();
 
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
+        const bool canShare = node->canShareSupportedPrimitiveDescriptors();
+        if (canShare && sharedPrimitiveDescriptors) {
+            // the node takes the descriptors found by the first graph, so it doesn't enumerate them again
+            const auto& shared = (*sharedPrimitiveDescriptors)[i];
+            if (shared.first == node->getName())
+                node->supportedPrimitiveDescriptors = shared.second;
+        }
         node->initSupportedPrimitiveDescriptors();
+        if (canShare && keptPrimitiveDescriptors)
+            (*keptPrimitiveDescriptors)[i] = {node->getName(), node->getSupportedPrimitiveDescriptors()};
 
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
         node->filterSupportedPrimitiveDescriptors();
@@ -1232,6 +1281,7 @@ void MKLDNNGraph::EnforceBF16() {
         RNNCell,        // recurent nets
         RNNSeq,         // recurent nets
         MatMul,         // bert nets
+        MultiHeadAttention, // bert / gpt nets
         ROIPooling,     // object detection nets
         Interpolate,    // super resolution nets
     };
@@ -21,6 +21,8 @@ class MKLDNNInferRequest;
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
+    // the names and the supported primitive descriptors of the graph nodes in the order of their initialization
+    typedef std::vector<std::pair<std::string, std::vector<NodeDesc>>> PrimitiveDescriptorsList;
     MKLDNNWeightsSharing::Ptr weightsCache;
 
     enum Status {
@@ -52,6 +54,23 @@ public:
                      const MKLDNNExtensionManager::Ptr& extMgr,
                      MKLDNNWeightsSharing::Ptr &w_cache);
 
+    /**
+     * @brief Keeps the supported primitive descriptors found while the graph is created, see
+     * MKLDNNNode::canShareSupportedPrimitiveDescriptors(). The graphs created next from the same network and config
+     * take them with SetSharedPrimitiveDescriptors() instead of enumerating the oneDNN implementations again.
+     */
+    void KeepPrimitiveDescriptors() {
+        keptPrimitiveDescriptors = std::make_shared<PrimitiveDescriptorsList>();
+    }
+
+    std::shared_ptr<const PrimitiveDescriptorsList> GetKeptPrimitiveDescriptors() const {
+        return keptPrimitiveDescriptors;
+    }
+
+    void SetSharedPrimitiveDescriptors(const std::shared_ptr<const PrimitiveDescriptorsList>& descriptors) {
+        sharedPrimitiveDescriptors = descriptors;
+    }
+
     bool hasMeanImageFor(const std::string& name) {
         return _normalizePreprocMap.find(name) != _normalizePreprocMap.end();
     }
@@ -85,6 +104,11 @@ public:
         return outputNodesMap;
     }
 
+    // MemoryInput nodes by the variable id
+    std::map<std::string, MKLDNNNodePtr>& GetMemoryInputNodesMap() {
+        return memoryInputNodesMap;
+    }
+
     MKLDNNNodePtr getInputNodeByName(const std::string &name) {
         auto input = inputNodesMap.find(name);
         if (input == inputNodesMap.end())
@@ -195,6 +219,7 @@ protected:
 
         inputNodesMap.clear();
         outputNodesMap.clear();
+        memoryInputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
@@ -223,6 +248,7 @@ protected:
 
     void Replicate(const InferenceEngine::CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
     void Replicate(const std::shared_ptr<const ngraph::Function> &subgraph, const MKLDNNExtensionManager::Ptr& extMgr);
+    void LinkMemoryNodes();
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
@@ -243,6 +269,7 @@ private:
     // TODO: change std::map to std::unordered_map
     std::map<std::string, MKLDNNNodePtr> inputNodesMap;
     std::map<std::string, MKLDNNNodePtr> outputNodesMap;
+    std::map<std::string, MKLDNNNodePtr> memoryInputNodesMap;
 
     // these node pointers (from graphNodes) are to avoid regular checking for
     // constantness of nodes in ExecuteConstantNodesOnly, Infer methods and calls of
@@ -250,6 +277,9 @@ private:
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
 
+    std::shared_ptr<PrimitiveDescriptorsList> keptPrimitiveDescriptors;
+    std::shared_ptr<const PrimitiveDescriptorsList> sharedPrimitiveDescriptors;
+
     void EnforceBF16();
 };
 
@@ -44,9 +44,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::CreateInferRequest() {
     auto id = (execNetwork->_numRequests)++;
     profilingTask = openvino::itt::handle("MKLDNN_INFER_" + execNetwork->_name + "_" + std::to_string(id));
 
-    if (execNetwork->_graphs.size() == 0)
+    streams = execNetwork->GetStreams();
+    if (streams->graphs.size() == 0)
         IE_THROW() << "No graph was found";
-    graph = &(execNetwork->GetGraph()._graph);
+    graph = streams->templateGraph;
 
     // Allocate all input blobs if shape is static, delay allocation otherwise
     for (const auto& it : _networkInputs) {
@@ -60,21 +61,31 @@ void MKLDNNPlugin::MKLDNNInferRequest::CreateInferRequest() {
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
-    for (auto& node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!memoryNode) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto state_store = memoryNode->getStore();
-            auto state_name = memoryNode->getId();
-
-            // Remove suffix with pair ID. Internal information.
-            auto suffix_idx = state_name.find("/id=");
-            if (suffix_idx != std::string::npos)
-                state_name = state_name.substr(0, suffix_idx);
-
-            memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+    for (auto& memoryNode : graph->GetMemoryInputNodesMap()) {
+        auto node = dynamic_cast<MKLDNNMemoryInputNode*>(memoryNode.second.get());
+        if (!node) {
+            IE_THROW() << "Cannot cast " << memoryNode.second->getName() << " to MKLDNNMemoryInputNode";
+        }
+        auto state_store = node->getStore();
+        auto state_name = memoryNode.first;
+
+        // Remove suffix with pair ID. Internal information.
+        auto suffix_idx = state_name.find("/id=");
+        if (suffix_idx != std::string::npos)
+            state_name = state_name.substr(0, suffix_idx);
+
+        if (node->isDynamicNode()) {
+            auto state = std::make_shared<MKLDNNDynamicVariableState>(state_name,
+                                                                      state_store->getDesc().getPrecision(),
+                                                                      node->getOutputShapeAtPort(0),
+                                                                      node->getInitialStateDims(),
+                                                                      node->getStateAxis());
+            dynamicVariableStates[memoryNode.first] = state;
+            memoryStates.push_back(state);
+        } else {
+            auto state = std::make_shared<MKLDNNVariableState>(state_name, state_store);
+            variableStates[memoryNode.first] = state;
+            memoryStates.push_back(state);
         }
     }
 }
@@ -139,47 +150,33 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     }
 }
 
+MKLDNNPlugin::MKLDNNMemoryInputNode* MKLDNNPlugin::MKLDNNInferRequest::getMemoryInputNode(const std::string& id) const {
+    const auto& memoryNodesMap = graph->GetMemoryInputNodesMap();
+    auto memoryNode = memoryNodesMap.find(id);
+    if (memoryNode == memoryNodesMap.end())
+        IE_THROW() << "CPU execution graph doesn't contain memory input node with id: " << id;
+    auto node = dynamic_cast<MKLDNNMemoryInputNode*>(memoryNode->second.get());
+    if (!node)
+        IE_THROW() << "Cannot cast " << memoryNode->second->getName() << " to MKLDNNMemoryInputNode";
+    return node;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
+    // the graph may be shared with the other requests, so the state buffers are bound before each inference
+    for (const auto& state : variableStates) {
+        getMemoryInputNode(state.first)->bindState(state.second->GetCurrentPtr(), state.second->GetNextPtr());
+    }
+    // the dynamic states are updated in place by the graph
+    for (const auto& state : dynamicVariableStates) {
+        getMemoryInputNode(state.first)->bindDynamicState(state.second.get());
     }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
-        }
+    for (const auto& state : variableStates) {
+        // the next buffer is written only if the variable is assigned
+        if (getMemoryInputNode(state.first)->hasOutputNode())
+            state.second->SwapBuffers();
     }
 }
 
@@ -198,7 +195,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::redefineMemoryForInputNodes() {
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
+    auto graphLock = execNetwork->GetGraph(streams);
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
@@ -396,9 +393,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     const auto &blobDesc = data->getTensorDesc();
 
     if (isInput) {
-        if (foundInput->getPrecision() != blobDesc.getPrecision()) {
+        auto blobPrecision = blobDesc.getPrecision();
+        // a compound blob of per-batch images has no own tensor desc, the images are checked instead
+        if (compoundBlobPassed && blobPrecision == InferenceEngine::Precision::UNSPECIFIED) {
+            const auto images = data->as<InferenceEngine::CompoundBlob>();
+            if (images->size() != 0 && images->getBlob(0))
+                blobPrecision = images->getBlob(0)->getTensorDesc().getPrecision();
+        }
+        if (foundInput->getPrecision() != blobPrecision) {
             IE_THROW(ParameterMismatch) << "Failed to set input blob with precision: "
-                               << blobDesc.getPrecision() << ", if CNNNetwork input blob precision is: " << foundInput->getPrecision();
+                               << blobPrecision << ", if CNNNetwork input blob precision is: " << foundInput->getPrecision();
         }
 
         const bool preProcRequired = preProcessingRequired(foundInput, data);
@@ -637,6 +641,15 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetAsyncRequest(MKLDNNAsyncInferRequest*
     _asyncRequest = asyncRequest;
 }
 
+MKLDNNPlugin::MKLDNNExecNetwork::Streams::Ptr MKLDNNPlugin::MKLDNNInferRequest::UpdateStreams() {
+    auto currentStreams = execNetwork->GetStreams();
+    if (currentStreams != streams) {
+        streams = std::move(currentStreams);
+        graph = streams->templateGraph;
+    }
+    return streams;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::ThrowIfCanceled() const {
     if (_asyncRequest != nullptr) {
         _asyncRequest->ThrowIfCanceled();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_exec_network.h"
 #include <memory>
 #include <string>
 #include <map>
@@ -14,6 +15,9 @@ namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNMemoryInputNode;
+class MKLDNNVariableState;
+class MKLDNNDynamicVariableState;
 
 class MKLDNNInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
@@ -46,6 +50,12 @@ public:
      */
     void SetAsyncRequest(MKLDNNAsyncInferRequest* asyncRequest);
 
+    /**
+     * @brief      Moves the idle request to the current streams of the executable network if SetConfig has replaced them
+     * @return     The streams the request runs on
+     */
+    MKLDNNExecNetwork::Streams::Ptr UpdateStreams();
+
     /**
      * @brief If `_asyncRequest` is initialized throw exception with `InferenceEngine::INFER_CANCELLED` status if inference request is canceled
      */
@@ -56,16 +66,21 @@ private:
     void PushInputData();
     void PushStates();
     void PullStates();
+    MKLDNNMemoryInputNode* getMemoryInputNode(const std::string& id) const;
     void redefineMemoryForInputNodes();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
+    MKLDNNExecNetwork::Streams::Ptr     streams;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    // variable states by the id of the MemoryInput node
+    std::map<std::string, std::shared_ptr<MKLDNNVariableState>> variableStates;
+    std::map<std::string, std::shared_ptr<MKLDNNDynamicVariableState>> dynamicVariableStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
 };
 }  // namespace MKLDNNPlugin
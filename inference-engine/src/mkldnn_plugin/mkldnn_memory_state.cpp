@@ -6,6 +6,11 @@
 #include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
@@ -14,4 +19,147 @@ void  MKLDNNVariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+void MKLDNNVariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState)
+        IE_THROW() << "Cannot set empty state for variable " << name;
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW() << "Cannot set state for variable " << name << ": expected " << state->byteSize()
+                   << " bytes, got " << newState->byteSize();
+    // the buffer is bound to the graph memory, so the data is copied instead of replacing the blob
+    cpu_memcpy(state->buffer(), newState->cbuffer(), state->byteSize());
+}
+
+Blob::CPtr MKLDNNVariableState::GetState() const {
+    // the current buffer becomes the next one after the inference, so the user gets a snapshot
+    auto snapshot = make_blob_with_precision(state->getTensorDesc());
+    snapshot->allocate();
+    cpu_memcpy(snapshot->buffer(), state->cbuffer(), state->byteSize());
+    return snapshot;
+}
+
+MKLDNNDynamicVariableState::MKLDNNDynamicVariableState(std::string name, Precision precision, const Shape& shape,
+                                                       VectorDims initialDims, size_t axis)
+        : IVariableStateInternal{name}, precision(precision), shapeDims(shape.getDims()),
+          initialDims(std::move(initialDims)), axis(axis) {
+    if (axis >= this->initialDims.size())
+        IE_THROW() << "Incorrect dynamic dimension " << axis << " of the state " << name;
+    Reset();
+}
+
+size_t MKLDNNDynamicVariableState::getOuterSize(const VectorDims& shape) const {
+    return std::accumulate(shape.begin(), shape.begin() + axis, size_t(1), std::multiplies<size_t>());
+}
+
+size_t MKLDNNDynamicVariableState::getInnerBytes(const VectorDims& shape) const {
+    return std::accumulate(shape.begin() + axis + 1, shape.end(), precision.size(), std::multiplies<size_t>());
+}
+
+void MKLDNNDynamicVariableState::reserve(const VectorDims& newDims, bool keepData) {
+    if (newDims.size() != initialDims.size())
+        IE_THROW() << "Cannot set state for variable " << name << ": expected rank " << initialDims.size()
+                   << ", got " << newDims.size();
+
+    const auto outer = getOuterSize(newDims);
+    const auto inner = getInnerBytes(newDims);
+    const bool sameRows = dims.size() == newDims.size() && outer == getOuterSize(dims) && inner == getInnerBytes(dims);
+    if (sameRows && newDims[axis] <= capacity)
+        return;
+
+    // the geometric growth keeps the amortized cost of appending one slice constant
+    const auto newCapacity = sameRows ? std::max(newDims[axis], capacity * 2) : newDims[axis];
+    std::unique_ptr<uint8_t[]> newBuffer(new uint8_t[outer * newCapacity * inner]);
+    if (keepData && sameRows) {
+        for (size_t i = 0; i < outer; i++) {
+            cpu_memcpy(newBuffer.get() + i * newCapacity * inner, buffer.get() + i * capacity * inner,
+                       dims[axis] * inner);
+        }
+    }
+    buffer = std::move(newBuffer);
+    capacity = newCapacity;
+}
+
+void MKLDNNDynamicVariableState::Reset() {
+    reserve(initialDims, false);
+    dims = initialDims;
+    const auto inner = getInnerBytes(dims);
+    for (size_t i = 0; i < getOuterSize(dims); i++) {
+        std::memset(buffer.get() + i * capacity * inner, 0, dims[axis] * inner);
+    }
+}
+
+void MKLDNNDynamicVariableState::Trim(size_t length) {
+    if (length > dims[axis])
+        IE_THROW() << "Cannot trim state " << name << " to " << length << ": the current length is " << dims[axis];
+    // the rows keep their place in the buffer, so only the length changes
+    dims[axis] = length;
+}
+
+void MKLDNNDynamicVariableState::Read(void* dst) const {
+    const auto inner = getInnerBytes(dims);
+    const auto rowSize = dims[axis] * inner;
+    for (size_t i = 0; i < getOuterSize(dims); i++) {
+        cpu_memcpy(static_cast<uint8_t*>(dst) + i * rowSize, buffer.get() + i * capacity * inner, rowSize);
+    }
+}
+
+void MKLDNNDynamicVariableState::Write(const void* src, const VectorDims& newDims) {
+    reserve(newDims, false);
+    dims = newDims;
+    const auto inner = getInnerBytes(dims);
+    const auto rowSize = dims[axis] * inner;
+    for (size_t i = 0; i < getOuterSize(dims); i++) {
+        cpu_memcpy(buffer.get() + i * capacity * inner, static_cast<const uint8_t*>(src) + i * rowSize, rowSize);
+    }
+}
+
+void MKLDNNDynamicVariableState::Append(const void* slice, const VectorDims& newDims) {
+    bool isAppend = newDims.size() == dims.size() && newDims[axis] >= dims[axis];
+    for (size_t i = 0; i < dims.size() && isAppend; i++) {
+        isAppend = i == axis || newDims[i] == dims[i];
+    }
+    if (!isAppend)
+        IE_THROW() << "Cannot append to state " << name << ": the dims differ from the current ones not only along "
+                   << "the dimension " << axis;
+
+    reserve(newDims, true);
+    const auto inner = getInnerBytes(dims);
+    const auto length = dims[axis];
+    const auto sliceSize = (newDims[axis] - length) * inner;
+    for (size_t i = 0; i < getOuterSize(dims); i++) {
+        cpu_memcpy(buffer.get() + (i * capacity + length) * inner, static_cast<const uint8_t*>(slice) + i * sliceSize,
+                   sliceSize);
+    }
+    dims = newDims;
+}
+
+void* MKLDNNDynamicVariableState::GetDenseData() {
+    return getOuterSize(dims) == 1 ? buffer.get() : nullptr;
+}
+
+void MKLDNNDynamicVariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState)
+        IE_THROW() << "Cannot set empty state for variable " << name;
+    const auto& newDesc = newState->getTensorDesc();
+    if (newDesc.getPrecision() != precision)
+        IE_THROW(ParameterMismatch) << "Cannot set state for variable " << name << ": expected precision " << precision
+                                    << ", got " << newDesc.getPrecision();
+    const auto& newDims = newDesc.getDims();
+    bool dimsMatch = newDims.size() == shapeDims.size();
+    for (size_t i = 0; i < shapeDims.size() && dimsMatch; i++) {
+        dimsMatch = shapeDims[i] == Shape::UNDEFINED_DIM || shapeDims[i] == newDims[i];
+    }
+    if (!dimsMatch)
+        IE_THROW(ParameterMismatch) << "Cannot set state for variable " << name << ": the dims "
+                                    << MemoryDescUtils::dims2str(newDims) << " don't match the state dims "
+                                    << MemoryDescUtils::dims2str(shapeDims);
+    Write(newState->cbuffer().as<const void*>(), newDims);
+}
+
+Blob::CPtr MKLDNNDynamicVariableState::GetState() const {
+    auto snapshot = make_blob_with_precision(TensorDesc(precision, dims, TensorDesc::getLayoutByDims(dims)));
+    snapshot->allocate();
+    Read(snapshot->buffer().as<void*>());
+    return snapshot;
+}
+
 }  // namespace MKLDNNPlugin
@@ -10,20 +10,90 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <memory>
 #include <string>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
+/**
+ * The state keeps two buffers: the graph reads the state from the current one and writes the new state to the next
+ * one, so the buffers are bound to the memory nodes without copying and swapped after the inference.
+ */
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
     MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
             InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
+        const auto desc = MemoryDescUtils::convertToTensorDesc(storage->getDesc());
+        state = make_blob_with_precision(desc);
         state->allocate();
         cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        nextState = make_blob_with_precision(desc);
+        nextState->allocate();
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    void* GetCurrentPtr() {
+        return state->buffer().as<void*>();
+    }
+
+    void* GetNextPtr() {
+        return nextState->buffer().as<void*>();
+    }
+
+    void SwapBuffers() {
+        std::swap(state, nextState);
+    }
+
+private:
+    InferenceEngine::Blob::Ptr nextState;
+};
+
+/**
+ * The state with a dynamic dimension (e.g. the sequence length of a key/value cache). The buffer keeps spare capacity
+ * along this dimension and grows geometrically, so appending to the state copies only the new rows.
+ * The state is a sequence of rows of the [outer, capacity, inner] buffer, where outer and inner are the products of
+ * the dimensions before and after the dynamic one.
+ */
+class MKLDNNDynamicVariableState : public InferenceEngine::IVariableStateInternal {
+public:
+    MKLDNNDynamicVariableState(std::string name, InferenceEngine::Precision precision, const Shape& shape,
+                               VectorDims initialDims, size_t axis);
+
+    void Reset() override;
+    void Trim(size_t length) override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const VectorDims& GetDims() const {
+        return dims;
+    }
+
+    // Copies the state to the dense memory
+    void Read(void* dst) const;
+    // Replaces the state with the dense data of the given dims
+    void Write(const void* src, const VectorDims& newDims);
+    // Appends the dense slice along the dynamic dimension, so that the state gets the given dims
+    void Append(const void* slice, const VectorDims& newDims);
+    // The buffer if the state is dense in it, i.e. all the dimensions before the dynamic one are 1, otherwise nullptr
+    void* GetDenseData();
+
+private:
+    size_t getOuterSize(const VectorDims& shape) const;
+    size_t getInnerBytes(const VectorDims& shape) const;
+    void reserve(const VectorDims& newDims, bool keepData);
+
+    InferenceEngine::Precision precision;
+    // the dims of the state shape, the dynamic ones are Shape::UNDEFINED_DIM
+    VectorDims shapeDims;
+    VectorDims initialDims;
+    VectorDims dims;
+    size_t axis;
+    size_t capacity = 0;
+    std::unique_ptr<uint8_t[]> buffer;
 };
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
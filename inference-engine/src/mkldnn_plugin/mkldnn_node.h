@@ -356,6 +356,14 @@ public:
 
     virtual void initSupportedPrimitiveDescriptors();
 
+    /**
+     * @brief Returns true if initSupportedPrimitiveDescriptors() only enumerates the descriptors and keeps no other state,
+     * so the node may take the descriptors found for the same node of another graph created from the same network
+     */
+    virtual bool canShareSupportedPrimitiveDescriptors() const {
+        return false;
+    }
+
     /**
      * @brief Filters supportedPrimitiveDescriptors according to the input layouts specified in inputMemoryFormatsFilter
      * and output layouts specified in outputMemoryFormatsFilter
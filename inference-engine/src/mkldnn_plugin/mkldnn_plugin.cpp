@@ -239,32 +239,51 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         return false;
     };
 
+    // the sequence lengths are not provided if they are the broadcasted T dimension of the data or its static value
+    auto isSeqLenProvided = [](const std::shared_ptr<ngraph::Node>& seq_len, const ngraph::Output<ngraph::Node>& data) -> bool {
+        auto node = seq_len;
+        while (ngraph::is_type<ngraph::opset1::Broadcast>(node) || ngraph::is_type<ngraph::opset3::Broadcast>(node) ||
+               ngraph::is_type<ngraph::opset1::Convert>(node))
+            node = node->get_input_node_shared_ptr(0);
+        const auto& max_seq_len = data.get_partial_shape()[1];
+        if (max_seq_len.is_static() && !ngraph::op::util::is_seq_len_provided(node, max_seq_len.get_length()))
+            return false;
+        const auto gather = std::dynamic_pointer_cast<ngraph::op::util::GatherBase>(node);
+        if (!gather)
+            return true;
+        const auto shape_of = gather->get_input_node_shared_ptr(0);
+        if ((!ngraph::is_type<ngraph::opset1::ShapeOf>(shape_of) && !ngraph::is_type<ngraph::opset3::ShapeOf>(shape_of)) ||
+            shape_of->input_value(0) != data)
+            return true;
+        const auto indices = std::dynamic_pointer_cast<ngraph::opset1::Constant>(gather->get_input_node_shared_ptr(1));
+        const auto axis = std::dynamic_pointer_cast<ngraph::opset1::Constant>(gather->get_input_node_shared_ptr(2));
+        return !indices || !axis || indices->cast_vector<int64_t>() != std::vector<int64_t>{1} ||
+               axis->cast_vector<int64_t>() != std::vector<int64_t>{0};
+    };
+
     // Sequences supported by the plugin shouldn't be converted to TensorIterator.
     // sequence_length input is not supported in all Sequences, so if is_seq_len_provided() == true, we
     // should always convert to TensorIterator.
     // RNN/GRU/LSTM Sequences are supported with clip == 0, and with default activations.
-    auto isSequencePrimitiveSupported = [](const_node_ptr &node) -> bool {
-        const auto& data = node->input(0);
+    // The batch and the sequence length T may be dynamic.
+    auto isSequencePrimitiveSupported = [isSeqLenProvided](const_node_ptr &node) -> bool {
+        const auto& data = node->input_value(0);
         const auto& data_pshape = data.get_partial_shape();
-        if (data_pshape.rank().is_static() && data_pshape.rank().get_length() > 1 && !data_pshape[1].is_static())
+        if (data_pshape.rank().is_dynamic() || data_pshape.rank().get_length() < 2)
             return false;
-        auto max_seq_len = data.get_shape().at(1);
         if (const auto &rnn_seq = std::dynamic_pointer_cast<const ngraph::opset6::RNNSequence>(node)) {
             return rnn_seq->get_clip() == 0.0f &&
-                   !ngraph::op::util::is_seq_len_provided(rnn_seq->get_input_node_shared_ptr(2),
-                                                          max_seq_len);
+                   !isSeqLenProvided(rnn_seq->get_input_node_shared_ptr(2), data);
         } else if (const auto &gru_seq = std::dynamic_pointer_cast<const ngraph::opset6::GRUSequence>(
                 node)) {
             return gru_seq->get_clip() == 0.0f &&
                    gru_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh"} &&
-                   !ngraph::op::util::is_seq_len_provided(gru_seq->get_input_node_shared_ptr(2),
-                                                          max_seq_len);
+                   !isSeqLenProvided(gru_seq->get_input_node_shared_ptr(2), data);
         } else if (const auto &lstm_seq = std::dynamic_pointer_cast<const ngraph::opset6::LSTMSequence>(
                 node)) {
             return lstm_seq->get_clip() == 0.0f &&
                    lstm_seq->get_activations() == std::vector<std::string>{"sigmoid", "tanh", "tanh"} &&
-                   !ngraph::op::util::is_seq_len_provided(lstm_seq->get_input_node_shared_ptr(3),
-                                                          max_seq_len);
+                   !isSeqLenProvided(lstm_seq->get_input_node_shared_ptr(3), data);
         }
         return false;
     };
@@ -493,10 +512,62 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     postLPTPassManager.run_passes(nGraphFunc);
 }
 
-static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT) {
+static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT, const Config& conf) {
     auto nGraphFunc = clonedNetwork.getFunction();
     TransformationUpToCPUSpecificOpSet(nGraphFunc, _enableLPT);
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    ConvertToCPUSpecificOpset(nGraphFunc, conf.mhaMinKeyLength);
+}
+
+int Engine::GetNumStreamsForThroughput(const std::shared_ptr<ngraph::Function>& function) {
+    const auto isa = dnnl::get_effective_cpu_isa();
+    float isaSpecificThreshold = 1.0f;
+    switch (isa) {
+        case dnnl::cpu_isa::sse41 :
+            isaSpecificThreshold = 0.5f;
+            break;
+        case dnnl::cpu_isa::avx2:
+        case dnnl::cpu_isa::avx512_core:
+            isaSpecificThreshold = 1.0f;
+            break;
+        case dnnl::cpu_isa::avx512_core_vnni:
+        case dnnl::cpu_isa::avx2_vnni:
+            isaSpecificThreshold = 2.0f;
+            break;
+        case dnnl::cpu_isa::avx512_core_amx:
+            isaSpecificThreshold = 4.0f;
+            break;
+        default:
+            isaSpecificThreshold = 1.0f;
+    }
+    // the more "capable" the CPU in general, the more streams we may want to keep to keep it utilized
+    const float memThresholdAssumeLimitedForISA = ov::MemBandwidthPressure::LIMITED/isaSpecificThreshold;
+    const float L2_cache_size = mkldnn::utils::get_cache_size(2 /*level*/, true /*per core */);
+    const float L3_cache_size = mkldnn::utils::get_cache_size(3, false);
+    ov::MemBandwidthPressure networkToleranceForLowCache = ov::MemBandwidthPressureTolerance(
+            function,
+            L2_cache_size, L3_cache_size,
+            memThresholdAssumeLimitedForISA);
+    // num of phys CPU cores (most aggressive value for #streams)
+    const auto num_cores = getNumberOfCPUCores();
+    // less aggressive
+    const auto num_streams_less_aggressive = num_cores / 2;
+    // default #streams value (most conservative)
+    const auto default_num_streams = IStreamsExecutor::Config::GetDefaultNumStreams();
+    int num_streams = default_num_streams;
+    if (networkToleranceForLowCache.max_mem_tolerance == ov::MemBandwidthPressure::UNKNOWN) {
+        if ((networkToleranceForLowCache.ratio_compute_convs == ov::MemBandwidthPressure::ALL)
+            || (networkToleranceForLowCache.ratio_compute_deconvs == ov::MemBandwidthPressure::ALL)) {
+            // all relevant layers (convs, etc) are compute-limited, the most aggressive val for #streams
+            num_streams = num_cores;
+        }   // otherwise (no recognized layers) falling back to the default value
+    } else if (networkToleranceForLowCache.max_mem_tolerance > memThresholdAssumeLimitedForISA) {
+        // network is below the ISA-specific threshold
+        num_streams = num_cores;
+    } else if (networkToleranceForLowCache.max_mem_tolerance > ov::MemBandwidthPressure::LIMITED) {
+        // network is below general threshold
+        num_streams = std::max(default_num_streams, num_streams_less_aggressive);
+    }
+    return num_streams;
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr
@@ -533,6 +604,8 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT);
 
     // Here the OV perf modes are turned into specific settings (as we need the network for better params selection)
+    // the estimate is kept in the config, so the executable network's SetConfig doesn't repeat it for the THROUGHPUT hint
+    int throughputHintStreams = 0;
     const auto& mode = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT);
     // the mode may have just arrived to the LoadNetwork, or was set with the plugins' SetConfig
     if (mode != config.end() || !engConfig.perfHintsConfig.ovPerfHint.empty()) {
@@ -544,54 +617,8 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
             if (mode_name == CONFIG_VALUE(LATENCY)) {
                 config[PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS] = CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
             } else if (mode_name == CONFIG_VALUE(THROUGHPUT)) {
-                const auto isa = dnnl::get_effective_cpu_isa();
-                float isaSpecificThreshold = 1.0f;
-                switch (isa) {
-                    case dnnl::cpu_isa::sse41 :
-                        isaSpecificThreshold = 0.5f;
-                        break;
-                    case dnnl::cpu_isa::avx2:
-                    case dnnl::cpu_isa::avx512_core:
-                        isaSpecificThreshold = 1.0f;
-                        break;
-                    case dnnl::cpu_isa::avx512_core_vnni:
-                    case dnnl::cpu_isa::avx2_vnni:
-                        isaSpecificThreshold = 2.0f;
-                        break;
-                    case dnnl::cpu_isa::avx512_core_amx:
-                        isaSpecificThreshold = 4.0f;
-                        break;
-                    default:
-                        isaSpecificThreshold = 1.0f;
-                }
-                // the more "capable" the CPU in general, the more streams we may want to keep to keep it utilized
-                const float memThresholdAssumeLimitedForISA = ov::MemBandwidthPressure::LIMITED/isaSpecificThreshold;
-                const float L2_cache_size = mkldnn::utils::get_cache_size(2 /*level*/, true /*per core */);
-                const float L3_cache_size = mkldnn::utils::get_cache_size(3, false);
-                ov::MemBandwidthPressure networkToleranceForLowCache = ov::MemBandwidthPressureTolerance(
-                        clonedNetwork.getFunction(),
-                        L2_cache_size, L3_cache_size,
-                        memThresholdAssumeLimitedForISA);
-                // num of phys CPU cores (most aggressive value for #streams)
-                const auto num_cores = getNumberOfCPUCores();
-                // less aggressive
-                const auto num_streams_less_aggressive = num_cores / 2;
-                // default #streams value (most conservative)
-                const auto default_num_streams = IStreamsExecutor::Config::GetDefaultNumStreams();
-                int num_streams = default_num_streams;
-                if (networkToleranceForLowCache.max_mem_tolerance == ov::MemBandwidthPressure::UNKNOWN) {
-                    if ((networkToleranceForLowCache.ratio_compute_convs == ov::MemBandwidthPressure::ALL)
-                        || (networkToleranceForLowCache.ratio_compute_deconvs == ov::MemBandwidthPressure::ALL)) {
-                        // all relevant layers (convs, etc) are compute-limited, the most aggressive val for #streams
-                        num_streams = num_cores;
-                    }   // otherwise (no recognized layers) falling back to the default value
-                } else if (networkToleranceForLowCache.max_mem_tolerance > memThresholdAssumeLimitedForISA) {
-                    // network is below the ISA-specific threshold
-                    num_streams = num_cores;
-                } else if (networkToleranceForLowCache.max_mem_tolerance > ov::MemBandwidthPressure::LIMITED) {
-                    // network is below general threshold
-                    num_streams = std::max(default_num_streams, num_streams_less_aggressive);
-                }
+                throughputHintStreams = GetNumStreamsForThroughput(clonedNetwork.getFunction());
+                int num_streams = throughputHintStreams;
                 auto num_requests = config.find(PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS);
                 if (engConfig.perfHintsConfig.ovPerfHintNumRequests)  // set thru SetConfig to the plugin
                     num_streams = std::min(engConfig.perfHintsConfig.ovPerfHintNumRequests,
@@ -603,12 +630,12 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
            }
         }
     }
-    ConvertToCPUSpecificOpset(nGraphFunc);
-
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
     Config conf = engConfig;
     conf.readProperties(config);
+    ConvertToCPUSpecificOpset(nGraphFunc, conf.mhaMinKeyLength);
+    conf.throughputHintStreams = throughputHintStreams;
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
@@ -739,7 +766,7 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
         const auto& lptProp = config.find(InferenceEngine::PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE);
         const bool enableLPT = (lptProp != config.end() && lptProp->second == PluginConfigParams::YES) /* enabled in the orig_config*/
                                || Config::LPTransformsMode::On == engConfig.lpTransformsMode /* or already enabled */;
-        Transformation(clonedNetwork, enableLPT);
+        Transformation(clonedNetwork, enableLPT, conf);
         auto ops = clonedNetwork.getFunction()->get_ordered_ops();
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
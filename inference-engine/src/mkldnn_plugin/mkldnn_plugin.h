@@ -40,6 +40,9 @@ public:
     InferenceEngine::IExecutableNetworkInternal::Ptr ImportNetwork(std::istream& networkModel,
                                                      const std::map<std::string, std::string>& config) override;
 
+    // Estimates the number of streams for the THROUGHPUT hint from the memory bandwidth pressure of the network
+    static int GetNumStreamsForThroughput(const std::shared_ptr<ngraph::Function>& function);
+
 private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
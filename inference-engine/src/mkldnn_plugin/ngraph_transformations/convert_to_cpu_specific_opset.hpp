@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <ngraph/opsets/opset1.hpp>
 #include <ngraph/pass/constant_folding.hpp>
 #include "fc_bias_fusion.hpp"
 #include "ngraph/op/fake_quantize.hpp"
@@ -14,6 +15,8 @@
 #include "convert_tile_to_seq_tiles.hpp"
 #include "convert_matmul_to_fc.hpp"
 #include "convert_to_power_static.hpp"
+#include "fuse_preprocessing.hpp"
+#include "fuse_multi_head_attention.hpp"
 #include "convert_to_leaky_relu.hpp"
 #include "convert_to_swish_cpu.hpp"
 #include "transformations/convert_precision.hpp"
@@ -22,14 +25,19 @@
 
 namespace MKLDNNPlugin {
 
-inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc) {
+inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc, int64_t mhaMinKeyLength) {
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::ConstantFolding>();
+    // must run before the MatMul ranks are aligned and the scaling is converted to PowerStatic
+    manager.register_pass<FuseMultiHeadAttention>(mhaMinKeyLength);
     manager.register_pass<ConvertMatMulToFC>();
     manager.register_pass<AlignMatMulInputRanks>();
     manager.register_pass<ConvertTileToSeqTiles>();
     manager.register_pass<FullyConnectedBiasFusion>();
     manager.register_pass<ReshapeFullyConnected>();
+    // must run before the eltwise ops with scalar constants are converted to PowerStatic
+    manager.register_pass<FusePreprocessing>();
+    manager.register_pass<FuseColorConversion>();
     manager.register_pass<ConvertToPowerStatic>();
     manager.register_pass<ConvertToLeakyRelu>();
     manager.register_pass<ReshapePRelu>();
@@ -43,9 +51,17 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
     manager.register_pass<ngraph::pass::ConstantFolding>();
     manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::i64, ngraph::element::i32 }});
 
-    // TODO: remove after dynamic shapes support in FullyConnectedNode
+    // FullyConnectedNode reorders the weights once for all the input shapes, so the reduced dimension must be static,
+    // the dynamic data of rank 4 and higher isn't supported by it, such MatMuls are left to MatMulNode
     manager.get_pass_config()->set_callback<ConvertMatMulToFC>([](const std::shared_ptr<const ngraph::Node>& node) -> bool {
-        return node->get_input_partial_shape(0).is_dynamic();
+        const auto matmul = std::dynamic_pointer_cast<const ngraph::opset1::MatMul>(node);
+        const auto& shape = node->get_input_partial_shape(0);
+        if (!matmul || shape.rank().is_dynamic())
+            return true;
+        const auto rank = shape.rank().get_length();
+        if (rank > 3 && shape.is_dynamic())
+            return true;
+        return shape[matmul->get_transpose_a() && rank > 1 ? rank - 2 : rank - 1].is_dynamic();
     });
 
     manager.run_passes(nGraphFunc);
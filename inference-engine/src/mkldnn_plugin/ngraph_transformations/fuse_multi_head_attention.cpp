@@ -0,0 +1,257 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_multi_head_attention.hpp"
+
+#include <algorithm>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/validation_util.hpp>
+#include "op/multi_head_attention.hpp"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FuseMultiHeadAttention, "FuseMultiHeadAttention", 0);
+
+namespace {
+
+// the masked out scores are set to a large negative value by the models instead of -inf quite often
+constexpr float maskedOutThreshold = -1e4f;
+
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+bool getScalar(const std::shared_ptr<ngraph::Node>& node, float& value) {
+    const auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(node);
+    if (!constant || !constant->get_element_type().is_real() || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+// the mask must not change the shape of the scores, so every its dimension is either 1 or matches the scores one
+bool isMaskBroadcastable(const ngraph::PartialShape& mask, const ngraph::PartialShape& scores) {
+    if (mask.rank().is_dynamic() || mask.rank().get_length() > scores.rank().get_length())
+        return false;
+    const auto offset = scores.rank().get_length() - mask.rank().get_length();
+    for (int64_t i = 0; i < mask.rank().get_length(); i++) {
+        const auto& dim = mask[i];
+        const auto& scoresDim = scores[offset + i];
+        if (dim.is_static() && dim.get_length() == 1)
+            continue;
+        if (scoresDim.is_static() ? !dim.compatible(scoresDim) : dim.is_static())
+            return false;
+    }
+    return true;
+}
+
+// [1, ..., 1, L, L] constant with zeros on and below the diagonal and masked out values above it
+bool isCausalMask(const std::shared_ptr<ngraph::Node>& node) {
+    const auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(node);
+    if (!constant || !constant->get_element_type().is_real())
+        return false;
+    const auto& shape = constant->get_shape();
+    if (shape.size() < 2 || shape[shape.size() - 1] != shape[shape.size() - 2] || shape.back() < 2 ||
+        ngraph::shape_size(shape) != shape.back() * shape.back())
+        return false;
+
+    const auto length = shape.back();
+    const auto values = constant->cast_vector<float>();
+    for (size_t i = 0; i < length; i++) {
+        for (size_t j = 0; j < length; j++) {
+            const float value = values[i * length + j];
+            if (j <= i ? value != 0.f : value > maskedOutThreshold)
+                return false;
+        }
+    }
+    return true;
+}
+
+// an element of a 1D shape subgraph: either a constant value or an element of the output of a non constant node
+struct ShapeElement {
+    ngraph::Output<ngraph::Node> source;
+    size_t index = 0lu;
+    int64_t value = 0;
+
+    bool operator==(const ShapeElement& other) const {
+        return source.get_node() ? source == other.source && index == other.index : !other.source.get_node() && value == other.value;
+    }
+};
+
+bool getShapeElement(ngraph::Output<ngraph::Node> output, size_t index, ShapeElement& element) {
+    while (true) {
+        const auto node = output.get_node_shared_ptr();
+        if (const auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(node)) {
+            const auto values = constant->cast_vector<int64_t>();
+            if (index >= values.size())
+                return false;
+            element.value = values[index];
+            return true;
+        } else if (const auto concat = ngraph::as_type_ptr<ngraph::opset1::Concat>(node)) {
+            if (concat->get_output_partial_shape(0).rank() != 1)
+                return false;
+            size_t input = 0;
+            for (; input < concat->get_input_size(); input++) {
+                const auto& shape = concat->get_input_partial_shape(input);
+                if (shape.is_dynamic())
+                    return false;
+                const auto size = ngraph::shape_size(shape.to_shape());
+                if (index < size)
+                    break;
+                index -= size;
+            }
+            if (input == concat->get_input_size())
+                return false;
+            output = concat->input_value(input);
+        } else if (ngraph::is_type<ngraph::opset1::Convert>(node) || ngraph::is_type<ngraph::opset1::Unsqueeze>(node) ||
+                   ngraph::is_type<ngraph::opset1::Reshape>(node) || ngraph::is_type<ngraph::opset1::Squeeze>(node)) {
+            output = node->input_value(0);
+        } else {
+            element.source = output;
+            element.index = index;
+            return true;
+        }
+    }
+}
+
+// StridedSlice of a causal mask which takes the rows [E - Lq, E) and the columns [0, E) of its last two dimensions,
+// the [Lq, E] slice is the causal mask of Lq queries and E keys
+bool isSlicedCausalMask(const std::shared_ptr<ngraph::Node>& node) {
+    const auto slice = ngraph::as_type_ptr<ngraph::opset1::StridedSlice>(node);
+    if (!slice || !isCausalMask(slice->get_input_node_shared_ptr(0)))
+        return false;
+    const auto isZero = [](const std::vector<int64_t>& mask) {
+        return std::all_of(mask.begin(), mask.end(), [](int64_t value) { return value == 0; });
+    };
+    if (!isZero(slice->get_new_axis_mask()) || !isZero(slice->get_shrink_axis_mask()) || !isZero(slice->get_ellipsis_mask()))
+        return false;
+    if (slice->get_input_size() > 3) {
+        const auto strides = ngraph::as_type_ptr<ngraph::opset1::Constant>(slice->get_input_node_shared_ptr(3));
+        if (!strides)
+            return false;
+        const auto values = strides->cast_vector<int64_t>();
+        if (!std::all_of(values.begin(), values.end(), [](int64_t value) { return value == 1; }))
+            return false;
+    }
+
+    const auto rank = slice->get_input_shape(0).size();
+    const auto isMasked = [](const std::vector<int64_t>& mask, size_t axis) {
+        return axis < mask.size() && mask[axis] != 0;
+    };
+    const auto rows = rank - 2;
+    const auto cols = rank - 1;
+    // the masked begin is zero and the masked end is the full dimension, the dimensions of the causal mask are equal
+    ShapeElement colsBegin;
+    if (!isMasked(slice->get_begin_mask(), cols) &&
+        (!getShapeElement(slice->input_value(1), cols, colsBegin) || !(colsBegin == ShapeElement{})))
+        return false;
+    const bool rowsEndMasked = isMasked(slice->get_end_mask(), rows);
+    const bool colsEndMasked = isMasked(slice->get_end_mask(), cols);
+    if (rowsEndMasked || colsEndMasked)
+        return rowsEndMasked && colsEndMasked;
+    ShapeElement rowsEnd, colsEnd;
+    return getShapeElement(slice->input_value(2), rows, rowsEnd) && getShapeElement(slice->input_value(2), cols, colsEnd) &&
+           rowsEnd == colsEnd;
+}
+
+bool fuseMultiHeadAttention(const std::shared_ptr<ngraph::Node>& softmax, int64_t minKeyLength) {
+    int64_t axis = 0;
+    if (const auto softmax1 = ngraph::as_type_ptr<ngraph::opset1::Softmax>(softmax)) {
+        axis = static_cast<int64_t>(softmax1->get_axis());
+    } else if (const auto softmax8 = ngraph::as_type_ptr<ngraph::opset8::Softmax>(softmax)) {
+        axis = softmax8->get_axis();
+    } else {
+        return false;
+    }
+    const auto& scoresShape = softmax->get_output_partial_shape(0);
+    if (scoresShape.rank().is_dynamic() || scoresShape.rank().get_length() < 2 ||
+        ngraph::normalize_axis(softmax.get(), axis, scoresShape.rank()) != static_cast<size_t>(scoresShape.rank().get_length() - 1) ||
+        !hasSingleConsumer(softmax))
+        return false;
+    // the dynamic sequences are fused, since the long ones are the reason to keep them dynamic
+    const auto& keyLength = scoresShape[scoresShape.rank().get_length() - 1];
+    if (keyLength.is_static() && keyLength.get_length() < minKeyLength)
+        return false;
+
+    const auto pv = ngraph::as_type_ptr<ngraph::opset1::MatMul>(softmax->get_output_target_inputs(0).begin()->get_node()->shared_from_this());
+    if (!pv || pv->get_input_node_shared_ptr(0) != softmax || pv->get_transpose_a() || pv->get_transpose_b())
+        return false;
+
+    ngraph::NodeVector fusedNodes{softmax, pv};
+    auto scores = softmax->get_input_node_shared_ptr(0);
+
+    std::shared_ptr<ngraph::Node> mask;
+    if (ngraph::is_type<ngraph::opset1::Add>(scores) && hasSingleConsumer(scores)) {
+        // the scores are the input produced by MatMul or by the scaling of its output, the mask may be computed by Multiply too
+        const auto isScores = [](const std::shared_ptr<ngraph::Node>& node) {
+            if (ngraph::is_type<ngraph::opset1::MatMul>(node))
+                return true;
+            if (!ngraph::is_type<ngraph::opset1::Multiply>(node) && !ngraph::is_type<ngraph::opset1::Divide>(node))
+                return false;
+            return ngraph::is_type<ngraph::opset1::MatMul>(node->get_input_node_ptr(0)) ||
+                   ngraph::is_type<ngraph::opset1::MatMul>(node->get_input_node_ptr(1));
+        };
+        const size_t scoresPort = isScores(scores->get_input_node_shared_ptr(0)) ? 0 : 1;
+        mask = scores->get_input_node_shared_ptr(1 - scoresPort);
+        if (!mask->get_output_element_type(0).is_real() || !isMaskBroadcastable(mask->get_output_partial_shape(0), scoresShape))
+            return false;
+        fusedNodes.push_back(scores);
+        scores = scores->get_input_node_shared_ptr(scoresPort);
+    }
+
+    float scale = 1.f;
+    if ((ngraph::is_type<ngraph::opset1::Multiply>(scores) || ngraph::is_type<ngraph::opset1::Divide>(scores)) && hasSingleConsumer(scores)) {
+        const bool isDivide = ngraph::is_type<ngraph::opset1::Divide>(scores);
+        size_t dataPort = 0;
+        if (!getScalar(scores->get_input_node_shared_ptr(1), scale)) {
+            if (isDivide || !getScalar(scores->get_input_node_shared_ptr(0), scale))
+                return false;
+            dataPort = 1;
+        }
+        if (isDivide) {
+            if (scale == 0.f)
+                return false;
+            scale = 1.f / scale;
+        }
+        fusedNodes.push_back(scores);
+        scores = scores->get_input_node_shared_ptr(dataPort);
+    }
+
+    const auto qk = ngraph::as_type_ptr<ngraph::opset1::MatMul>(scores);
+    if (!qk || qk->get_transpose_a() || !hasSingleConsumer(qk) || qk->get_output_partial_shape(0).rank() != scoresShape.rank())
+        return false;
+    fusedNodes.push_back(qk);
+
+    ngraph::OutputVector inputs{qk->input_value(0), qk->input_value(1), pv->input_value(1)};
+    for (const auto& input : inputs) {
+        if (input.get_partial_shape().rank() != scoresShape.rank() || input.get_element_type() != pv->get_output_element_type(0))
+            return false;
+    }
+    if (!pv->get_output_element_type(0).is_real())
+        return false;
+
+    // the sliced causal mask is kept, since it may be broadcasted to the scores
+    const bool causal = mask && (isCausalMask(mask) || isSlicedCausalMask(mask));
+    if (mask && !isCausalMask(mask))
+        inputs.push_back(mask);
+
+    auto fused = std::make_shared<MKLDNNPlugin::MultiHeadAttentionNode>(inputs, scale, qk->get_transpose_b(), causal);
+    fused->set_friendly_name(pv->get_friendly_name());
+    ngraph::copy_runtime_info(fusedNodes, fused);
+    ngraph::replace_node(pv, fused);
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::FuseMultiHeadAttention::FuseMultiHeadAttention(int64_t minKeyLength) : minKeyLength(minKeyLength) {}
+
+bool MKLDNNPlugin::FuseMultiHeadAttention::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    bool rewritten = false;
+    for (const auto& node : f->get_ordered_ops()) {
+        rewritten |= fuseMultiHeadAttention(node, minKeyLength);
+    }
+    return rewritten;
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fuses the scaled dot-product attention subgraph
+ *
+ *   MatMul(Q, K) -> [Multiply/Divide by scalar constant] -> [Add(mask)] -> Softmax(last axis) -> MatMul(V)
+ *
+ * into a single MultiHeadAttentionNode, so the [..., Lq, Lk] attention scores are never materialized.
+ * A constant lower-triangular mask (0 on and below the diagonal, a large negative value above it) is recognized
+ * as the causal mask and is applied by the node without reading it. So is the StridedSlice of such a constant which
+ * takes its rows [E - Lq, E) and columns [0, E) for the dynamic sequences.
+ * Only the subgraphs with a dynamic key length or with at least minKeyLength keys are fused: the scores of the shorter
+ * sequences fit the cache and the separate oneDNN nodes compute them faster. The threshold is set by the internal
+ * CPU_MHA_MIN_KEY_LENGTH config key.
+ */
+class FuseMultiHeadAttention : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit FuseMultiHeadAttention(int64_t minKeyLength = 128);
+    bool run_on_model(const std::shared_ptr<ngraph::Function>& f) override;
+
+private:
+    int64_t minKeyLength;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,266 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fuse_preprocessing.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include "op/fused_color_convert.hpp"
+#include "op/fused_preprocess.hpp"
+#include "utils/general_utils.h"
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FusePreprocessing, "FusePreprocessing", 0);
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::FuseColorConversion, "FuseColorConversion", 0);
+
+namespace {
+
+constexpr size_t imageRank = 4;
+
+std::shared_ptr<ngraph::Node> getSingleConsumer(const ngraph::Output<ngraph::Node>& output) {
+    const auto consumers = output.get_target_inputs();
+    if (consumers.size() != 1)
+        return nullptr;
+    return consumers.begin()->get_node()->shared_from_this();
+}
+
+// Returns a value per channel for a constant which is either scalar or broadcasted along the channel axis only
+bool getChannelValues(const std::shared_ptr<ngraph::Node>& node, size_t channelAxis, size_t channels, std::vector<float>& values) {
+    const auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(node);
+    if (!constant || !constant->get_element_type().is_real())
+        return false;
+
+    const auto& shape = constant->get_shape();
+    if (shape.size() > imageRank)
+        return false;
+    if (ngraph::shape_size(shape) == 1) {
+        values.assign(channels, constant->cast_vector<float>()[0]);
+        return true;
+    }
+    for (size_t i = 0; i < shape.size(); i++) {
+        const auto axis = imageRank - shape.size() + i;
+        if (shape[i] != (axis == channelAxis ? channels : 1))
+            return false;
+    }
+    values = constant->cast_vector<float>();
+    return true;
+}
+
+struct PreprocessingChain {
+    size_t channels = 0;
+    bool isNHWC = true;
+    bool isResized = false;
+    std::vector<int64_t> outputSize;
+    ngraph::opset4::Interpolate::InterpolateAttrs interpAttrs;
+    std::vector<float> scale;
+    std::vector<float> shift;
+
+    size_t channelAxis() const { return isNHWC ? 3 : 1; }
+
+    bool addInterpolate(const std::shared_ptr<ngraph::opset4::Interpolate>& interp) {
+        if (isResized || interp->get_output_partial_shape(0).is_dynamic())
+            return false;
+        const auto& attrs = interp->get_attrs();
+        const auto isZero = [](size_t value) { return value == 0; };
+        // the coordinates are computed from the input and output sizes, explicit scales may differ from them
+        if (attrs.antialias || attrs.shape_calculation_mode != ngraph::opset4::Interpolate::ShapeCalcMode::SIZES ||
+            !std::all_of(attrs.pads_begin.begin(), attrs.pads_begin.end(), isZero) ||
+            !std::all_of(attrs.pads_end.begin(), attrs.pads_end.end(), isZero) ||
+            !MKLDNNPlugin::one_of(attrs.mode, ngraph::opset4::Interpolate::InterpolateMode::NEAREST,
+                                              ngraph::opset4::Interpolate::InterpolateMode::LINEAR,
+                                              ngraph::opset4::Interpolate::InterpolateMode::LINEAR_ONNX))
+            return false;
+
+        // only the spatial dimensions can be resized
+        const auto& inShape = interp->get_input_shape(0);
+        const auto& outShape = interp->get_output_shape(0);
+        const size_t hAxis = isNHWC ? 1 : 2;
+        const size_t wAxis = isNHWC ? 2 : 3;
+        for (size_t i = 0; i < imageRank; i++) {
+            if (i != hAxis && i != wAxis && inShape[i] != outShape[i])
+                return false;
+        }
+        isResized = true;
+        interpAttrs = attrs;
+        outputSize = {static_cast<int64_t>(outShape[hAxis]), static_cast<int64_t>(outShape[wAxis])};
+        return true;
+    }
+
+    bool addTranspose(const std::shared_ptr<ngraph::opset1::Transpose>& transpose) {
+        const auto order = ngraph::as_type_ptr<ngraph::opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+        if (!isNHWC || !order || order->cast_vector<int64_t>() != std::vector<int64_t>{0, 3, 1, 2})
+            return false;
+        isNHWC = false;
+        return true;
+    }
+
+    bool addEltwise(const std::shared_ptr<ngraph::Node>& eltwise, const ngraph::Output<ngraph::Node>& data) {
+        if (eltwise->get_input_size() != 2 || eltwise->get_output_partial_shape(0) != data.get_partial_shape())
+            return false;
+        const size_t dataPort = eltwise->get_input_source_output(0) == data ? 0 : 1;
+        std::vector<float> values;
+        if (!getChannelValues(eltwise->get_input_node_shared_ptr(1 - dataPort), channelAxis(), channels, values))
+            return false;
+
+        // keep the composition as y = x * scale + shift
+        if (ngraph::is_type<ngraph::opset1::Add>(eltwise)) {
+            for (size_t c = 0; c < channels; c++)
+                shift[c] += values[c];
+        } else if (ngraph::is_type<ngraph::opset1::Subtract>(eltwise)) {
+            for (size_t c = 0; c < channels; c++) {
+                if (dataPort == 0) {
+                    shift[c] -= values[c];
+                } else {
+                    scale[c] = -scale[c];
+                    shift[c] = values[c] - shift[c];
+                }
+            }
+        } else if (ngraph::is_type<ngraph::opset1::Multiply>(eltwise)) {
+            for (size_t c = 0; c < channels; c++) {
+                scale[c] *= values[c];
+                shift[c] *= values[c];
+            }
+        } else if (ngraph::is_type<ngraph::opset1::Divide>(eltwise)) {
+            if (dataPort != 0 || std::any_of(values.begin(), values.end(), [](float v) { return v == 0.f; }))
+                return false;
+            for (size_t c = 0; c < channels; c++) {
+                scale[c] /= values[c];
+                shift[c] /= values[c];
+            }
+        } else {
+            return false;
+        }
+        return true;
+    }
+};
+
+// Walks the single consumer chain following the Convert and stops at the last node for which the chain state is accepted
+// by isValidEnd. On success the chain holds that state and fusedNodes - the Convert and the matched nodes in order.
+bool matchChain(const std::shared_ptr<ngraph::Node>& convert, PreprocessingChain& chain, bool allowResize,
+                const std::function<bool(const PreprocessingChain&)>& isValidEnd, ngraph::NodeVector& fusedNodes) {
+    ngraph::NodeVector nodes{convert};
+    ngraph::Output<ngraph::Node> output = convert->output(0);
+    auto state = chain;
+    bool matched = isValidEnd(state);
+    if (matched)
+        fusedNodes = nodes;
+
+    while (auto next = getSingleConsumer(output)) {
+        if (next->get_output_size() != 1 || next->get_output_element_type(0) != ngraph::element::f32)
+            break;
+        bool added = false;
+        if (auto interp = ngraph::as_type_ptr<ngraph::opset4::Interpolate>(next)) {
+            added = allowResize && next->get_input_source_output(0) == output && state.addInterpolate(interp);
+        } else if (auto transpose = ngraph::as_type_ptr<ngraph::opset1::Transpose>(next)) {
+            added = state.addTranspose(transpose);
+        } else {
+            added = state.addEltwise(next, output);
+        }
+        if (!added)
+            break;
+
+        nodes.push_back(next);
+        output = next->output(0);
+        if (isValidEnd(state)) {
+            matched = true;
+            chain = state;
+            fusedNodes = nodes;
+        }
+    }
+    return matched;
+}
+
+bool fusePreprocessing(const std::shared_ptr<ngraph::opset1::Parameter>& param) {
+    if (param->get_element_type() != ngraph::element::u8 || param->get_output_partial_shape(0).is_dynamic() ||
+        param->get_output_shape(0).size() != imageRank)
+        return false;
+
+    const auto convert = ngraph::as_type_ptr<ngraph::opset1::Convert>(getSingleConsumer(param->output(0)));
+    if (!convert || convert->get_destination_type() != ngraph::element::f32)
+        return false;
+
+    const auto& inShape = param->get_output_shape(0);
+    PreprocessingChain chain;
+    chain.channels = inShape[3];
+    chain.outputSize = {static_cast<int64_t>(inShape[1]), static_cast<int64_t>(inShape[2])};
+    chain.interpAttrs.mode = ngraph::opset4::Interpolate::InterpolateMode::NEAREST;
+    chain.scale.assign(chain.channels, 1.f);
+    chain.shift.assign(chain.channels, 0.f);
+
+    ngraph::NodeVector fusedNodes;
+    // the fused node produces NCHW output only
+    if (!matchChain(convert, chain, true, [](const PreprocessingChain& state) { return !state.isNHWC; }, fusedNodes))
+        return false;
+
+    const auto lastNode = fusedNodes.back();
+    const auto& attrs = chain.interpAttrs;
+    auto fused = std::make_shared<MKLDNNPlugin::FusedPreprocessNode>(param->output(0), chain.outputSize, attrs.mode,
+                                                                     attrs.coordinate_transformation_mode, attrs.nearest_mode,
+                                                                     chain.scale, chain.shift, ngraph::element::f32);
+    fused->set_friendly_name(lastNode->get_friendly_name());
+    ngraph::copy_runtime_info(fusedNodes, fused);
+    ngraph::replace_node(lastNode, fused);
+    return true;
+}
+
+bool fuseColorConversion(const std::shared_ptr<ngraph::Node>& node) {
+    bool isI420 = false, isBGR = false;
+    if (ngraph::is_type<ngraph::opset8::NV12toRGB>(node)) {
+    } else if (ngraph::is_type<ngraph::opset8::NV12toBGR>(node)) {
+        isBGR = true;
+    } else if (ngraph::is_type<ngraph::opset8::I420toRGB>(node)) {
+        isI420 = true;
+    } else if (ngraph::is_type<ngraph::opset8::I420toBGR>(node)) {
+        isI420 = isBGR = true;
+    } else {
+        return false;
+    }
+    if (node->get_element_type() != ngraph::element::u8 || node->get_output_partial_shape(0).is_dynamic())
+        return false;
+
+    const auto convert = ngraph::as_type_ptr<ngraph::opset1::Convert>(getSingleConsumer(node->output(0)));
+    if (!convert || convert->get_destination_type() != ngraph::element::f32)
+        return false;
+
+    PreprocessingChain chain;
+    chain.channels = 3;
+    chain.scale.assign(chain.channels, 1.f);
+    chain.shift.assign(chain.channels, 0.f);
+
+    // both the interleaved and the planar output are supported, the resize is left to Interpolate
+    ngraph::NodeVector fusedNodes;
+    if (!matchChain(convert, chain, false, [](const PreprocessingChain&) { return true; }, fusedNodes))
+        return false;
+
+    const auto lastNode = fusedNodes.back();
+    fusedNodes.insert(fusedNodes.begin(), node);
+    auto fused = std::make_shared<MKLDNNPlugin::FusedColorConvertNode>(node->input_values(), isI420, isBGR, !chain.isNHWC,
+                                                                       chain.scale, chain.shift, ngraph::element::f32);
+    fused->set_friendly_name(lastNode->get_friendly_name());
+    ngraph::copy_runtime_info(fusedNodes, fused);
+    ngraph::replace_node(lastNode, fused);
+    return true;
+}
+
+}  // namespace
+
+bool MKLDNNPlugin::FuseColorConversion::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    bool rewritten = false;
+    for (const auto& node : f->get_ordered_ops()) {
+        rewritten |= fuseColorConversion(node);
+    }
+    return rewritten;
+}
+
+bool MKLDNNPlugin::FusePreprocessing::run_on_model(const std::shared_ptr<ngraph::Function>& f) {
+    bool rewritten = false;
+    for (const auto& param : f->get_parameters()) {
+        rewritten |= fusePreprocessing(param);
+    }
+    return rewritten;
+}
@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Fuses the image preprocessing subgraph produced by ov::preprocess::PrePostProcessor for U8 NHWC input:
+ *
+ *   Parameter(U8, NHWC) -> Convert(f32) -> [Interpolate] -> [Add/Subtract/Multiply/Divide by constants] -> Transpose(NHWC->NCHW)
+ *
+ * where resize, mean/scale and layout conversion steps may go in any order, into a single FusedPreprocessNode.
+ */
+class FusePreprocessing : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_model(const std::shared_ptr<ngraph::Function>& f) override;
+};
+
+/**
+ * Fuses NV12toRGB/NV12toBGR/I420toRGB/I420toBGR with U8 input and the following
+ *
+ *   Convert(f32) -> [Add/Subtract/Multiply/Divide by constants] -> [Transpose(NHWC->NCHW)]
+ *
+ * into a single FusedColorConvertNode, so the decoded frame is converted straight into the normalized model input.
+ */
+class FuseColorConversion : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_model(const std::shared_ptr<ngraph::Function>& f) override;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,57 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_color_convert.hpp"
+
+MKLDNNPlugin::FusedColorConvertNode::FusedColorConvertNode(const ngraph::OutputVector &planes,
+                                                           bool is_i420,
+                                                           bool is_bgr,
+                                                           bool is_planar,
+                                                           const std::vector<float> &scale,
+                                                           const std::vector<float> &shift,
+                                                           const ngraph::element::Type output_type)
+    : Op(planes), m_is_i420(is_i420), m_is_bgr(is_bgr), m_is_planar(is_planar), m_scale(scale), m_shift(shift),
+      m_output_type(output_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::FusedColorConvertNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::FusedColorConvertNode>(new_args, m_is_i420, m_is_bgr, m_is_planar, m_scale, m_shift, m_output_type);
+}
+
+void MKLDNNPlugin::FusedColorConvertNode::validate_and_infer_types() {
+    const auto planes = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        planes == 1 || planes == (m_is_i420 ? 3 : 2),
+        "Unexpected number of input planes: ", planes);
+    NODE_VALIDATION_CHECK(this,
+        m_scale.size() == 3 && m_shift.size() == 3,
+        "Scale and shift must have a value per channel");
+
+    const auto y_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+        y_shape.rank().is_static() && y_shape.rank().get_length() == 4,
+        "Y plane must be 4D tensor in NHWC layout, got: ", y_shape);
+
+    // single plane image keeps the chroma planes below the luma, the image height is 2/3 of the plane height
+    auto height = y_shape[1];
+    if (planes == 1 && height.is_static())
+        height = height.get_length() * 2 / 3;
+    const auto width = y_shape[2];
+
+    const ngraph::PartialShape output_shape = m_is_planar ? ngraph::PartialShape{y_shape[0], 3, height, width}
+                                                          : ngraph::PartialShape{y_shape[0], height, width, 3};
+    set_output_type(0, m_output_type, output_shape);
+}
+
+bool MKLDNNPlugin::FusedColorConvertNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("is_i420", m_is_i420);
+    visitor.on_attribute("is_bgr", m_is_bgr);
+    visitor.on_attribute("is_planar", m_is_planar);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("shift", m_shift);
+    visitor.on_attribute("out-type", m_output_type);
+    return true;
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * NV12/I420 to RGB/BGR color conversion fused with the following Convert to floating point type, per-channel
+ * affine transformation (x * scale + shift) and optional conversion of the interleaved NHWC output to planar NCHW.
+ * Takes the same inputs as NV12toRGB (1 or 2 planes) or I420toRGB (1 or 3 planes) operations.
+ */
+class FusedColorConvertNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("FusedColorConvert", "cpu_plugin_opset");
+
+    FusedColorConvertNode() = default;
+
+    FusedColorConvertNode(const ngraph::OutputVector &planes,
+                          bool is_i420,
+                          bool is_bgr,
+                          bool is_planar,
+                          const std::vector<float> &scale,
+                          const std::vector<float> &shift,
+                          const ngraph::element::Type output_type = ngraph::element::f32);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    bool is_i420() const { return m_is_i420; }
+    bool is_bgr() const { return m_is_bgr; }
+    bool is_planar() const { return m_is_planar; }
+    const std::vector<float>& get_scale() const { return m_scale; }
+    const std::vector<float>& get_shift() const { return m_shift; }
+    ngraph::element::Type get_output_type() const { return m_output_type; }
+
+private:
+    bool m_is_i420 = false;
+    bool m_is_bgr = false;
+    bool m_is_planar = false;
+    std::vector<float> m_scale;
+    std::vector<float> m_shift;
+    ngraph::element::Type m_output_type;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,53 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_preprocess.hpp"
+
+MKLDNNPlugin::FusedPreprocessNode::FusedPreprocessNode(const ngraph::Output<Node> &data,
+                                                       const std::vector<int64_t> &output_size,
+                                                       InterpolateMode mode,
+                                                       CoordinateTransformMode coordinate_transformation_mode,
+                                                       NearestMode nearest_mode,
+                                                       const std::vector<float> &scale,
+                                                       const std::vector<float> &shift,
+                                                       const ngraph::element::Type output_type)
+    : Op({data}), m_output_size(output_size), m_mode(mode), m_coordinate_transformation_mode(coordinate_transformation_mode),
+      m_nearest_mode(nearest_mode), m_scale(scale), m_shift(shift), m_output_type(output_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::FusedPreprocessNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::FusedPreprocessNode>(new_args.at(0), m_output_size, m_mode, m_coordinate_transformation_mode,
+                                                               m_nearest_mode, m_scale, m_shift, m_output_type);
+}
+
+void MKLDNNPlugin::FusedPreprocessNode::validate_and_infer_types() {
+    const auto input_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+        input_shape.rank().is_static() && input_shape.rank().get_length() == 4,
+        "Input must be 4D tensor in NHWC layout, got: ", input_shape);
+    NODE_VALIDATION_CHECK(this,
+        m_output_size.size() == 2,
+        "Output size must contain height and width");
+
+    const auto channels = input_shape[3];
+    NODE_VALIDATION_CHECK(this,
+        channels.is_dynamic() || (m_scale.size() == static_cast<size_t>(channels.get_length()) && m_shift.size() == m_scale.size()),
+        "Scale and shift must have a value per channel");
+
+    ngraph::PartialShape output_shape{input_shape[0], channels, m_output_size[0], m_output_size[1]};
+    set_output_type(0, m_output_type, output_shape);
+}
+
+bool MKLDNNPlugin::FusedPreprocessNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("output_size", m_output_size);
+    visitor.on_attribute("mode", m_mode);
+    visitor.on_attribute("coordinate_transformation_mode", m_coordinate_transformation_mode);
+    visitor.on_attribute("nearest_mode", m_nearest_mode);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("shift", m_shift);
+    visitor.on_attribute("out-type", m_output_type);
+    return true;
+}
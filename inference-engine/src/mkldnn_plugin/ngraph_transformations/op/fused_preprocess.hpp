@@ -0,0 +1,60 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+#include <ngraph/opsets/opset4.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Image preprocessing fused into a single op: takes U8 image in NHWC layout, resizes it to the output spatial size,
+ * applies per-channel affine transformation (x * scale + shift, which covers mean and scale steps) and produces
+ * the output in NCHW layout.
+ */
+class FusedPreprocessNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("FusedPreprocess", "cpu_plugin_opset");
+
+    using InterpolateMode = ngraph::opset4::Interpolate::InterpolateMode;
+    using CoordinateTransformMode = ngraph::opset4::Interpolate::CoordinateTransformMode;
+    using NearestMode = ngraph::opset4::Interpolate::NearestMode;
+
+    FusedPreprocessNode() = default;
+
+    FusedPreprocessNode(const ngraph::Output<Node> &data,
+                        const std::vector<int64_t> &output_size,
+                        InterpolateMode mode,
+                        CoordinateTransformMode coordinate_transformation_mode,
+                        NearestMode nearest_mode,
+                        const std::vector<float> &scale,
+                        const std::vector<float> &shift,
+                        const ngraph::element::Type output_type = ngraph::element::f32);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    const std::vector<int64_t>& get_output_size() const { return m_output_size; }
+    InterpolateMode get_mode() const { return m_mode; }
+    CoordinateTransformMode get_coordinate_transformation_mode() const { return m_coordinate_transformation_mode; }
+    NearestMode get_nearest_mode() const { return m_nearest_mode; }
+    const std::vector<float>& get_scale() const { return m_scale; }
+    const std::vector<float>& get_shift() const { return m_shift; }
+    ngraph::element::Type get_output_type() const { return m_output_type; }
+
+private:
+    std::vector<int64_t> m_output_size;
+    InterpolateMode m_mode = InterpolateMode::NEAREST;
+    CoordinateTransformMode m_coordinate_transformation_mode = CoordinateTransformMode::HALF_PIXEL;
+    NearestMode m_nearest_mode = NearestMode::ROUND_PREFER_FLOOR;
+    std::vector<float> m_scale;
+    std::vector<float> m_shift;
+    ngraph::element::Type m_output_type;
+};
+
+}  // namespace MKLDNNPlugin
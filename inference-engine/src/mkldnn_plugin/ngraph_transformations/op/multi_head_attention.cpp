@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_head_attention.hpp"
+
+MKLDNNPlugin::MultiHeadAttentionNode::MultiHeadAttentionNode(const ngraph::OutputVector& args, float scale, bool transpose_k, bool causal)
+    : Op(args), m_scale(scale), m_transpose_k(transpose_k), m_causal(causal) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::MultiHeadAttentionNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::MultiHeadAttentionNode>(new_args, m_scale, m_transpose_k, m_causal);
+}
+
+void MKLDNNPlugin::MultiHeadAttentionNode::validate_and_infer_types() {
+    const auto inputs = get_input_size();
+    NODE_VALIDATION_CHECK(this, inputs == 3 || inputs == 4, "Expects Q, K, V and an optional mask inputs, got: ", inputs);
+
+    const auto& q = get_input_partial_shape(0);
+    const auto& k = get_input_partial_shape(1);
+    const auto& v = get_input_partial_shape(2);
+    NODE_VALIDATION_CHECK(this,
+        q.rank().is_static() && k.rank() == q.rank() && v.rank() == q.rank() && q.rank().get_length() >= 2,
+        "Q, K and V must have the same static rank of at least 2, got: ", q, ", ", k, ", ", v);
+
+    const auto rank = q.rank().get_length();
+    const auto keyLength = m_transpose_k ? k[rank - 2] : k[rank - 1];
+    const auto keySize = m_transpose_k ? k[rank - 1] : k[rank - 2];
+    NODE_VALIDATION_CHECK(this,
+        q[rank - 1].compatible(keySize) && keyLength.compatible(v[rank - 2]),
+        "Q, K and V have incompatible shapes: ", q, ", ", k, ", ", v);
+
+    ngraph::PartialShape output_shape(std::vector<ngraph::Dimension>(q.begin(), q.end() - 2));
+    for (const auto& shape : {k, v}) {
+        NODE_VALIDATION_CHECK(this,
+            ngraph::PartialShape::broadcast_merge_into(output_shape,
+                                                       ngraph::PartialShape(std::vector<ngraph::Dimension>(shape.begin(), shape.end() - 2)),
+                                                       ngraph::op::AutoBroadcastType::NUMPY),
+            "Batch dimensions of Q, K and V can't be broadcasted: ", q, ", ", k, ", ", v);
+    }
+    output_shape.push_back(q[rank - 2]);
+    output_shape.push_back(v[rank - 1]);
+
+    if (inputs == 4) {
+        const auto& mask = get_input_partial_shape(3);
+        NODE_VALIDATION_CHECK(this,
+            mask.rank().is_dynamic() || mask.rank().get_length() <= rank,
+            "Mask rank must not exceed the rank of Q, got: ", mask);
+    }
+
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+bool MKLDNNPlugin::MultiHeadAttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    visitor.on_attribute("causal", m_causal);
+    return true;
+}
@@ -0,0 +1,45 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Scaled dot-product attention fused into a single op:
+ *
+ *   output = softmax(scale * Q x K^T + mask) x V
+ *
+ * Inputs: Q [..., Lq, D], K [..., Lk, D] (or [..., D, Lk] if transpose_k is false), V [..., Lk, Dv] and an optional
+ * additive mask broadcastable to [..., Lq, Lk]. The leading dimensions follow the numpy broadcasting rules.
+ * If causal is set, the query i attends only to the keys j <= i + Lk - Lq. The mask of the causal op is the [..., Lq, Lk]
+ * slice of a causal mask, it's read only if its query or key dimension is broadcasted.
+ */
+class MultiHeadAttentionNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("MultiHeadAttention", "cpu_plugin_opset");
+
+    MultiHeadAttentionNode() = default;
+
+    MultiHeadAttentionNode(const ngraph::OutputVector& args, float scale, bool transpose_k, bool causal);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_transpose_k() const { return m_transpose_k; }
+    bool get_causal() const { return m_causal; }
+
+private:
+    float m_scale = 1.f;
+    bool m_transpose_k = true;
+    bool m_causal = false;
+};
+
+}  // namespace MKLDNNPlugin
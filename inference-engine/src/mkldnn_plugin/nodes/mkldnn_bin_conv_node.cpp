@@ -20,6 +20,7 @@
 #include "utils/general_utils.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "utils/cpu_utils.hpp"
+#include <memory_desc/cpu_memory_desc_utils.h>
 
 // WA for xbyak.h
 #ifdef _WIN32
@@ -875,16 +876,25 @@ private:
 
 bool MKLDNNBinaryConvolutionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         const auto binConv = std::dynamic_pointer_cast<const ngraph::opset1::BinaryConvolution>(op);
         if (!binConv) {
             errorMessage = "Only opset1 BinaryConvolution operation is supported";
             return false;
         }
+        if (isDynamicNgraphNode(op)) {
+            // only the batch and the spatial dimensions may be dynamic
+            const auto& dataShape = op->get_input_partial_shape(0);
+            const auto& outShape = op->get_output_partial_shape(0);
+            if (dataShape.rank().is_dynamic() || dataShape[1].is_dynamic() ||
+                    outShape.rank().is_dynamic() || outShape[1].is_dynamic()) {
+                errorMessage = "Doesn't support dynamic rank or dynamic number of channels";
+                return false;
+            }
+            if (op->get_input_partial_shape(1).is_dynamic()) {
+                errorMessage = "Doesn't support dynamic weights shape";
+                return false;
+            }
+        }
         if (binConv->get_mode() != ngraph::op::v1::BinaryConvolution::BinaryConvolutionMode::XNOR_POPCOUNT) {
             errorMessage = "Doesn't support mode: " + ngraph::as_string(binConv->get_mode());
             return false;
@@ -912,6 +922,7 @@ MKLDNNBinaryConvolutionNode::MKLDNNBinaryConvolutionNode(const std::shared_ptr<n
         }
         paddingL = binConv->get_pads_begin();
         paddingR = binConv->get_pads_end();
+        autoPadding = one_of(binConv->get_auto_pad(), ov::op::PadType::SAME_UPPER, ov::op::PadType::SAME_LOWER);
 
         if (mayiuse(x64::avx512_common)) {
             implType = impl_desc_type::jit_avx512;
@@ -1017,6 +1028,24 @@ void MKLDNNBinaryConvolutionNode::initSupportedPrimitiveDescriptors() {
 }
 
 void MKLDNNBinaryConvolutionNode::createPrimitive() {
+    if (inputShapesDefined()) {
+        if (needPrepareParams())
+            prepareParams();
+        updateLastInputDims();
+    }
+}
+
+void MKLDNNBinaryConvolutionNode::updatePadding() {
+    //update padding. TODO [DS] : rewrite when the final shape inference interface is available
+    if (isDynamicNode() && autoPadding) {
+        if (auto binConv = ov::as_type_ptr<ngraph::opset1::BinaryConvolution>(opToShapeInfer)) {
+            paddingL = binConv->get_pads_begin();
+            paddingR = binConv->get_pads_end();
+        }
+    }
+}
+
+void MKLDNNBinaryConvolutionNode::prepareParams() {
     auto selectedPrimitiveDescriptor = getSelectedPrimitiveDescriptor();
     if (!selectedPrimitiveDescriptor)
         IE_THROW() << "CPU binary convolution with name '" << getName() << "' doesn't have primitive descriptors.";
@@ -1027,6 +1056,8 @@ void MKLDNNBinaryConvolutionNode::createPrimitive() {
 
     auto implType = selectedPrimitiveDescriptor->getImplementationType();
 
+    updatePadding();
+
     jcp.ngroups = group;
     jcp.mb = srcDims[0];
 
@@ -1092,6 +1123,18 @@ void MKLDNNBinaryConvolutionNode::createPrimitive() {
     if (!args_ok)
         IE_THROW() << "BinaryConvolution with name '" << getName() << "' has unsupported parameters";
 
+    // the kernel depends on the spatial dimensions and the paddings only, so it's shared by the different batches
+    const VectorDims key{srcDims[2], srcDims[3], dstDims[2], dstDims[3],
+                         static_cast<size_t>(jcp.t_pad), static_cast<size_t>(jcp.b_pad), static_cast<size_t>(jcp.l_pad)};
+    for (auto it = kernelsCache.begin(); it != kernelsCache.end(); ++it) {
+        if (it->first == key) {
+            kernelsCache.splice(kernelsCache.begin(), kernelsCache, it);
+            bin_conv_kernel = it->second;
+            return;
+        }
+    }
+
+    bin_conv_kernel.reset();
     if (implType == impl_desc_type::jit_avx512) {
         bin_conv_kernel.reset(new jit_uni_bin_conv_kernel_f32<x64::avx512_common>(jcp, jcp_dw_conv, *attr.get()));
     } else if (implType == impl_desc_type::jit_avx2) {
@@ -1099,8 +1142,16 @@ void MKLDNNBinaryConvolutionNode::createPrimitive() {
     } else if (implType == impl_desc_type::sse42) {
         bin_conv_kernel.reset(new jit_uni_bin_conv_kernel_f32<x64::sse41>(jcp, jcp_dw_conv, *attr.get()));
     }
-    if (bin_conv_kernel)
+    if (bin_conv_kernel) {
         bin_conv_kernel->create_ker();
+        kernelsCache.emplace_front(key, bin_conv_kernel);
+        if (kernelsCache.size() > kernelsCacheCapacity)
+            kernelsCache.pop_back();
+    }
+}
+
+void MKLDNNBinaryConvolutionNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
 }
 
 bool MKLDNNBinaryConvolutionNode::canFuse(const MKLDNNNodePtr& node) const {
@@ -1133,14 +1184,14 @@ void MKLDNNBinaryConvolutionNode::setPostOps(mkldnn::primitive_attr &attr) {
             } else {
                 // TODO [DS]: change to shape from memory
                 constexpr int align = 16;
-                eltwiseNode->appendPostOps(ops, getOutputShapeAtPort(0).getStaticDims(), align);
+                eltwiseNode->appendPostOps(ops, MemoryDescUtils::makeDummyShape(getOutputShapeAtPort(0)).getStaticDims(), align);
             }
             continue;
         }
 
         auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode *>(node.get());
         if (fakeQuantizeNode) {
-            fakeQuantizeNode->appendPostOps(ops, getOutputShapeAtPort(0).getStaticDims());
+            fakeQuantizeNode->appendPostOps(ops, MemoryDescUtils::makeDummyShape(getOutputShapeAtPort(0)).getStaticDims());
             continue;
         }
 
@@ -6,8 +6,10 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <list>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -84,6 +86,10 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
     void setPostOps(mkldnn::primitive_attr &attr);
     bool canFuse(const MKLDNNNodePtr& node) const override;
 
@@ -102,15 +108,22 @@ private:
     std::vector<ptrdiff_t> dilation;
     std::vector<ptrdiff_t> paddingL;
     std::vector<ptrdiff_t> paddingR;
+    bool autoPadding = false;
 
     jit_bin_conv_params jcp = {};
     jit_dw_conv_params jcp_dw_conv = {};
     std::shared_ptr<jit_uni_bin_conv_kernel> bin_conv_kernel = nullptr;
 
+    /** Kernels by the input and output spatial dimensions and the paddings, the most recently used first */
+    std::list<std::pair<VectorDims, std::shared_ptr<jit_uni_bin_conv_kernel>>> kernelsCache;
+    static const size_t kernelsCacheCapacity = 16;
+
     mkldnn::primitive_attr attr;
 
     impl_desc_type implType = impl_desc_type::ref;
 
+    void updatePadding();
+
     void executeOptimized(const uint8_t* src, const uint8_t* weights, uint8_t* dst,
                           const std::vector<size_t>& s_str, const std::vector<size_t>& w_str, const std::vector<size_t>& d_str);
     void executeReference(const uint8_t* src, const uint8_t* weights, uint8_t* dst,
@@ -0,0 +1,492 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
+#include <mkldnn_extension_utils.h>
+#include <cpu/x64/jit_generator.hpp>
+#include <ngraph/opsets/opset8.hpp>
+
+#include "mkldnn_color_convert_node.h"
+#include "ngraph_transformations/op/fused_color_convert.hpp"
+#include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace {
+// number of the pixels of the row converted at once, the R, G and B rows of the tile stay in L1
+constexpr size_t tileSize = 64lu;
+}  // namespace
+
+#define GET_OFF(field) offsetof(jit_color_convert_call_args, field)
+
+// converts a row of U8 pixels into the R, G and B rows: the luma is loaded contiguously, the chroma samples shared by
+// the pairs of pixels are gathered, the results are rounded and clipped like the reference code, then scaled and shifted
+template <cpu_isa_t isa>
+struct jit_uni_color_convert_kernel_f32 : public jit_uni_color_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_color_convert_kernel_f32)
+
+    explicit jit_uni_color_convert_kernel_f32(jit_color_convert_config_params jcp) : jit_uni_color_convert_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_y, ptr[reg_params + GET_OFF(y)]);
+        mov(reg_u, ptr[reg_params + GET_OFF(u)]);
+        mov(reg_v, ptr[reg_params + GET_OFF(v)]);
+        mov(reg_dst_r, ptr[reg_params + GET_OFF(dst_r)]);
+        mov(reg_dst_g, ptr[reg_params + GET_OFF(dst_g)]);
+        mov(reg_dst_b, ptr[reg_params + GET_OFF(dst_b)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_table, l_table);
+
+        uni_vmovups(vmm_uv_offsets, table_val(uv_offsets));
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(main_loop_end_label, T_NEAR);
+
+            uni_vpmovzxbd(vmm_y, ptr[reg_y]);
+            uni_vcvtdq2ps(vmm_y, vmm_y);
+            gather_u8(vmm_d, reg_u);
+            gather_u8(vmm_e, reg_v);
+
+            // c = 1.164 * (y - 16), d = u - 128, e = v - 128
+            uni_vsubps(vmm_y, vmm_y, table_val(luma_shift));
+            uni_vmulps(vmm_y, vmm_y, table_val(luma_coeff));
+            uni_vsubps(vmm_d, vmm_d, table_val(chroma_shift));
+            uni_vsubps(vmm_e, vmm_e, table_val(chroma_shift));
+
+            // r = c + 1.596 * e
+            uni_vmulps(vmm_tmp, vmm_e, table_val(r_e_coeff));
+            uni_vaddps(vmm_res, vmm_y, vmm_tmp);
+            store_channel(reg_dst_r, 0);
+            // g = c - 0.391 * d - 0.813 * e
+            uni_vmulps(vmm_tmp, vmm_d, table_val(g_d_coeff));
+            uni_vsubps(vmm_res, vmm_y, vmm_tmp);
+            uni_vmulps(vmm_tmp, vmm_e, table_val(g_e_coeff));
+            uni_vsubps(vmm_res, vmm_res, vmm_tmp);
+            store_channel(reg_dst_g, 1);
+            // b = c + 2.018 * d
+            uni_vmulps(vmm_tmp, vmm_d, table_val(b_d_coeff));
+            uni_vaddps(vmm_res, vmm_y, vmm_tmp);
+            store_channel(reg_dst_b, 2);
+
+            add(reg_y, step);
+            add(reg_u, step / 2 * jcp_.uv_step);
+            add(reg_v, step / 2 * jcp_.uv_step);
+            add(reg_dst_r, step * sizeof(float));
+            add(reg_dst_g, step * sizeof(float));
+            add(reg_dst_b, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        this->postamble();
+
+        prepare_table();
+    }
+
+private:
+    using Vmm = typename utils::conditional<isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_y = r8;
+    Xbyak::Reg64 reg_u = r9;
+    Xbyak::Reg64 reg_v = r10;
+    Xbyak::Reg64 reg_dst_r = r11;
+    Xbyak::Reg64 reg_dst_g = r12;
+    Xbyak::Reg64 reg_dst_b = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_table = r15;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_uv_offsets = Vmm(0);
+    Vmm vmm_zero = Vmm(1);
+    Vmm vmm_y = Vmm(2);
+    Vmm vmm_d = Vmm(3);
+    Vmm vmm_e = Vmm(4);
+    Vmm vmm_tmp = Vmm(5);
+    Vmm vmm_res = Vmm(6);
+    Vmm vmm_mask = Vmm(7);
+
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    Xbyak::Label l_table;
+
+    enum {
+        byte_mask = 0,
+        half,
+        max_value,
+        luma_shift,
+        luma_coeff,
+        chroma_shift,
+        r_e_coeff,
+        g_d_coeff,
+        g_e_coeff,
+        b_d_coeff,
+        channel_scale,      // R, G, B
+        channel_shift = channel_scale + 3,
+        uv_offsets = channel_shift + 3
+    };
+
+    inline Xbyak::Address table_val(int index) {
+        return ptr[reg_table + index * vlen];
+    }
+
+    void prepare_table() {
+        const auto broadcast = [&](uint32_t value) {
+            for (int d = 0; d < step; ++d) {
+                dd(value);
+            }
+        };
+
+        align(64);
+        L(l_table);
+        broadcast(0xff);
+        broadcast(float2int(0.5f));
+        broadcast(float2int(255.f));
+        broadcast(float2int(16.f));
+        broadcast(float2int(1.164f));
+        broadcast(float2int(128.f));
+        broadcast(float2int(1.596f));
+        broadcast(float2int(0.391f));
+        broadcast(float2int(0.813f));
+        broadcast(float2int(2.018f));
+        for (int c = 0; c < 3; c++)
+            broadcast(float2int(jcp_.scale[c]));
+        for (int c = 0; c < 3; c++)
+            broadcast(float2int(jcp_.shift[c]));
+        // each chroma sample is shared by two neighbouring pixels
+        for (int d = 0; d < step; ++d) {
+            dd(static_cast<uint32_t>(d / 2 * jcp_.uv_step));
+        }
+    }
+
+    // gathers the dwords starting at the chroma samples and keeps their lowest bytes as FP32 values
+    void gather_u8(Vmm vmm_dst, const Xbyak::Reg64 &reg_src) {
+        if (isa == avx512_common) {
+            kxnorw(k_mask, k_mask, k_mask);
+            vpgatherdd(vmm_dst | k_mask, ptr[reg_src + vmm_uv_offsets]);
+            vpandd(vmm_dst, vmm_dst, table_val(byte_mask));
+        } else {
+            uni_vpcmpeqd(vmm_mask, vmm_mask, vmm_mask);
+            vpgatherdd(vmm_dst, ptr[reg_src + vmm_uv_offsets], vmm_mask);
+            vpand(vmm_dst, vmm_dst, table_val(byte_mask));
+        }
+        uni_vcvtdq2ps(vmm_dst, vmm_dst);
+    }
+
+    // rounds half away from zero and clips to [0, 255] (floor(x + 0.5) gives the same result on the clipped range),
+    // then applies the channel scale/shift
+    void store_channel(const Xbyak::Reg64 &reg_dst, int channel) {
+        uni_vaddps(vmm_res, vmm_res, table_val(half));
+        uni_vroundps(vmm_res, vmm_res, 1);
+        uni_vmaxps(vmm_res, vmm_res, vmm_zero);
+        uni_vminps(vmm_res, vmm_res, table_val(max_value));
+        uni_vmulps(vmm_res, vmm_res, table_val(channel_scale + channel));
+        uni_vaddps(vmm_res, vmm_res, table_val(channel_shift + channel));
+        uni_vmovups(ptr[reg_dst], vmm_res);
+    }
+};
+
+bool MKLDNNColorConvertNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!one_of(op->get_type_info(), ngraph::opset8::NV12toRGB::get_type_info_static(), ngraph::opset8::NV12toBGR::get_type_info_static(),
+                    ngraph::opset8::I420toRGB::get_type_info_static(), ngraph::opset8::I420toBGR::get_type_info_static(),
+                    FusedColorConvertNode::get_type_info_static())) {
+            errorMessage = "Only opset8 NV12toRGB, NV12toBGR, I420toRGB, I420toBGR and FusedColorConvert operations are supported";
+            return false;
+        }
+        const auto& inType = op->get_input_element_type(0);
+        if (inType != ngraph::element::u8 && !inType.is_real()) {
+            errorMessage = "Doesn't support input precision: " + inType.get_type_name();
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNColorConvertNode::MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ColorConvert layer with name '" + getName() + "'";
+    if (const auto fused = std::dynamic_pointer_cast<const FusedColorConvertNode>(op)) {
+        isFused = true;
+        isI420 = fused->is_i420();
+        isBGR = fused->is_bgr();
+        isPlanar = fused->is_planar();
+        scale = fused->get_scale();
+        shift = fused->get_shift();
+    } else {
+        isI420 = ngraph::is_type<ngraph::opset8::I420toRGB>(op) || ngraph::is_type<ngraph::opset8::I420toBGR>(op);
+        isBGR = ngraph::is_type<ngraph::opset8::NV12toBGR>(op) || ngraph::is_type<ngraph::opset8::I420toBGR>(op);
+    }
+
+    const auto planes = getOriginalInputsNumber();
+    if (planes != 1 && planes != (isI420 ? 3 : 2))
+        IE_THROW() << errorPrefix << " has incorrect number of input planes: " << planes;
+
+    const auto& dstDims = getOutputShapeAtPort(0).getStaticDims();
+    if (dstDims.size() != 4)
+        IE_THROW() << errorPrefix << " supports only 4D output";
+    N = dstDims[0];
+    H = isPlanar ? dstDims[2] : dstDims[1];
+    W = isPlanar ? dstDims[3] : dstDims[2];
+    if (H % 2 != 0 || W % 2 != 0)
+        IE_THROW() << errorPrefix << " supports only even image dimensions";
+}
+
+void MKLDNNColorConvertNode::getSupportedDescriptors() {
+    if (getChildEdges().empty())
+        IE_THROW() << errorPrefix << " has incorrect number of output edges";
+}
+
+void MKLDNNColorConvertNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    Precision inputPrec = getOriginalInputPrecisionAtPort(0);
+    if (inputPrec != Precision::U8)
+        inputPrec = Precision::FP32;
+
+    Precision outputPrec = inputPrec;
+    if (isFused) {
+        outputPrec = getOriginalOutputPrecisionAtPort(0);
+        if (outputPrec != Precision::BF16 || !mayiuse(avx512_core))
+            outputPrec = Precision::FP32;
+    }
+
+    // the planar output may be stored in the blocked layout the convolution following the preprocessing consumes
+    std::vector<LayoutType> outputLayouts;
+    if (isFused && isPlanar) {
+        if (mayiuse(avx512_common)) {
+            outputLayouts.push_back(LayoutType::nCsp16c);
+        } else if (mayiuse(sse41)) {
+            outputLayouts.push_back(LayoutType::nCsp8c);
+        }
+    }
+    outputLayouts.push_back(LayoutType::ncsp);
+
+    impl_desc_type implType = impl_desc_type::ref;
+    if (inputPrec == Precision::U8) {
+        if (mayiuse(avx512_common)) {
+            implType = impl_desc_type::jit_avx512;
+        } else if (mayiuse(avx2)) {
+            implType = impl_desc_type::jit_avx2;
+        }
+    }
+
+    std::vector<PortConfigurator> inPortConfigs(getOriginalInputsNumber(), {LayoutType::ncsp, inputPrec});
+    for (auto layout : outputLayouts) {
+        addSupportedPrimDesc(inPortConfigs,
+                             {{layout, outputPrec}},
+                             implType);
+    }
+}
+
+void MKLDNNColorConvertNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate destination memory";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            IE_THROW() << errorPrefix << " did not allocate input memory";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " has unidentified preferable primitive descriptor";
+
+    if (getParentEdgeAt(0)->getMemory().getDesc().getPrecision() != Precision::U8)
+        return;
+
+    jit_color_convert_config_params jcp;
+    jcp.uv_step = isI420 ? 1lu : 2lu;
+    const size_t rIdx = isBGR ? 2 : 0;
+    const size_t bIdx = isBGR ? 0 : 2;
+    const size_t channelIdx[3] = {rIdx, 1, bIdx};
+    for (size_t c = 0; c < 3; c++) {
+        jcp.scale[c] = isFused ? scale[channelIdx[c]] : 1.f;
+        jcp.shift[c] = isFused ? shift[channelIdx[c]] : 0.f;
+    }
+    if (mayiuse(avx512_common)) {
+        kernel.reset(new jit_uni_color_convert_kernel_f32<avx512_common>(jcp));
+        vectorSize = cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+    } else if (mayiuse(avx2)) {
+        kernel.reset(new jit_uni_color_convert_kernel_f32<avx2>(jcp));
+        vectorSize = cpu_isa_traits<avx2>::vlen / sizeof(float);
+    }
+    if (!kernel)
+        return;
+    kernel->create_ker();
+
+    // the dword read for the V sample of the pixel must end inside the chroma row
+    const size_t uvRowSize = isI420 ? W / 2 : W;
+    const size_t vOffset = isI420 ? 0lu : 1lu;
+    kernelWidth = 0lu;
+    while (kernelWidth < W && kernelWidth / 2 * jcp.uv_step + vOffset + sizeof(int) <= uvRowSize)
+        kernelWidth++;
+}
+
+template <typename InputType, typename OutputType>
+void MKLDNNColorConvertNode::colorConvertImpl() {
+    const auto getSrc = [&](size_t port) {
+        return reinterpret_cast<const InputType*>(getParentEdgeAt(port)->getMemoryPtr()->GetPtr());
+    };
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    auto* dst = reinterpret_cast<OutputType*>(dstMemory.GetPtr());
+
+    const size_t planes = getParentEdges().size();
+    const size_t lumaSize = H * W;
+    const size_t chromaSize = (H / 2) * (W / 2);
+    // per batch strides of the planes, the positions of the chroma planes inside the batch and the chroma row stride
+    const size_t yBatchStride = planes == 1 ? lumaSize * 3 / 2 : lumaSize;
+    const size_t uvBatchStride = planes == 1 ? yBatchStride : (isI420 ? chromaSize : chromaSize * 2);
+    const InputType* y = getSrc(0);
+    const InputType* u = planes == 1 ? y + lumaSize : getSrc(1);
+    const InputType* v = isI420 ? (planes == 1 ? u + chromaSize : getSrc(2)) : u + 1;
+    const size_t uvRowStride = isI420 ? W / 2 : W;
+    const size_t uvStep = isI420 ? 1 : 2;
+
+    const size_t rIdx = isBGR ? 2 : 0;
+    const size_t bIdx = isBGR ? 0 : 2;
+    float channelScale[3] = {1.f, 1.f, 1.f};
+    float channelShift[3] = {0.f, 0.f, 0.f};
+    if (isFused) {
+        std::copy(scale.begin(), scale.end(), channelScale);
+        std::copy(shift.begin(), shift.end(), channelShift);
+    }
+    // interleaved: channel is the innermost dimension, planar: the width or the channel block of nCsp16c/nCsp8c,
+    // ncsp is treated as the block of 1
+    const auto dstDesc = dstMemory.GetDescWithType<BlockedMemoryDesc>();
+    const auto& blockDims = dstDesc->getBlockDims();
+    const auto& dstStrides = dstDesc->getStrides();
+    const size_t blockSize = blockDims.size() == 5 ? blockDims[4] : 1lu;
+    const size_t paddedChannels = blockSize == 1 ? 3lu : blockDims[1] * blockSize;
+    const size_t dstBatchStride = dstStrides[0];
+    const size_t dstRowStride = isPlanar ? dstStrides[2] : dstStrides[1];
+    const size_t dstPixelStride = isPlanar ? dstStrides[3] : dstStrides[2];
+    const size_t dstChannelStride = isPlanar ? dstStrides[1] : dstStrides[3];
+    const auto dstChannelOffset = [&](size_t c) {
+        return (c / blockSize) * dstChannelStride + c % blockSize;
+    };
+    dst += dstDesc->getOffsetPadding();
+
+    const auto clip = [](float value) {
+        // the integral results are rounded the same way as the reference implementation does
+        if (std::is_integral<InputType>::value)
+            value = std::round(value);
+        return std::min(std::max(value, 0.f), 255.f);
+    };
+
+    parallel_for2d(N, H, [&](size_t n, size_t h) {
+        const InputType* yRow = y + n * yBatchStride + h * W;
+        const InputType* uRow = u + n * uvBatchStride + (h / 2) * uvRowStride;
+        const InputType* vRow = v + n * uvBatchStride + (h / 2) * uvRowStride;
+        OutputType* dstRow = dst + n * dstBatchStride + h * dstRowStride;
+        OutputType* dstR = dstRow + dstChannelOffset(rIdx);
+        OutputType* dstG = dstRow + dstChannelOffset(1);
+        OutputType* dstB = dstRow + dstChannelOffset(bIdx);
+
+        float tile[3 * tileSize];
+        float* tileR = tile;
+        float* tileG = tile + tileSize;
+        float* tileB = tile + 2 * tileSize;
+        // the tiles start at even pixels, so the pairs of pixels sharing the chroma sample are never split
+        for (size_t w0 = 0; w0 < W; w0 += tileSize) {
+            const size_t tileWidth = std::min(tileSize, W - w0);
+            size_t kernelPixels = 0lu;
+            if (kernel && w0 < kernelWidth) {
+                kernelPixels = std::min(tileWidth, kernelWidth - w0) / vectorSize * vectorSize;
+            }
+            if (kernelPixels) {
+                jit_color_convert_call_args args;
+                args.y = reinterpret_cast<const uint8_t*>(yRow + w0);
+                args.u = reinterpret_cast<const uint8_t*>(uRow + (w0 / 2) * uvStep);
+                args.v = reinterpret_cast<const uint8_t*>(vRow + (w0 / 2) * uvStep);
+                args.dst_r = tileR;
+                args.dst_g = tileG;
+                args.dst_b = tileB;
+                args.work_amount = kernelPixels;
+                (*kernel)(&args);
+            }
+
+            for (size_t w = w0 + kernelPixels; w < w0 + tileWidth; w++) {
+                const float d = static_cast<float>(uRow[(w / 2) * uvStep]) - 128.f;
+                const float e = static_cast<float>(vRow[(w / 2) * uvStep]) - 128.f;
+                const float c = 1.164f * (static_cast<float>(yRow[w]) - 16.f);
+                const size_t i = w - w0;
+                tileR[i] = clip(c + 1.596f * e) * channelScale[rIdx] + channelShift[rIdx];
+                tileG[i] = clip(c - 0.391f * d - 0.813f * e) * channelScale[1] + channelShift[1];
+                tileB[i] = clip(c + 2.018f * d) * channelScale[bIdx] + channelShift[bIdx];
+            }
+
+            for (size_t i = 0; i < tileWidth; i++) {
+                const size_t offset = (w0 + i) * dstPixelStride;
+                dstR[offset] = static_cast<OutputType>(tileR[i]);
+                dstG[offset] = static_cast<OutputType>(tileG[i]);
+                dstB[offset] = static_cast<OutputType>(tileB[i]);
+                // the tail channels of the block are zero padding
+                for (size_t pad = 3; pad < paddedChannels; pad++) {
+                    dstRow[offset + dstChannelOffset(pad)] = static_cast<OutputType>(0.f);
+                }
+            }
+        }
+    });
+}
+
+void MKLDNNColorConvertNode::execute(mkldnn::stream strm) {
+    const auto inputPrecision = getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
+    const auto outputPrecision = getChildEdgeAt(0)->getMemory().getDesc().getPrecision();
+    if (inputPrecision == Precision::U8 && outputPrecision == Precision::U8) {
+        colorConvertImpl<uint8_t, uint8_t>();
+    } else if (inputPrecision == Precision::U8 && outputPrecision == Precision::FP32) {
+        colorConvertImpl<uint8_t, float>();
+    } else if (inputPrecision == Precision::U8 && outputPrecision == Precision::BF16) {
+        colorConvertImpl<uint8_t, bfloat16_t>();
+    } else if (inputPrecision == Precision::FP32 && outputPrecision == Precision::FP32) {
+        colorConvertImpl<float, float>();
+    } else {
+        IE_THROW() << errorPrefix << " has unsupported precisions: " << inputPrecision.name() << " -> " << outputPrecision.name();
+    }
+}
+
+bool MKLDNNColorConvertNode::created() const {
+    return getType() == ColorConvert;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNColorConvertNode, ColorConvert)
@@ -0,0 +1,87 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct jit_color_convert_config_params {
+    size_t uv_step;     // distance between the chroma samples of the row, 2 for the interleaved NV12 chroma plane
+    float scale[3];     // R, G, B
+    float shift[3];
+};
+
+struct jit_color_convert_call_args {
+    const uint8_t *y;
+    const uint8_t *u;
+    const uint8_t *v;
+    float *dst_r;
+    float *dst_g;
+    float *dst_b;
+    size_t work_amount;   // number of pixels, a multiple of the vector length
+};
+
+struct jit_uni_color_convert_kernel {
+    void (*ker_)(const jit_color_convert_call_args *);
+
+    void operator()(const jit_color_convert_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_color_convert_kernel(jit_color_convert_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_color_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_color_convert_config_params jcp_;
+};
+
+/**
+ * Executes NV12toRGB/NV12toBGR/I420toRGB/I420toBGR operations with single, two (NV12) or three (I420) plane inputs
+ * and FusedColorConvertNode which additionally converts the result to FP32/BF16, applies per-channel scale/shift
+ * and stores it either interleaved (NHWC) or planar (NCHW or the blocked nCsp16c/nCsp8c layout).
+ * The U8 rows are converted by the JIT kernel (AVX2 and AVX-512) into the R, G and B rows of a tile which is then
+ * stored in the destination layout, the FP32 inputs and the pixels the kernel doesn't cover use the reference code.
+ */
+class MKLDNNColorConvertNode : public MKLDNNNode {
+public:
+    MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename InputType, typename OutputType>
+    void colorConvertImpl();
+
+    bool isI420 = false;
+    bool isBGR = false;
+    bool isPlanar = false;
+    bool isFused = false;
+    std::vector<float> scale;
+    std::vector<float> shift;
+
+    size_t N = 0lu, H = 0lu, W = 0lu;
+
+    // the kernel reads 4 bytes per chroma sample, so it converts only the pixels which don't read past the chroma row
+    size_t kernelWidth = 0lu;
+    size_t vectorSize = 1lu;
+    std::shared_ptr<jit_uni_color_convert_kernel> kernel;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -18,6 +18,7 @@
 #include "mkldnn_fake_quantize_node.h"
 #include "mkldnn_pooling_node.h"
 #include "mkldnn_eltwise_node.h"
+#include "mkldnn_memory_state.h"
 #include <limits>
 #include "common/cpu_memcpy.h"
 #include "common/blocked_desc_creator.h"
@@ -336,7 +337,7 @@ bool MKLDNNConcatNode::isOptimized() const {
 }
 
 bool MKLDNNConcatNode::needPrepareParams() const {
-    if (canOptimizeNspc) {
+    if (canOptimizeNspc || appendState != nullptr) {
         return false;
     }
     return inputShapesModified();
@@ -503,6 +504,29 @@ void MKLDNNConcatNode::execute(mkldnn::stream strm) {
     (*prim).execute(strm, mem_ags);
 }
 
+void MKLDNNConcatNode::executeDynamicImpl(mkldnn::stream strm) {
+    if (appendState != nullptr) {
+        execAppendToState();
+        return;
+    }
+    execute(strm);
+}
+
+void MKLDNNConcatNode::execAppendToState() {
+    const auto& dstDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    appendState->Append(getParentEdgeAt(1)->getMemory().GetPtr(), dstDims);
+
+    if (auto data = appendState->GetDenseData()) {
+        // the consumers read the state buffer directly
+        const auto dstDesc = getChildEdgeAt(0)->getMemory().getDesc().clone();
+        for (auto& edge : getChildEdgesAtPort(0)) {
+            edge->getMemoryPtr()->redefineDesc(*dstDesc, data);
+        }
+    } else {
+        appendState->Read(getChildEdgeAt(0)->getMemory().GetPtr());
+    }
+}
+
 InferenceEngine::Precision MKLDNNConcatNode::getRuntimePrecision() const {
     return getMaxPrecision(getInputPrecisions());
 }
@@ -11,6 +11,8 @@
 
 namespace MKLDNNPlugin {
 
+class MKLDNNDynamicVariableState;
+
 class MKLDNNConcatNode : public MKLDNNNode {
 public:
     MKLDNNConcatNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -23,9 +25,19 @@ public:
     void selectOptimalPrimitiveDescriptor() override;
     bool created() const override;
     void execute(mkldnn::stream strm) override;
-    void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
+    void executeDynamicImpl(mkldnn::stream strm) override;
 
     bool isOptimized() const;
+    size_t getAxis() const {
+        return axis;
+    }
+    /**
+     * @brief The concatenation of the dynamic variable state with the new rows, which are appended to the state in
+     * place. The first input isn't read and the output is the state itself.
+     */
+    void bindAppendState(MKLDNNDynamicVariableState* state) {
+        appendState = state;
+    }
 
     InferenceEngine::Precision getRuntimePrecision() const override;
     bool isExecutable() const override {
@@ -39,9 +51,11 @@ private:
     size_t axis = 0;
     bool canBeInPlace = false;
     bool canOptimizeNspc = false;
+    MKLDNNDynamicVariableState* appendState = nullptr;
 
     size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
     void execNspcSpecCase();
+    void execAppendToState();
 
     InferenceEngine::Precision inputPrecision = InferenceEngine::Precision::FP32;
     InferenceEngine::Precision outputPrecision = InferenceEngine::Precision::FP32;
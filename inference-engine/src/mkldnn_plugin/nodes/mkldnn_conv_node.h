@@ -26,6 +26,9 @@ public:
     void createPrimitive() override;
     void selectOptimalPrimitiveDescriptor() override;
     void initSupportedPrimitiveDescriptors() override;
+    bool canShareSupportedPrimitiveDescriptors() const override {
+        return true;
+    }
     void filterSupportedPrimitiveDescriptors() override;
     bool created() const override;
     bool canBeInPlace() const override {
@@ -26,21 +26,38 @@ using namespace InferenceEngine;
 
 bool MKLDNNDeconvolutionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (std::dynamic_pointer_cast<const ngraph::opset1::ConvolutionBackpropData>(op) == nullptr &&
                 std::dynamic_pointer_cast<const ngraph::opset1::GroupConvolutionBackpropData>(op) == nullptr) {
             errorMessage = "Only opset1 ConvolutionBackpropData and GroupConvolutionBackpropData operations are supported";
             return false;
         }
-        size_t ndims = op->get_input_shape(0).size();
+        const auto& dataShape = op->get_input_partial_shape(0);
+        if (dataShape.rank().is_dynamic()) {
+            errorMessage = "Doesn't support 'data' input with dynamic rank";
+            return false;
+        }
+        size_t ndims = dataShape.rank().get_length();
         if ((ndims < 3) || (ndims > 5)) {
             errorMessage = "Only 3D, 4D and 5D blobs are supported as input";
             return false;
         }
+        if (isDynamicNgraphNode(op)) {
+            // only the batch and the spatial dimensions may be dynamic
+            if (dataShape[1].is_dynamic() || op->get_output_partial_shape(0)[1].is_dynamic()) {
+                errorMessage = "Doesn't support dynamic number of channels";
+                return false;
+            }
+            if (op->get_input_partial_shape(1).is_dynamic() ||
+                    op->get_input_node_ptr(1)->get_type_info() != ngraph::op::v0::Constant::get_type_info_static()) {
+                errorMessage = "Doesn't support non constant weights";
+                return false;
+            }
+            if (op->get_input_size() > 2 &&
+                    op->get_input_node_ptr(2)->get_type_info() != ngraph::op::v0::Constant::get_type_info_static()) {
+                errorMessage = "Doesn't support non constant 'output_shape' input";
+                return false;
+            }
+        }
     } catch (...) {
         return false;
     }
@@ -58,9 +75,9 @@ MKLDNNDeconvolutionNode::MKLDNNDeconvolutionNode(const std::shared_ptr<ngraph::N
 
         auto convBackprop = std::dynamic_pointer_cast<const ngraph::opset1::ConvolutionBackpropData>(op);
         auto groupConvBackprop = std::dynamic_pointer_cast<const ngraph::opset1::GroupConvolutionBackpropData>(op);
-        const auto dataShape = op->get_input_shape(0);
+        const auto& dataShape = getInputShapeAtPort(0).getDims();
         weightDims = op->get_input_shape(1);
-        const auto outShape = op->get_shape();
+        const auto& outShape = getOutputShapeAtPort(0).getDims();
         OC = outShape[1];
         IC = dataShape[1];
 
@@ -78,6 +95,7 @@ MKLDNNDeconvolutionNode::MKLDNNDeconvolutionNode(const std::shared_ptr<ngraph::N
             }
             paddingL = convBackprop->get_pads_begin();
             paddingR = convBackprop->get_pads_end();
+            autoPadding = one_of(convBackprop->get_auto_pad(), ov::op::PadType::SAME_UPPER, ov::op::PadType::SAME_LOWER);
         } else if (groupConvBackprop) {
             algorithm = DeconvolutionGrouped;
 
@@ -93,6 +111,7 @@ MKLDNNDeconvolutionNode::MKLDNNDeconvolutionNode(const std::shared_ptr<ngraph::N
             }
             paddingL = groupConvBackprop->get_pads_begin();
             paddingR = groupConvBackprop->get_pads_end();
+            autoPadding = one_of(groupConvBackprop->get_auto_pad(), ov::op::PadType::SAME_UPPER, ov::op::PadType::SAME_LOWER);
         }
         for (int i = 0; i < dilation.size(); i++) {
             kernel.push_back(weightDims[withGroups + 2 + i]);
@@ -163,7 +182,8 @@ bool MKLDNNDeconvolutionNode::canBeExecutedInInt8() const {
     if (!withGroups && stride.back() > 3)
         return false;
     if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_common)) {
-        auto inDims = getOutputShapeAtPort(0).getStaticDims();
+        // the dynamic spatial dimensions are estimated by the dummy ones
+        auto inDims = MemoryDescUtils::makeDummyShape(getOutputShapeAtPort(0)).getStaticDims();
         // heuristicConst = 2^26
         // heuristicParam = IC^2 * SP
         auto heuristicConst = 67108864;
@@ -239,16 +259,10 @@ void MKLDNNDeconvolutionNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW() << errorPrefix << " has incorrect number of output edges";
 
-    for (int i = 0; i < paddingR.size(); i++) {
-        int with_group = getAlgorithm() == DeconvolutionGrouped ? 1 : 0;
-        int krn = weightDims[with_group + 2 + i];
-        int src = getOutputShapeAtPort(0).getStaticDims()[2 + i];
-        int dst = getInputShapeAtPort(0).getStaticDims()[2 + i];
-
-        krn = (krn - 1)*(dilation[i] + 1) + 1;
-        int calc_dst = (src - krn + paddingL[i]) / stride[i] + 1;
-        paddingR[i] = (dst - calc_dst) * stride[i];
-    }
+    // the descriptors of the dynamic node are created for the dummy shapes, the actual ones are created in prepareParams
+    const auto inDims = MemoryDescUtils::makeDummyShape(getInputShapeAtPort(0)).getStaticDims();
+    const auto outDims = isDynamicNode() ? shapeInferInternal(inDims) : getOutputShapeAtPort(0).getStaticDims();
+    updatePadding(inDims, outDims);
 
     if (isInt8) {
         //  WA: if int8 deconvolution is supported, we create internal weights blob in IO format
@@ -276,7 +290,7 @@ void MKLDNNDeconvolutionNode::setPostOps(mkldnn::primitive_attr &attr) {
         if (eltwiseNode) {
             // TODO [DS]: change to shape from memory
             constexpr int align = 16;
-            eltwiseNode->appendPostOps(ops, getOutputShapeAtPort(0).getStaticDims(), align);
+            eltwiseNode->appendPostOps(ops, MemoryDescUtils::makeDummyShape(getOutputShapeAtPort(0)).getStaticDims(), align);
             continue;
         }
         auto* fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode *>(node.get());
@@ -335,35 +349,162 @@ bool MKLDNNDeconvolutionNode::created() const {
 }
 
 void MKLDNNDeconvolutionNode::createPrimitive() {
-    if (prim)
-        return;
+    if (inputShapesDefined()) {
+        if (needPrepareParams())
+            prepareParams();
+        updateLastInputDims();
+    }
+}
+
+void MKLDNNDeconvolutionNode::updatePadding(const VectorDims& inDims, const VectorDims& outDims) {
+    //update padding. TODO [DS] : rewrite when the final shape inference interface is available
+    if (isDynamicNode() && autoPadding) {
+        if (auto convBackprop = ov::as_type_ptr<ngraph::opset1::ConvolutionBackpropData>(opToShapeInfer)) {
+            paddingL = convBackprop->get_pads_begin();
+        } else if (auto groupConvBackprop = ov::as_type_ptr<ngraph::opset1::GroupConvolutionBackpropData>(opToShapeInfer)) {
+            paddingL = groupConvBackprop->get_pads_begin();
+        }
+    }
 
+    for (int i = 0; i < paddingR.size(); i++) {
+        int with_group = getAlgorithm() == DeconvolutionGrouped ? 1 : 0;
+        int krn = weightDims[with_group + 2 + i];
+        int src = outDims[2 + i];
+        int dst = inDims[2 + i];
+
+        krn = (krn - 1)*(dilation[i] + 1) + 1;
+        int calc_dst = (src - krn + paddingL[i]) / stride[i] + 1;
+        paddingR[i] = (dst - calc_dst) * stride[i];
+    }
+}
+
+VectorDims MKLDNNDeconvolutionNode::shapeInferInternal(const VectorDims& inDims) const {
+    // the weights and the 'output_shape' inputs are constants (the weights edge of the int8 node is even removed),
+    // so only the data shape is taken from the input
+    std::vector<Shape> shapes{Shape(inDims)};
+    for (size_t i = 1; i < opToShapeInfer->get_input_size(); i++)
+        shapes.push_back(Shape(opToShapeInfer->get_input_partial_shape(i)));
+    return shapeInferGeneric(shapes).front();
+}
+
+std::vector<VectorDims> MKLDNNDeconvolutionNode::shapeInfer() const {
+    return {shapeInferInternal(getParentEdgesAtPort(0)[0]->getMemory().getStaticDims())};
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNDeconvolutionNode::getPrimitive(const DnnlMemoryDesc& srcDesc, const DnnlMemoryDesc& dstDesc) {
+    const NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        IE_THROW() << errorPrefix << " has unset preferable primitive descriptor";
+
+    const auto& inDims = srcDesc.getShape().getStaticDims();
+    const auto& outDims = dstDesc.getShape().getStaticDims();
+    const auto key = std::make_pair(inDims, outDims);
+    for (auto it = primitivesCache.begin(); it != primitivesCache.end(); ++it) {
+        if (it->first == key) {
+            primitivesCache.splice(primitivesCache.begin(), primitivesCache, it);
+            return it->second;
+        }
+    }
+
+    updatePadding(inDims, outDims);
+    auto convertDims = [] (const std::vector<ptrdiff_t>& orig_dims) {
+        return memory::dims(orig_dims.begin(), orig_dims.end());
+    };
+
+    // the weights are prepared once, so all the primitives use the layout of the selected one
+    std::vector<MKLDNNDescriptor> candidates;
     if (isInt8) {
-        auto prim_desc = createPrimitiveDescriptor<deconvolution_forward::primitive_desc,
-                deconvolution_forward::desc>(attr);
+        mkldnn::memory::desc wgh_candidate = internalBlobMemory.empty() ?
+            mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(weightDims), memory::data_type::s8, memory::format_tag::any) :
+            internalBlobMemory[0]->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+        candidates.emplace_back(std::make_shared<deconvolution_forward::desc>(prop_kind::forward_inference, mkldnn::algorithm::deconvolution_direct,
+                                                                              srcDesc.getDnnlDesc(), wgh_candidate, dstDesc.getDnnlDesc(),
+                                                                              convertDims(stride), convertDims(dilation),
+                                                                              convertDims(paddingL), convertDims(paddingR)));
+    } else {
+        const auto& wgh_candidate = getParentEdgeAt(1)->getMemory().GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+        for (auto alg : {mkldnn::algorithm::convolution_winograd, mkldnn::algorithm::convolution_direct}) {
+            convolution_forward::desc conv_desc(prop_kind::forward_inference, alg,
+                                                dstDesc.getDnnlDesc(), wgh_candidate, srcDesc.getDnnlDesc(),
+                                                convertDims(stride), convertDims(dilation),
+                                                convertDims(paddingL), convertDims(paddingR));
+            auto fwd_conv_pd = std::make_shared<convolution_forward::primitive_desc>(conv_desc, getEngine(), true);
+            if (fwd_conv_pd->get(true) == nullptr)
+                continue;
 
-        prim.reset(new deconvolution_forward(prim_desc));
+            candidates.emplace_back(std::make_shared<convolution_backward_data::desc>(alg, dstDesc.getDnnlDesc(), wgh_candidate,
+                                                                                      srcDesc.getDnnlDesc(),
+                                                                                      convertDims(stride), convertDims(dilation),
+                                                                                      convertDims(paddingL), convertDims(paddingR)),
+                                    fwd_conv_pd);
+        }
+    }
 
-        auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
-        auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
-        primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, internalBlobMemory[0]->GetPrimitive()}, {DNNL_ARG_DST, dst}};
+    mkldnn::primitive_desc_iterator itpd;
+    bool found = false;
+    for (const auto& candidate : candidates) {
+        itpd = candidate.createPrimitiveDescriptorIterator(getEngine(), attr);
+        while (static_cast<bool>(itpd)) {
+            if (parse_impl_name(itpd.impl_info_str()) == selected_pd->getImplementationType()) {
+                found = true;
+                break;
+            }
+            if (!itpd.next_impl())
+                break;
+        }
+        if (found)
+            break;
+    }
+    if (!found)
+        IE_THROW() << errorPrefix << " can't find the primitive descriptor of the selected implementation";
+
+    std::shared_ptr<mkldnn::primitive> primitive;
+    if (isInt8) {
+        if (internalBlobMemory.empty())
+            prepareMemory(selected_pd, itpd);
+        primitive = std::make_shared<deconvolution_forward>(deconvolution_forward::primitive_desc(itpd.get()));
     } else {
-        auto prim_desc = createPrimitiveDescriptor<convolution_backward_data::primitive_desc,
-                convolution_backward_data::desc, convolution_forward::primitive_desc>(attr);
+        primitive = std::make_shared<convolution_backward_data>(convolution_backward_data::primitive_desc(itpd.get()));
+    }
+
+    primitivesCache.emplace_front(key, primitive);
+    if (primitivesCache.size() > primitivesCacheCapacity)
+        primitivesCache.pop_back();
+    return primitive;
+}
 
-        prim.reset(new convolution_backward_data(prim_desc));
+void MKLDNNDeconvolutionNode::prepareParams() {
+    auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
+    auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " has not allocated destination memory";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " has not allocated input memory";
 
-        auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
+    prim = getPrimitive(*srcMemPtr->GetDescWithType<DnnlMemoryDesc>(), *dstMemPtr->GetDescWithType<DnnlMemoryDesc>());
+
+    auto src = srcMemPtr->GetPrimitive();
+    auto dst = dstMemPtr->GetPrimitive();
+    if (isInt8) {
+        primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, internalBlobMemory[0]->GetPrimitive()}, {DNNL_ARG_DST, dst}};
+    } else {
         auto weights = getParentEdgeAt(1)->getMemory().GetPrimitive();
-        auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
         primArgs = {{DNNL_ARG_DIFF_DST, src}, {DNNL_ARG_WEIGHTS, weights}, {DNNL_ARG_DIFF_SRC, dst}};
     }
 }
 
+void MKLDNNDeconvolutionNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
 void MKLDNNDeconvolutionNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                const std::vector<MemoryDescPtr> &outputDesc) {
-    const auto in_candidate = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(*inputDesc[0]);
-    const auto out_candidate = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(*outputDesc[0]);
+    // the dynamic shapes are replaced by the dummy ones which the paddings are computed for
+    const auto inDims = MemoryDescUtils::makeDummyShape(inputDesc[0]->getShape()).getStaticDims();
+    const auto inpDesc = inputDesc[0]->isDefined() ? inputDesc[0] : inputDesc[0]->cloneWithNewDims(inDims);
+    const auto outDesc = outputDesc[0]->isDefined() ? outputDesc[0] : outputDesc[0]->cloneWithNewDims(shapeInferInternal(inDims));
+    const auto in_candidate = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(*inpDesc);
+    const auto out_candidate = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(*outDesc);
 
     // grouping and autoblicking is not compatible
     if ((withGroups && !isDW) && (in_candidate.blocksExtended() || out_candidate.blocksExtended()))
@@ -417,11 +558,17 @@ std::shared_ptr<MemoryDesc> MKLDNNDeconvolutionNode::getSrcMemDesc(mkldnn::primi
     }
 
     auto desc = idx > 0 ? primitive_desc_it.weights_desc(idx - 1) : isInt8 ? primitive_desc_it.src_desc(idx) : primitive_desc_it.diff_dst_desc(idx);
+    if (getInputShapeAtPort(idx).isDynamic()) {
+        return MKLDNNExtensionUtils::makeUndefinedDesc(desc, getInputShapeAtPort(idx));
+    }
     return MKLDNNExtensionUtils::makeDescriptor(desc);
 }
 
 std::shared_ptr<MemoryDesc> MKLDNNDeconvolutionNode::getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) {
     auto desc =  isInt8 ? primitive_desc_it.dst_desc(idx) : primitive_desc_it.diff_src_desc(idx);
+    if (getOutputShapeAtPort(idx).isDynamic()) {
+        return MKLDNNExtensionUtils::makeUndefinedDesc(desc, getOutputShapeAtPort(idx));
+    }
     return MKLDNNExtensionUtils::makeDescriptor(desc);
 }
 
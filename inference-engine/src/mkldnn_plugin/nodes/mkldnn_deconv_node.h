@@ -9,6 +9,8 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <list>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -17,6 +19,9 @@ public:
     MKLDNNDeconvolutionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     void getSupportedDescriptors() override;
+    bool canShareSupportedPrimitiveDescriptors() const override {
+        return true;
+    }
     void createDescriptor(const std::vector<MemoryDescPtr>& inputDesc,
                           const std::vector<MemoryDescPtr>& outputDesc) override;
     void createPrimitive() override;
@@ -42,6 +47,10 @@ public:
     const InferenceEngine::SizeVector& getWeightDims() { return weightDims; }
     const std::vector<ptrdiff_t>& getStride() { return stride; }
 
+    std::vector<VectorDims> shapeInfer() const override;
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
 private:
     bool withGroups = false;
     bool isDW = false;
@@ -54,6 +63,7 @@ private:
     std::vector<ptrdiff_t> dilation;
     std::vector<ptrdiff_t> paddingL;
     std::vector<ptrdiff_t> paddingR;
+    bool autoPadding = false;
     InferenceEngine::SizeVector weightDims;
     std::vector<std::shared_ptr<mkldnn::convolution_forward::desc>> descs_fwd;
     std::vector<std::shared_ptr<mkldnn::convolution_backward_data::desc>> descs_bwd;
@@ -65,6 +75,14 @@ private:
 
     bool canBeExecutedInInt8() const;
     InferenceEngine::Blob::Ptr createWeiBlobAsIO(InferenceEngine::SizeVector dims);
+
+    void updatePadding(const VectorDims& inDims, const VectorDims& outDims);
+    VectorDims shapeInferInternal(const VectorDims& inDims) const;
+    std::shared_ptr<mkldnn::primitive> getPrimitive(const DnnlMemoryDesc& srcDesc, const DnnlMemoryDesc& dstDesc);
+
+    /** Primitives by the input and output dimensions, the most recently used first */
+    std::list<std::pair<std::pair<VectorDims, VectorDims>, std::shared_ptr<mkldnn::primitive>>> primitivesCache;
+    static const size_t primitivesCacheCapacity = 16;
 };
 
 }  // namespace MKLDNNPlugin
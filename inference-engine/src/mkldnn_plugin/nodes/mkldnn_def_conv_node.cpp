@@ -578,16 +578,26 @@ private:
 
 bool MKLDNNDeformableConvolutionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
         if (!one_of(op->get_type_info(),
                 ngraph::op::v1::DeformableConvolution::get_type_info_static(),
                 ngraph::op::v8::DeformableConvolution::get_type_info_static())) {
             errorMessage = "Node is not an instance of DeformableConvolution form the operation set v1 or v8.";
             return false;
         }
+        if (isDynamicNgraphNode(op)) {
+            // only the batch and the spatial dimensions may be dynamic
+            const auto& dataShape = op->get_input_partial_shape(0);
+            const auto& outShape = op->get_output_partial_shape(0);
+            if (dataShape.rank().is_dynamic() || dataShape[1].is_dynamic() ||
+                    outShape.rank().is_dynamic() || outShape[1].is_dynamic()) {
+                errorMessage = "Doesn't support dynamic rank or dynamic number of channels";
+                return false;
+            }
+            if (op->get_input_partial_shape(2).is_dynamic()) {
+                errorMessage = "Doesn't support dynamic filters shape";
+                return false;
+            }
+        }
     } catch (...) {
         return false;
     }
@@ -618,6 +628,7 @@ MKLDNNDeformableConvolutionNode::MKLDNNDeformableConvolutionNode(const std::shar
     }
 
     paddingL = defConvNodeBase->get_pads_begin();
+    autoPadding = one_of(defConvNodeBase->get_auto_pad(), ov::op::PadType::SAME_UPPER, ov::op::PadType::SAME_LOWER);
 
     if (op->get_type_info() == ngraph::op::v8::DeformableConvolution::get_type_info_static()) {
         auto defConvNode = std::dynamic_pointer_cast<ngraph::op::v8::DeformableConvolution>(op);
@@ -675,8 +686,8 @@ void MKLDNNDeformableConvolutionNode::initSupportedPrimitiveDescriptors() {
 
     impl_desc_type impl_type;
     const int simd_w = mayiuse(cpu::x64::avx512_common) ? 16 : 8;
-    if (group != 1 || (((getInputShapeAtPort(0).getStaticDims()[1] / group) % simd_w != 0)
-    || ((getOutputShapeAtPort(0).getStaticDims()[1] / group) % simd_w != 0))) {
+    if (group != 1 || (((getInputShapeAtPort(0).getDims()[1] / group) % simd_w != 0)
+    || ((getOutputShapeAtPort(0).getDims()[1] / group) % simd_w != 0))) {
         enforceRef = true;
     }
 
@@ -867,10 +878,26 @@ void MKLDNNDeformableConvolutionNode::prepareSamplingWeights(
 }
 
 void MKLDNNDeformableConvolutionNode::createPrimitive() {
+    if (inputShapesDefined()) {
+        if (needPrepareParams())
+            prepareParams();
+        updateLastInputDims();
+    }
+}
+
+void MKLDNNDeformableConvolutionNode::updatePadding() {
+    // the SAME_* paddings depend on the input shape, they are computed by the shape inference of the op
+    if (isDynamicNode() && autoPadding) {
+        if (auto defConv = ov::as_type_ptr<ngraph::op::util::DeformableConvolutionBase>(opToShapeInfer)) {
+            paddingL = defConv->get_pads_begin();
+        }
+    }
+}
+
+void MKLDNNDeformableConvolutionNode::prepareParams() {
     auto selectedPrimitiveDescriptor = getSelectedPrimitiveDescriptor();
     if (!selectedPrimitiveDescriptor)
         IE_THROW() << "CPU deformable convolution with name '" << getName() << "' doesn't have primitive descriptors.";
-    auto config = selectedPrimitiveDescriptor->getConfig();
 
     auto srcDims = getParentEdgeAt(0)->getMemory().getStaticDims();
     auto weiDims = getParentEdgeAt(2)->getMemory().getStaticDims();
@@ -893,6 +920,7 @@ void MKLDNNDeformableConvolutionNode::createPrimitive() {
     jcp.kh = weiDims[2];
     jcp.kw = weiDims[3];
 
+    updatePadding();
     jcp.t_pad = paddingL[0];
     jcp.l_pad = paddingL[1];
 
@@ -925,9 +953,21 @@ void MKLDNNDeformableConvolutionNode::createPrimitive() {
 
     jcp.nthr = dnnl_get_max_threads();
 
-    if (enforceRef) {
+    if (enforceRef)
         return;
-    } else if (mayiuse(cpu::x64::avx512_common)) {
+
+    // the kernel depends on the spatial dimensions and the paddings only, so it's shared by the different batches
+    const VectorDims key{srcDims[2], srcDims[3], dstDims[2], dstDims[3],
+                         static_cast<size_t>(jcp.t_pad), static_cast<size_t>(jcp.l_pad)};
+    for (auto it = kernelsCache.begin(); it != kernelsCache.end(); ++it) {
+        if (it->first == key) {
+            kernelsCache.splice(kernelsCache.begin(), kernelsCache, it);
+            def_conv_kernel = it->second;
+            return;
+        }
+    }
+
+    if (mayiuse(cpu::x64::avx512_common)) {
         def_conv_kernel.reset(new jit_uni_def_conv_kernel_f32<cpu::x64::avx512_common>(jcp));
     } else if (mayiuse(cpu::x64::avx2)) {
         def_conv_kernel.reset(new jit_uni_def_conv_kernel_f32<cpu::x64::avx2>(jcp));
@@ -935,8 +975,16 @@ void MKLDNNDeformableConvolutionNode::createPrimitive() {
         def_conv_kernel.reset(new jit_uni_def_conv_kernel_f32<cpu::x64::sse41>(jcp));
     }
 
-    if (def_conv_kernel)
+    if (def_conv_kernel) {
         def_conv_kernel->create_ker();
+        kernelsCache.emplace_front(key, def_conv_kernel);
+        if (kernelsCache.size() > kernelsCacheCapacity)
+            kernelsCache.pop_back();
+    }
+}
+
+void MKLDNNDeformableConvolutionNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
 }
 
 void MKLDNNDeformableConvolutionNode::executeReference(const float* src, const float* weights, float* dst, const std::vector<size_t>& src_strides,
@@ -8,6 +8,8 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <list>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -80,6 +82,10 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
     bool enforceRef = false;
     constexpr static int sampledPointsPerPixel = 4;  // count of sampling points ({top|bottom}, {left|right})
 
@@ -91,6 +97,7 @@ private:
     std::vector<ptrdiff_t> stride = {};
     std::vector<ptrdiff_t> dilation = {};
     std::vector<ptrdiff_t> paddingL = {};
+    bool autoPadding = false;
 
     int deformable_group = 1;
 
@@ -101,6 +108,11 @@ private:
 
     std::shared_ptr<jit_uni_def_conv_kernel> def_conv_kernel = nullptr;
 
+    /** Kernels by the input and output spatial dimensions and the paddings, the most recently used first */
+    std::list<std::pair<VectorDims, std::shared_ptr<jit_uni_def_conv_kernel>>> kernelsCache;
+    static const size_t kernelsCacheCapacity = 16;
+
+    void updatePadding();
     void prepareSamplingWeights(const std::vector<size_t>& src_strides, const float* offsets, const std::vector<size_t>& off_strides,
                                 const float* modulation = nullptr, const std::vector<size_t>& modulation_strides = {});
 
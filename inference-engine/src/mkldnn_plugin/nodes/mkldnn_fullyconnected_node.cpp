@@ -7,6 +7,7 @@
 #include "mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -22,11 +23,6 @@ using namespace InferenceEngine;
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         const auto fc = std::dynamic_pointer_cast<const FullyConnectedNode>(op);
         if (!fc) {
             errorMessage = "Only legacy FullyConnected operation is supported";
@@ -36,10 +32,30 @@ bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const
             errorMessage = "Only Constant operation on 'bias' input is supported";
             return false;
         }
-        if (!one_of(fc->get_input_shape(DATA_ID).size(), 2, 3, 4)) {
-            errorMessage = "Doesn't support 'data' input with rank: " + std::to_string(fc->get_input_shape(DATA_ID).size());
+        const auto& dataShape = fc->get_input_partial_shape(DATA_ID);
+        if (dataShape.rank().is_dynamic()) {
+            errorMessage = "Doesn't support 'data' input with dynamic rank";
+            return false;
+        }
+        const auto dataRank = dataShape.rank().get_length();
+        if (!one_of(dataRank, 2, 3, 4)) {
+            errorMessage = "Doesn't support 'data' input with rank: " + std::to_string(dataRank);
             return false;
         }
+        if (isDynamicNgraphNode(op)) {
+            if (dataRank == 4) {
+                errorMessage = "Doesn't support 'data' input with rank 4 and dynamic shape";
+                return false;
+            }
+            if (dataShape[dataRank - 1].is_dynamic()) {
+                errorMessage = "Doesn't support 'data' input with dynamic last dimension";
+                return false;
+            }
+            if (fc->get_input_partial_shape(WEIGHTS_ID).is_dynamic()) {
+                errorMessage = "Doesn't support 'weights' input with dynamic shape";
+                return false;
+            }
+        }
     } catch (...) {
         return false;
     }
@@ -108,8 +124,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
         outputDataType = memory::data_type::bf16;
     }
 
-    const auto& inDims = getInputShapeAtPort(0).getStaticDims();
-    const auto& outDims = getOutputShapeAtPort(0).getStaticDims();
+    // the dynamic dims are replaced by the dummy ones to choose the implementation and the weights layout,
+    // the primitives for the real shapes are created in prepareParams
+    const auto inDims = MemoryDescUtils::makeDummyShape(getInputShapeAtPort(0)).getStaticDims();
+    const auto outDims = MemoryDescUtils::makeDummyShape(getOutputShapeAtPort(0)).getStaticDims();
 
     if (inDims.size() == 3) {
         weightsDims = InferenceEngine::SizeVector({static_cast<size_t>(outDims[2]), static_cast<size_t>(inDims[2])});
@@ -129,6 +147,15 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
 }
 
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (isDynamicNode()) {
+        if (inputShapesDefined()) {
+            if (needPrepareParams())
+                prepareParams();
+            updateLastInputDims();
+        }
+        return;
+    }
+
     if (prim)
         return;
 
@@ -147,13 +174,87 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     else
         primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive()}, {DNNL_ARG_DST, dst}};
 
-    auto post_ops = attr->get_post_ops();
-    int idx = 0;
-    for (int i = 0; i < post_ops.len(); i++) {
-        if (post_ops.kind(i) == mkldnn::primitive::kind::binary) {
-            primArgs.insert({DNNL_ARG_ATTR_MULTIPLE_POST_OP(i) | DNNL_ARG_SRC_1, binaryPostOpsArgs[idx++]});
+    setPostOpsArgs(*attr);
+}
+
+void MKLDNNFullyConnectedNode::prepareParams() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate destination memory";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate input memory";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " did not set preferable primitive descriptor";
+
+    // the post ops memory is bound only once, so all the cached primitives share the same attributes
+    if (!pAttr) {
+        pAttr = initPrimitiveAttr();
+    }
+
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const auto rows = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    prim = getPrimitiveForRows(rows);
+
+    primArgs.clear();
+    primArgs[DNNL_ARG_SRC] = srcMemPtr->GetPrimitive();
+    primArgs[DNNL_ARG_WEIGHTS] = getParentEdgeAt(WEIGHTS_ID)->getMemory().GetPrimitive();
+    if (withBiases)
+        primArgs[DNNL_ARG_BIAS] = getParentEdgeAt(BIAS_ID)->getMemory().GetPrimitive();
+    primArgs[DNNL_ARG_DST] = dstMemPtr->GetPrimitive();
+
+    setPostOpsArgs(*pAttr);
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNFullyConnectedNode::getPrimitiveForRows(size_t rows) {
+    for (auto it = primitivesCache.begin(); it != primitivesCache.end(); ++it) {
+        if (it->first == rows) {
+            primitivesCache.splice(primitivesCache.begin(), primitivesCache, it);
+            return it->second;
         }
     }
+
+    const auto srcDesc = getParentEdgeAt(DATA_ID)->getMemory().GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+    const auto dstDesc = getChildEdgeAt(0)->getMemory().GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+    const auto M = static_cast<memory::dim>(rows);
+    const memory::desc srcDesc2D({M, srcDesc.dims().back()}, srcDesc.data_type(), memory::format_tag::nc);
+    const memory::desc dstDesc2D({M, dstDesc.dims().back()}, dstDesc.data_type(), memory::format_tag::nc);
+    // the constant weights were reordered once to the layout chosen for the dummy shape, so every primitive
+    // is created for exactly this layout instead of 'any'
+    const auto wghDesc = getParentEdgeAt(WEIGHTS_ID)->getMemory().GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+
+    std::shared_ptr<inner_product_forward::desc> ipDesc;
+    if (withBiases) {
+        const auto biasDesc = getParentEdgeAt(BIAS_ID)->getMemory().GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+        ipDesc = std::make_shared<inner_product_forward::desc>(prop_kind::forward_scoring, srcDesc2D, wghDesc, biasDesc, dstDesc2D);
+    } else {
+        ipDesc = std::make_shared<inner_product_forward::desc>(prop_kind::forward_scoring, srcDesc2D, wghDesc, dstDesc2D);
+    }
+
+    MKLDNNDescriptor desc(ipDesc);
+    auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), *pAttr);
+    if (!static_cast<bool>(itpd))
+        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+
+    // the selected implementation may not support the current number of rows, then the first suitable one is used
+    inner_product_forward::primitive_desc prim_desc(itpd.get());
+    const auto selectedType = getSelectedPrimitiveDescriptor()->getImplementationType();
+    do {
+        if (parse_impl_name(itpd.impl_info_str()) == selectedType) {
+            prim_desc = inner_product_forward::primitive_desc(itpd.get());
+            break;
+        }
+    } while (itpd.next_impl());
+
+    auto primitive = std::make_shared<inner_product_forward>(prim_desc);
+    primitivesCache.emplace_front(rows, primitive);
+    if (primitivesCache.size() > primitivesCacheCapacity)
+        primitivesCache.pop_back();
+    return primitive;
+}
+
+void MKLDNNFullyConnectedNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
@@ -211,9 +312,10 @@ void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool ini
 
         auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
         if (eltwiseNode) {
-            // TODO [DS]: change to shape from memory
+            // only the channels dim is used, it's static even for the dynamic node
             constexpr int align = -1;
-            eltwiseNode->appendPostOps(ops, getOutputShapeAtPort(0).getStaticDims(), align, initAsBinary, initBinaryMemory);
+            eltwiseNode->appendPostOps(ops, MemoryDescUtils::makeDummyShape(getOutputShapeAtPort(0)).getStaticDims(), align, initAsBinary,
+                                       initBinaryMemory);
             if (initBinaryMemory) {
                 if (eltwiseNode->scalesMemory)
                     binaryPostOpsArgs.push_back(eltwiseNode->scalesMemory->GetPrimitive());
@@ -229,6 +331,16 @@ void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool ini
     attr.set_post_ops(ops);
 }
 
+void MKLDNNFullyConnectedNode::setPostOpsArgs(const mkldnn::primitive_attr &attr) {
+    auto post_ops = attr.get_post_ops();
+    int idx = 0;
+    for (int i = 0; i < post_ops.len(); i++) {
+        if (post_ops.kind(i) == mkldnn::primitive::kind::binary) {
+            primArgs.insert({DNNL_ARG_ATTR_MULTIPLE_POST_OP(i) | DNNL_ARG_SRC_1, binaryPostOpsArgs[idx++]});
+        }
+    }
+}
+
 bool MKLDNNFullyConnectedNode::created() const {
     return getType() == FullyConnected;
 }
@@ -343,7 +455,7 @@ void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr>
 std::shared_ptr<MemoryDesc> MKLDNNFullyConnectedNode::getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) {
     auto desc = idx > 0 ? primitive_desc_it.weights_desc(idx - 1) : primitive_desc_it.src_desc(idx);
 
-    if (getInputShapeAtPort(idx).getRank() == 3) {
+    if (getInputShapeAtPort(idx).getRank() == 3 || getInputShapeAtPort(idx).isDynamic()) {
         return std::make_shared<CpuBlockedMemoryDesc>(MKLDNNExtensionUtils::DataTypeToIEPrecision(
             static_cast<mkldnn::memory::data_type>(desc.data.data_type)), getInputShapeAtPort(idx));
     }
@@ -353,7 +465,7 @@ std::shared_ptr<MemoryDesc> MKLDNNFullyConnectedNode::getSrcMemDesc(mkldnn::prim
 std::shared_ptr<MemoryDesc> MKLDNNFullyConnectedNode::getDstMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) {
     auto desc = primitive_desc_it.dst_desc(idx);
 
-    if (getOutputShapeAtPort(idx).getRank() == 3) {
+    if (getOutputShapeAtPort(idx).getRank() == 3 || getOutputShapeAtPort(idx).isDynamic()) {
         return std::make_shared<CpuBlockedMemoryDesc>(MKLDNNExtensionUtils::DataTypeToIEPrecision(
             static_cast<mkldnn::memory::data_type>(desc.data.data_type)), getOutputShapeAtPort(idx));
     }
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,10 +19,16 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    bool canShareSupportedPrimitiveDescriptors() const override {
+        return true;
+    }
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
 
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
     bool canBeInPlace() const override {
         return false;
     }
@@ -55,6 +62,15 @@ private:
 
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
     void setPostOps(mkldnn::primitive_attr &attr, bool initWeights, bool initAsBinary);
+    void setPostOpsArgs(const mkldnn::primitive_attr &attr);
+
+    // Returns the primitive specialized for the given number of 'data' rows (the product of all the dims except the
+    // last one). The recently used primitives are kept, so the alternating sequence lengths don't recreate them.
+    std::shared_ptr<mkldnn::primitive> getPrimitiveForRows(size_t rows);
+
+    std::list<std::pair<size_t, std::shared_ptr<mkldnn::primitive>>> primitivesCache;
+    static const size_t primitivesCacheCapacity = 16;
+    AttrPtr pAttr;
 
     bool withBiases = false;
 
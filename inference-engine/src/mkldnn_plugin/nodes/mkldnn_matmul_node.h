@@ -21,6 +21,9 @@ public:
     void createDescriptor(const std::vector<MemoryDescPtr>& inputDesc,
                           const std::vector<MemoryDescPtr>& outputDesc) override;
     void initSupportedPrimitiveDescriptors() override;
+    bool canShareSupportedPrimitiveDescriptors() const override {
+        return true;
+    }
     MemoryDescPtr getSrcMemDesc(mkldnn::primitive_desc_iterator &primitive_desc_it, size_t idx) override;
     void createPrimitive() override;
     bool canFuse(const MKLDNNNodePtr& node) const override;
@@ -2,10 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <iterator>
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "mkldnn_memory_node.hpp"
+#include "mkldnn_concat_node.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -15,8 +18,6 @@ using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
-std::mutex MKLDNNMemoryNodeVirtualEdge::holderMutex;
-
 MKLDNNMemoryNode::MKLDNNMemoryNode(const std::shared_ptr<ngraph::Node>& op) {
     if (auto assignOp = std::dynamic_pointer_cast<ngraph::op::AssignBase>(op)) {
         _id = assignOp->get_variable_id();
@@ -27,11 +28,6 @@ MKLDNNMemoryNode::MKLDNNMemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MKLDNNMemoryOutputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!MKLDNNPlugin::one_of(op->get_type_info(),
                 ngraph::op::v3::Assign::get_type_info_static(),
                 ngraph::op::v6::Assign::get_type_info_static())) {
@@ -50,13 +46,13 @@ MKLDNNMemoryOutputNode::MKLDNNMemoryOutputNode(const std::shared_ptr<ngraph::Nod
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
     }
-    if (created()) {
-        holder = MKLDNNMemoryNodeVirtualEdge::registerOutput(this);
-    }
 }
 
-MKLDNNMemoryOutputNode::~MKLDNNMemoryOutputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
+void MKLDNNMemoryOutputNode::setInputNode(MKLDNNNode* node) {
+    inputNode = node;
+    auto inputMemoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(inputNode);
+    IE_ASSERT(inputMemoryNode != nullptr);
+    inputMemoryNode->setOutputNode(this);
 }
 
 void MKLDNNMemoryOutputNode::getSupportedDescriptors() {}
@@ -85,11 +81,6 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
 bool MKLDNNMemoryInputNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!MKLDNNPlugin::one_of(op->get_type_info(),
                 ngraph::op::v3::ReadValue::get_type_info_static(),
                 ngraph::op::v6::ReadValue::get_type_info_static())) {
@@ -108,21 +99,57 @@ MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
     }
-    if (created()) {
-        holder = MKLDNNMemoryNodeVirtualEdge::registerInput(this);
-    }
 }
 
 void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    if (isDynamicNode()) {
+        dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc().cloneWithNewDims(getInitialStateDims()));
+        initDynamicState();
+    } else {
+        dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    }
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
 }
 
+void MKLDNNMemoryInputNode::initDynamicState() {
+    const auto& dims = getOutputShapeAtPort(0).getDims();
+    const auto dynamicDim = std::find(dims.begin(), dims.end(), Shape::UNDEFINED_DIM);
+    stateAxis = dynamicDim != dims.end() ? std::distance(dims.begin(), dynamicDim) : 0;
+
+    // The key/value cache pattern: the new state is the concatenation of the state with the new rows
+    appendConcat = nullptr;
+    if (!outputNode || getChildEdges().size() != 1)
+        return;
+    auto parent = outputNode->getParentEdgeAt(0)->getParent();
+    if (parent->getType() != Concatenation || parent->getParentEdges().size() != 2 ||
+        parent->getParentEdgeAt(0)->getParent().get() != this)
+        return;
+    auto concat = dynamic_cast<MKLDNNConcatNode*>(parent.get());
+    if (!concat || concat->isOptimized() || concat->getAxis() >= dims.size() ||
+        dims[concat->getAxis()] != Shape::UNDEFINED_DIM)
+        return;
+    // the rows are appended to the dense state, and its consumers may share the state buffer
+    if (!concat->getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc->hasLayoutType(LayoutType::ncsp))
+        return;
+    for (auto& childEdge : concat->getChildEdgesAtPort(0)) {
+        if (childEdge->getChild()->isInPlace())
+            return;
+    }
+    stateAxis = concat->getAxis();
+    appendConcat = concat;
+}
+
+std::vector<VectorDims> MKLDNNMemoryInputNode::shapeInfer() const {
+    if (dynamicState)
+        return {dynamicState->GetDims()};
+    return {dataStore->getStaticDims()};
+}
+
 /**
  * Copy data from one tensor into other.
  * As is. Assume that data is dense tensor with same layout.
@@ -141,15 +168,23 @@ static void simple_copy(const MKLDNNMemory& dst, const MKLDNNMemory& src) {
     cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
 }
 
-MKLDNNMemoryInputNode::~MKLDNNMemoryInputNode() {
-    MKLDNNMemoryNodeVirtualEdge::remove(this, holder);
-}
-
 MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
+    if (dynamicState != nullptr) {
+        // the concatenation has already appended the new rows to the state
+        if (appendConcat == nullptr)
+            dynamicState->Write(new_state.GetPtr(), new_state.getStaticDims());
+        return;
+    }
+    if (nextState != nullptr) {
+        // the producer of the new state writes it directly to the bound buffer if the edge is in-place
+        if (new_state.GetPtr() != nextState)
+            cpu_memcpy(nextState, new_state.GetPtr(), new_state.GetSize());
+        return;
+    }
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
@@ -157,49 +192,124 @@ void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
+    if (dynamicState != nullptr) {
+        // the output only carries the shape of the state if the concatenation reads the state itself
+        if (appendConcat == nullptr)
+            dynamicState->Read(getChildEdgeAt(0)->getMemory().GetPtr());
+        return;
+    }
+    if (currentState != nullptr) {
+        if (!inPlaceCurrentState) {
+            auto& dstMemory = getChildEdgeAt(0)->getMemory();
+            cpu_memcpy(dstMemory.GetPtr(), currentState, dstMemory.GetSize());
+        }
+        return;
+    }
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
     simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
 }
 
-MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
-    std::lock_guard<std::mutex> lock{MKLDNNMemoryNodeVirtualEdge::holderMutex};
-    // in case of output already registered
-    auto& holder = MKLDNNMemoryNodeVirtualEdge::getExisted();
-    auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(holder, node->getId());
-    if (sibling != nullptr) {
-        auto outputNode = dynamic_cast<MKLDNNMemoryOutputNode*>(sibling);
-        IE_ASSERT(outputNode != nullptr);
-        outputNode->setInputNode(node);
-    } else {
-        holder[node->getId()] = node;
+void MKLDNNMemoryInputNode::initStateBinding() {
+    stateBindingInitialized = true;
+    const auto stateSize = dataStore->GetSize();
+    auto isDenseEdge = [stateSize](const MKLDNNEdgePtr& edge) {
+        const auto& memory = edge->getMemory();
+        return memory.GetPtr() == memory.GetData() && memory.GetSize() == stateSize;
+    };
+
+    // Same restrictions as for the network inputs: the consumers must not modify the state or share its memory
+    inPlaceCurrentState = true;
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << getName() << " contains empty child edge";
+        auto child = ce->getChild();
+        if (!isDenseEdge(ce) || child->isConstant() || child->isInPlace() ||
+            one_of(child->getType(), Output, Split)) {
+            inPlaceCurrentState = false;
+            break;
+        }
+        if (child->getType() == Concatenation) {
+            auto concat = dynamic_cast<MKLDNNConcatNode*>(child.get());
+            if (concat && concat->isOptimized()) {
+                inPlaceCurrentState = false;
+                break;
+            }
+        }
+        for (auto& edge : child->getChildEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+            if (e->getMemory().GetData() == ce->getMemory().GetData()) {
+                inPlaceCurrentState = false;
+                break;
+            }
+        }
+        if (!inPlaceCurrentState)
+            break;
     }
-    return &holder;
-}
-
-MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerOutput(MKLDNNMemoryOutputNode * node) {
-    std::lock_guard<std::mutex> lock{MKLDNNMemoryNodeVirtualEdge::holderMutex};
-    // in case of output layer
-    auto& holder = MKLDNNMemoryNodeVirtualEdge::getExisted();
-    auto sibling = MKLDNNMemoryNodeVirtualEdge::getByName(holder, node->getId());
-    if (sibling != nullptr) {
-        auto inputNode = dynamic_cast<MKLDNNMemoryInputNode*>(sibling);
-        IE_ASSERT(inputNode != nullptr);
-        node->setInputNode(inputNode);
-    } else {
-        holder[node->getId()] = node;
+
+    // Same restrictions as for the network outputs: the producer of the new state must write it only for the
+    // MemoryOutput node, besides the new state must not share memory with the current one
+    inPlaceNextState = false;
+    if (!outputNode)
+        return;
+    auto parentEdge = outputNode->getParentEdgeAt(0);
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    if (!isDenseEdge(parentEdge))
+        return;
+    for (auto& childEdge : getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (ce && ce->getMemory().GetData() == defaultPtr)
+            return;
     }
-    return &holder;
+    auto parent = parentEdge->getParent();
+    MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace() ||
+            one_of(parent->getType(), Input, MemoryInput))
+            return;
+        for (auto& edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    inPlaceNextState = true;
+}
+
+void MKLDNNMemoryInputNode::bindDynamicState(MKLDNNDynamicVariableState* state) {
+    if (!isDynamicNode())
+        IE_THROW() << "Cannot bind the dynamic state to the static node " << getName();
+    dynamicState = state;
+    if (appendConcat != nullptr)
+        appendConcat->bindAppendState(state);
 }
 
-void MKLDNNMemoryNodeVirtualEdge::remove(MKLDNNMemoryNode * node, Holder* holder) {
-    std::lock_guard<std::mutex> lock{MKLDNNMemoryNodeVirtualEdge::holderMutex};
-    if (nullptr != holder) {
-        InferenceEngine::details::erase_if(*holder, [&](const Holder::value_type & it){
-            return it.second == node;
-        });
+void MKLDNNMemoryInputNode::bindState(void* current, void* next) {
+    if (isDynamicNode())
+        IE_THROW() << "Cannot bind the static state to the dynamic node " << getName();
+    if (!stateBindingInitialized)
+        initStateBinding();
+
+    currentState = current;
+    nextState = next;
+    if (inPlaceCurrentState) {
+        for (auto& childEdge : getChildEdges()) {
+            auto ce = childEdge.lock();
+            if (ce)
+                ce->getMemory().GetPrimitivePtr()->set_data_handle(current);
+        }
     }
+    if (inPlaceNextState)
+        outputNode->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->set_data_handle(next);
 }
 
 REG_MKLDNN_PRIM_FOR(MKLDNNMemoryInputNode, MemoryInput);
@@ -5,15 +5,17 @@
 #pragma once
 
 #include <ie_common.h>
-#include "ie_algorithm.hpp"
 #include "mkldnn_input_node.h"
 #include <mkldnn_node.h>
+#include <mkldnn_memory_state.h>
 #include <string>
 #include <memory>
 #include <map>
 
 namespace MKLDNNPlugin {
 
+class MKLDNNConcatNode;
+
 class MKLDNNMemoryNode {
     std::string _id;
  public:
@@ -25,65 +27,40 @@ class MKLDNNMemoryNode {
     }
     virtual void setInputNode(MKLDNNNode *) = 0;
 };
-class MKLDNNMemoryOutputNode;
-class MKLDNNMemoryInputNode;
-
-/**
- * @brief
- * TODO: ATTENTION: this is a temporary solution, this connection should be keep in graph
- * WARNING: thread_local and holderMutex are not needed if moved into graph
- */
-class MKLDNNMemoryNodeVirtualEdge {
- public:
-    using Holder = std::map<std::string, MKLDNNMemoryNode*>;
-    static Holder & getExisted() {
-        thread_local static Holder existed;
-        return existed;
-    }
-
-    static MKLDNNMemoryNode * getByName(Holder& holder, std::string name) {
-        auto result = holder.find(name);
-        if (result != holder.end()) {
-            return result->second;
-        }
-        return nullptr;
-    }
-
-    static Holder* registerOutput(MKLDNNMemoryOutputNode * node);
-    static Holder* registerInput(MKLDNNMemoryInputNode * node);
-    static void remove(MKLDNNMemoryNode * node, Holder* holder);
-    static std::mutex holderMutex;
-};
 
 class MKLDNNMemoryOutputNode : public MKLDNNNode, public MKLDNNMemoryNode {
  public:
     MKLDNNMemoryOutputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
-    ~MKLDNNMemoryOutputNode() override;
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override {
+        execute(strm);
+    }
+    bool needShapeInfer() const override {
+        return false;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
     bool created() const override {
         return getType() == MemoryOutput;
     }
 
-    void setInputNode(MKLDNNNode* node) override {
-        inputNode = node;
-    }
+    void setInputNode(MKLDNNNode* node) override;
 
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     MKLDNNNode* inputNode = nullptr;
-    MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
 class MKLDNNMemoryInputNode : public MKLDNNInputNode, public MKLDNNMemoryNode {
 public:
     MKLDNNMemoryInputNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
-    ~MKLDNNMemoryInputNode() override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     bool created() const override {
@@ -93,15 +70,64 @@ public:
         return true;
     }
     void execute(mkldnn::stream strm) override;
+    void executeDynamicImpl(mkldnn::stream strm) override {
+        execute(strm);
+    }
+    // the output shape is the shape of the state
+    bool needShapeInfer() const override {
+        return true;
+    }
+    std::vector<VectorDims> shapeInfer() const override;
 
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
+    void setOutputNode(MKLDNNMemoryOutputNode* node) {
+        outputNode = node;
+    }
+    bool hasOutputNode() const {
+        return outputNode != nullptr;
+    }
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Binds the variable state buffers: the state is read from the current buffer and the new state is
+     * written to the next one. Where possible the buffers become the memory of the output edges of this node and
+     * of the input edge of the sibling MemoryOutput node, otherwise they are copied.
+     */
+    void bindState(void* current, void* next);
+
+    /**
+     * @brief Binds the state with a dynamic dimension. If the new state is the concatenation of the state with the new
+     * rows along this dimension, the concatenation appends them to the state in place, otherwise the state is copied
+     * to the output edge and overwritten by the new one.
+     */
+    void bindDynamicState(MKLDNNDynamicVariableState* state);
+    // the dynamic dimension of the state and its initial shape
+    size_t getStateAxis() const {
+        return stateAxis;
+    }
+    VectorDims getInitialStateDims() const {
+        return getOutputShapeAtPort(0).getMinDims();
+    }
+
  private:
+    void initStateBinding();
+    void initDynamicState();
+
     MKLDNNMemoryPtr dataStore;
-    MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
+    MKLDNNMemoryOutputNode* outputNode = nullptr;
+
+    void* currentState = nullptr;
+    void* nextState = nullptr;
+    bool stateBindingInitialized = false;
+    bool inPlaceCurrentState = false;
+    bool inPlaceNextState = false;
+
+    MKLDNNDynamicVariableState* dynamicState = nullptr;
+    size_t stateAxis = 0;
+    MKLDNNConcatNode* appendConcat = nullptr;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,363 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <mkldnn_extension_utils.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+#include "mkldnn_mha_node.h"
+#include "ngraph_transformations/op/multi_head_attention.hpp"
+#include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+// the [queryBlock, keyBlock] tile of scores, the accumulators and the K/V rows of a key block stay in L1/L2
+constexpr size_t queryBlock = 32lu;
+constexpr size_t keyBlock = 64lu;
+
+// offsets of the batch elements of an input broadcasted to the output batch dimensions, the input dims are right-aligned
+std::vector<size_t> getBatchOffsets(const VectorDims& outDims, const VectorDims& inDims, const std::string& errorPrefix) {
+    const size_t rank = outDims.size();
+    VectorDims dims(rank - inDims.size(), 1lu);
+    dims.insert(dims.end(), inDims.begin(), inDims.end());
+
+    VectorDims strides(rank, 1lu);
+    for (size_t i = rank - 1; i > 0; i--) {
+        strides[i - 1] = strides[i] * dims[i];
+    }
+    for (size_t i = 0; i < rank - 2; i++) {
+        if (dims[i] != 1 && dims[i] != outDims[i])
+            IE_THROW() << errorPrefix << " has input dimensions which can't be broadcasted to the output ones";
+    }
+
+    size_t batch = 1lu;
+    for (size_t i = 0; i < rank - 2; i++) {
+        batch *= outDims[i];
+    }
+    std::vector<size_t> offsets(batch, 0lu);
+    for (size_t b = 0; b < batch; b++) {
+        size_t index = b;
+        for (size_t i = rank - 2; i > 0; i--) {
+            const size_t coordinate = index % outDims[i - 1];
+            index /= outDims[i - 1];
+            if (dims[i - 1] != 1)
+                offsets[b] += coordinate * strides[i - 1];
+        }
+    }
+    return offsets;
+}
+
+/**
+ * Computes the output rows [q0, q1) of a single batch element. The keys are processed by blocks, the softmax is
+ * accumulated online: for each row the maximum and the sum of exponents seen so far are kept and the partial
+ * output is rescaled by exp(oldMax - newMax) when a block raises the maximum.
+ * K is read as [D, Lk] and V as [Lk, Dv] FP32 matrices, so all the inner loops run over contiguous memory
+ * without a reduction and are vectorized by the compiler.
+ */
+void attendQueryBlock(const float* q, const float* kt, const float* v, const float* mask, float* dst, size_t q0, size_t q1,
+                      const MKLDNNMultiHeadAttentionNode::AttentionShape& shape, float* scratch) {
+    const size_t D = shape.headSize;
+    const size_t Dv = shape.valueHeadSize;
+    const size_t Lq = shape.queryLength;
+    const size_t Lk = shape.keyLength;
+    const size_t rows = q1 - q0;
+
+    float* scores = scratch;
+    float* acc = scores + queryBlock * keyBlock;
+    float* rowMax = acc + queryBlock * Dv;
+    float* rowSum = rowMax + queryBlock;
+
+    const float minusInf = -std::numeric_limits<float>::infinity();
+    for (size_t i = 0; i < rows; i++) {
+        std::fill_n(acc + i * Dv, Dv, 0.f);
+        rowMax[i] = minusInf;
+        rowSum[i] = 0.f;
+    }
+
+    // the query i attends to the keys [0, i + Lk - Lq] in the causal mode, the keys after the last row limit are skipped
+    const auto lastKey = [&](size_t row) {
+        return static_cast<int64_t>(row) + static_cast<int64_t>(Lk) - static_cast<int64_t>(Lq);
+    };
+    const size_t keyEnd = shape.causal ? static_cast<size_t>(std::min(std::max<int64_t>(lastKey(q1 - 1) + 1, 0), static_cast<int64_t>(Lk)))
+                                       : Lk;
+
+    for (size_t k0 = 0; k0 < keyEnd; k0 += keyBlock) {
+        const size_t keys = std::min(keyBlock, keyEnd - k0);
+        for (size_t i = 0; i < rows; i++) {
+            const float* qRow = q + (q0 + i) * D;
+            float* sRow = scores + i * keyBlock;
+            const size_t rowKeys = shape.causal ? static_cast<size_t>(std::min(std::max<int64_t>(lastKey(q0 + i) + 1 - static_cast<int64_t>(k0), 0),
+                                                                            static_cast<int64_t>(keys)))
+                                                : keys;
+            if (rowKeys == 0)
+                continue;
+
+            // the dot products of the row with all the keys of the block are accumulated together
+            std::fill_n(sRow, rowKeys, 0.f);
+            for (size_t d = 0; d < D; d++) {
+                const float qd = qRow[d] * shape.scale;
+                const float* kRow = kt + d * Lk + k0;
+                for (size_t j = 0; j < rowKeys; j++) {
+                    sRow[j] += qd * kRow[j];
+                }
+            }
+            if (mask) {
+                const float* maskRow = mask + (q0 + i) * shape.maskQueryStride + k0 * shape.maskKeyStride;
+                for (size_t j = 0; j < rowKeys; j++) {
+                    sRow[j] += maskRow[j * shape.maskKeyStride];
+                }
+            }
+            float blockMax = minusInf;
+            for (size_t j = 0; j < rowKeys; j++) {
+                blockMax = std::max(blockMax, sRow[j]);
+            }
+            // the whole block is masked out for this row
+            if (blockMax == minusInf)
+                continue;
+
+            float* accRow = acc + i * Dv;
+            const float newMax = std::max(rowMax[i], blockMax);
+            if (newMax != rowMax[i]) {
+                const float correction = std::exp(rowMax[i] - newMax);
+                rowSum[i] *= correction;
+                for (size_t c = 0; c < Dv; c++) {
+                    accRow[c] *= correction;
+                }
+                rowMax[i] = newMax;
+            }
+            for (size_t j = 0; j < rowKeys; j++) {
+                const float p = std::exp(sRow[j] - newMax);
+                rowSum[i] += p;
+                const float* vRow = v + (k0 + j) * Dv;
+                for (size_t c = 0; c < Dv; c++) {
+                    accRow[c] += p * vRow[c];
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < rows; i++) {
+        // the rows without any visible key produce zeros
+        const float norm = rowSum[i] > 0.f ? 1.f / rowSum[i] : 0.f;
+        float* dstRow = dst + (q0 + i) * Dv;
+        for (size_t c = 0; c < Dv; c++) {
+            dstRow[c] = acc[i * Dv + c] * norm;
+        }
+    }
+}
+
+// converts a [rows, cols] matrix to FP32, the result is transposed if requested
+template <typename T>
+void packMatrix(const T* src, float* dst, size_t rows, size_t cols, bool transpose) {
+    if (transpose) {
+        for (size_t r = 0; r < rows; r++) {
+            for (size_t c = 0; c < cols; c++) {
+                dst[c * rows + r] = static_cast<float>(src[r * cols + c]);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < rows * cols; i++) {
+            dst[i] = static_cast<float>(src[i]);
+        }
+    }
+}
+}  // namespace
+
+bool MKLDNNMultiHeadAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!std::dynamic_pointer_cast<const MultiHeadAttentionNode>(op)) {
+            errorMessage = "Only MultiHeadAttention operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNMultiHeadAttentionNode::MKLDNNMultiHeadAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                           MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "MultiHeadAttention layer with name '" + getName() + "'";
+    const auto mha = std::dynamic_pointer_cast<const MultiHeadAttentionNode>(op);
+    shape.scale = mha->get_scale();
+    shape.transposeK = mha->get_transpose_k();
+    shape.causal = mha->get_causal();
+    hasMask = op->get_input_size() == 4;
+    causalMask = shape.causal && hasMask;
+    readMask = hasMask && !causalMask;
+    if (getInputShapeAtPort(0).getRank() < 2)
+        IE_THROW() << errorPrefix << " supports only inputs of rank 2 and higher";
+}
+
+void MKLDNNMultiHeadAttentionNode::getSupportedDescriptors() {
+    if (getParentEdges().size() != (hasMask ? 4 : 3))
+        IE_THROW() << errorPrefix << " has incorrect number of input edges";
+    if (getChildEdges().empty())
+        IE_THROW() << errorPrefix << " has incorrect number of output edges";
+}
+
+void MKLDNNMultiHeadAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // the scores and the accumulators are always FP32, BF16 only halves the Q/K/V traffic
+    Precision precision = getOriginalInputPrecisionAtPort(0);
+    if (precision != Precision::BF16 || !mayiuse(avx512_core))
+        precision = Precision::FP32;
+
+    std::vector<PortConfigurator> inConfs(3, {LayoutType::ncsp, precision});
+    if (hasMask)
+        inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, precision}},
+                         impl_desc_type::ref_any);
+}
+
+void MKLDNNMultiHeadAttentionNode::createPrimitive() {
+    if (inputShapesDefined()) {
+        if (needPrepareParams())
+            prepareParams();
+        updateLastInputDims();
+    }
+}
+
+void MKLDNNMultiHeadAttentionNode::prepareParams() {
+    const auto& qDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    const auto& kDims = getParentEdgeAt(1)->getMemory().getStaticDims();
+    const auto& vDims = getParentEdgeAt(2)->getMemory().getStaticDims();
+    const auto& outDims = getChildEdgeAt(0)->getMemory().getStaticDims();
+    const size_t rank = outDims.size();
+
+    shape.queryLength = qDims[rank - 2];
+    shape.headSize = qDims[rank - 1];
+    shape.keyLength = shape.transposeK ? kDims[rank - 2] : kDims[rank - 1];
+    shape.valueHeadSize = vDims[rank - 1];
+    if ((shape.transposeK ? kDims[rank - 1] : kDims[rank - 2]) != shape.headSize || vDims[rank - 2] != shape.keyLength)
+        IE_THROW() << errorPrefix << " has inconsistent Q, K and V dimensions";
+
+    queryOffsets = getBatchOffsets(outDims, qDims, errorPrefix);
+    keyOffsets = getBatchOffsets(outDims, kDims, errorPrefix);
+    valueOffsets = getBatchOffsets(outDims, vDims, errorPrefix);
+    batch = queryOffsets.size();
+
+    if (hasMask) {
+        const auto& maskDims = getParentEdgeAt(3)->getMemory().getStaticDims();
+        VectorDims scoresDims(outDims.begin(), outDims.end() - 2);
+        scoresDims.push_back(shape.queryLength);
+        scoresDims.push_back(shape.keyLength);
+        maskOffsets = getBatchOffsets(scoresDims, maskDims, errorPrefix);
+
+        const size_t maskKeys = maskDims.empty() ? 1lu : maskDims.back();
+        const size_t maskQueries = maskDims.size() < 2 ? 1lu : maskDims[maskDims.size() - 2];
+        if ((maskKeys != 1 && maskKeys != shape.keyLength) || (maskQueries != 1 && maskQueries != shape.queryLength))
+            IE_THROW() << errorPrefix << " has mask dimensions which can't be broadcasted to the attention scores";
+        shape.maskKeyStride = maskKeys == 1 ? 0lu : 1lu;
+        shape.maskQueryStride = maskQueries == 1 ? 0lu : maskKeys;
+        // the [Lq, Lk] slice of a causal mask is the causal mask itself, the broadcasted one is read as is
+        if (causalMask) {
+            shape.causal = maskQueries == shape.queryLength && maskKeys == shape.keyLength;
+            readMask = !shape.causal;
+        }
+    }
+
+    scratchSize = queryBlock * keyBlock + queryBlock * shape.valueHeadSize + 2 * queryBlock;
+    scratch.resize(scratchSize * parallel_get_max_threads());
+
+    // every batch element of K/V is converted once per inference instead of once per query block,
+    // FP32 inputs which are already in the layout of the kernel are read in place
+    const bool isFP32 = getChildEdgeAt(0)->getMemory().getDesc().getPrecision() == Precision::FP32;
+    packQueries = !isFP32;
+    packKeys = !isFP32 || shape.transposeK;
+    packValues = !isFP32;
+    packedQueries.resize(packQueries ? batch * shape.queryLength * shape.headSize : 0lu);
+    packedKeys.resize(packKeys ? batch * shape.headSize * shape.keyLength : 0lu);
+    packedValues.resize(packValues ? batch * shape.keyLength * shape.valueHeadSize : 0lu);
+    packedOutput.resize(isFP32 ? 0lu : batch * shape.queryLength * shape.valueHeadSize);
+}
+
+template <typename T>
+void MKLDNNMultiHeadAttentionNode::attentionImpl() {
+    const auto q = reinterpret_cast<const T*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const auto k = reinterpret_cast<const T*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+    const auto v = reinterpret_cast<const T*>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
+    const auto mask = readMask ? reinterpret_cast<const float*>(getParentEdgeAt(3)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto dst = reinterpret_cast<T*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t D = shape.headSize;
+    const size_t Dv = shape.valueHeadSize;
+    const size_t Lq = shape.queryLength;
+    const size_t Lk = shape.keyLength;
+
+    parallel_for(batch, [&](size_t b) {
+        if (packQueries)
+            packMatrix(q + queryOffsets[b], &packedQueries[b * Lq * D], Lq, D, false);
+        if (packKeys)
+            packMatrix(k + keyOffsets[b], &packedKeys[b * D * Lk], Lk, D, shape.transposeK);
+        if (packValues)
+            packMatrix(v + valueOffsets[b], &packedValues[b * Lk * Dv], Lk, Dv, false);
+    });
+
+    // the FP32 kernel reads the inputs in place if they are not packed, so these casts are taken only when T is float
+    const auto fp32 = [](const T* ptr) {
+        return reinterpret_cast<const float*>(ptr);
+    };
+    float* fp32Dst = packedOutput.empty() ? reinterpret_cast<float*>(dst) : packedOutput.data();
+    const size_t queryBlocks = div_up(Lq, queryBlock);
+    parallel_for2d(batch, queryBlocks, [&](size_t b, size_t qb) {
+        const size_t q0 = qb * queryBlock;
+        const size_t q1 = std::min(q0 + queryBlock, Lq);
+        const float* qPtr = packQueries ? &packedQueries[b * Lq * D] : fp32(q + queryOffsets[b]);
+        const float* kPtr = packKeys ? &packedKeys[b * D * Lk] : fp32(k + keyOffsets[b]);
+        const float* vPtr = packValues ? &packedValues[b * Lk * Dv] : fp32(v + valueOffsets[b]);
+        float* threadScratch = &scratch[parallel_get_thread_num() * scratchSize];
+        attendQueryBlock(qPtr, kPtr, vPtr, mask ? mask + maskOffsets[b] : nullptr, fp32Dst + b * Lq * Dv, q0, q1, shape, threadScratch);
+    });
+
+    if (!packedOutput.empty()) {
+        parallel_for(batch * Lq, [&](size_t row) {
+            for (size_t c = 0; c < Dv; c++) {
+                dst[row * Dv + c] = static_cast<T>(packedOutput[row * Dv + c]);
+            }
+        });
+    }
+}
+
+void MKLDNNMultiHeadAttentionNode::execute(mkldnn::stream strm) {
+    const auto precision = getChildEdgeAt(0)->getMemory().getDesc().getPrecision();
+    switch (precision) {
+        case Precision::FP32:
+            attentionImpl<float>();
+            break;
+        case Precision::BF16:
+            attentionImpl<bfloat16_t>();
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported precision: " << precision.name();
+    }
+}
+
+void MKLDNNMultiHeadAttentionNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
+bool MKLDNNMultiHeadAttentionNode::created() const {
+    return getType() == MultiHeadAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNMultiHeadAttentionNode, MultiHeadAttention)
@@ -0,0 +1,82 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Executes MultiHeadAttentionNode: softmax(scale * Q x K^T + mask) x V. The queries are processed by blocks, for each
+ * block the keys are streamed by blocks too and the softmax is computed online (the running row maximum and sum are
+ * rescaled when a new block of scores arrives), so only a [queryBlock, keyBlock] tile of scores exists at a time.
+ */
+class MKLDNNMultiHeadAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNMultiHeadAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+    // the attention shape of a single batch element
+    struct AttentionShape {
+        size_t queryLength = 0lu;
+        size_t keyLength = 0lu;
+        size_t headSize = 0lu;
+        size_t valueHeadSize = 0lu;
+        bool transposeK = true;
+        bool causal = false;
+        float scale = 1.f;
+        // zero for the broadcasted mask dimensions
+        size_t maskQueryStride = 0lu;
+        size_t maskKeyStride = 0lu;
+    };
+
+private:
+    template <typename T>
+    void attentionImpl();
+
+    bool hasMask = false;
+    // the mask input is a slice of a causal mask, it is applied without reading unless it's broadcasted to the scores
+    bool causalMask = false;
+    bool readMask = false;
+    AttentionShape shape;
+
+    // offsets of the batch elements in the inputs, the broadcasted dimensions are taken into account
+    size_t batch = 0lu;
+    std::vector<size_t> queryOffsets;
+    std::vector<size_t> keyOffsets;
+    std::vector<size_t> valueOffsets;
+    std::vector<size_t> maskOffsets;
+
+    // per thread buffers for the scores tile and the accumulators
+    std::vector<float> scratch;
+    size_t scratchSize = 0lu;
+
+    // FP32 copies of the inputs which are not in the precision or the layout of the kernel: Q is [Lq, D],
+    // K is [D, Lk] and V is [Lk, Dv] for each batch element, the BF16 output is accumulated in FP32 too
+    bool packQueries = false;
+    bool packKeys = false;
+    bool packValues = false;
+    std::vector<float> packedQueries;
+    std::vector<float> packedKeys;
+    std::vector<float> packedValues;
+    std::vector<float> packedOutput;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
@@ -21,6 +21,9 @@ public:
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    bool canShareSupportedPrimitiveDescriptors() const override {
+        return true;
+    }
     void initDescriptor(const NodeConfig& config) override;
     void createPrimitive() override;
     bool created() const override;
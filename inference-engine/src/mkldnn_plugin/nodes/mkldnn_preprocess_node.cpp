@@ -0,0 +1,451 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <mkldnn_extension_utils.h>
+#include <cpu/x64/jit_generator.hpp>
+
+#include "mkldnn_preprocess_node.h"
+#include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace {
+// number of the output pixels processed at once, the tile of FP32 values for all channels stays in L1
+constexpr size_t tileSize = 64lu;
+}  // namespace
+
+#define GET_OFF(field) offsetof(jit_preprocess_call_args, field)
+
+// computes one channel of the output pixels: the source bytes are gathered by the precomputed offsets,
+// interpolated along the row and between the two rows, then scaled and shifted
+template <cpu_isa_t isa>
+struct jit_uni_preprocess_kernel_f32 : public jit_uni_preprocess_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_preprocess_kernel_f32)
+
+    explicit jit_uni_preprocess_kernel_f32(jit_preprocess_config_params jcp) : jit_uni_preprocess_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src0, ptr[reg_params + GET_OFF(src0)]);
+        mov(reg_offset0, ptr[reg_params + GET_OFF(offset0)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        if (jcp_.is_linear) {
+            mov(reg_src1, ptr[reg_params + GET_OFF(src1)]);
+            mov(reg_offset1, ptr[reg_params + GET_OFF(offset1)]);
+            mov(reg_weight, ptr[reg_params + GET_OFF(weight)]);
+            uni_vbroadcastss(vmm_weight_h, ptr[reg_params + GET_OFF(weight_h)]);
+        }
+        uni_vbroadcastss(vmm_scale, ptr[reg_params + GET_OFF(scale)]);
+        uni_vbroadcastss(vmm_shift, ptr[reg_params + GET_OFF(shift)]);
+        mov(reg_tmp.cvt32(), 0xff);
+        vmovd(Xmm(vmm_byte_mask.getIdx()), reg_tmp.cvt32());
+        vpbroadcastd(vmm_byte_mask, Xmm(vmm_byte_mask.getIdx()));
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, step);
+            jl(main_loop_end_label, T_NEAR);
+
+            uni_vmovups(vmm_offset0, ptr[reg_offset0]);
+            gather_u8(vmm_p00, reg_src0, vmm_offset0);
+            if (jcp_.is_linear) {
+                uni_vmovups(vmm_offset1, ptr[reg_offset1]);
+                uni_vmovups(vmm_weight_w, ptr[reg_weight]);
+                gather_u8(vmm_p01, reg_src0, vmm_offset1);
+                gather_u8(vmm_p10, reg_src1, vmm_offset0);
+                gather_u8(vmm_p11, reg_src1, vmm_offset1);
+
+                // top = p00 + (p01 - p00) * weight_w, bottom = p10 + (p11 - p10) * weight_w
+                uni_vsubps(vmm_p01, vmm_p01, vmm_p00);
+                uni_vfmadd231ps(vmm_p00, vmm_p01, vmm_weight_w);
+                uni_vsubps(vmm_p11, vmm_p11, vmm_p10);
+                uni_vfmadd231ps(vmm_p10, vmm_p11, vmm_weight_w);
+                // top + (bottom - top) * weight_h
+                uni_vsubps(vmm_p10, vmm_p10, vmm_p00);
+                uni_vfmadd231ps(vmm_p00, vmm_p10, vmm_weight_h);
+            }
+            uni_vfmadd213ps(vmm_p00, vmm_scale, vmm_shift);
+            uni_vmovups(ptr[reg_dst], vmm_p00);
+
+            add(reg_offset0, step * sizeof(int));
+            if (jcp_.is_linear) {
+                add(reg_offset1, step * sizeof(int));
+                add(reg_weight, step * sizeof(float));
+            }
+            add(reg_dst, step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+        L(main_loop_end_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename utils::conditional<isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int step = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src0 = r8;
+    Xbyak::Reg64 reg_src1 = r9;
+    Xbyak::Reg64 reg_offset0 = r10;
+    Xbyak::Reg64 reg_offset1 = r11;
+    Xbyak::Reg64 reg_weight = r12;
+    Xbyak::Reg64 reg_dst = r13;
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_tmp = r15;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_weight_h = Vmm(0);
+    Vmm vmm_scale = Vmm(1);
+    Vmm vmm_shift = Vmm(2);
+    Vmm vmm_byte_mask = Vmm(3);
+    Vmm vmm_offset0 = Vmm(4);
+    Vmm vmm_offset1 = Vmm(5);
+    Vmm vmm_weight_w = Vmm(6);
+    Vmm vmm_p00 = Vmm(7);
+    Vmm vmm_p01 = Vmm(8);
+    Vmm vmm_p10 = Vmm(9);
+    Vmm vmm_p11 = Vmm(10);
+    Vmm vmm_mask = Vmm(11);
+
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    // gathers the dwords starting at the byte offsets and keeps their lowest bytes as FP32 values
+    void gather_u8(Vmm vmm_dst, const Xbyak::Reg64 &reg_src, Vmm vmm_offsets) {
+        if (isa == avx512_common) {
+            kxnorw(k_mask, k_mask, k_mask);
+            vpgatherdd(vmm_dst | k_mask, ptr[reg_src + vmm_offsets]);
+            vpandd(vmm_dst, vmm_dst, vmm_byte_mask);
+        } else {
+            uni_vpcmpeqd(vmm_mask, vmm_mask, vmm_mask);
+            vpgatherdd(vmm_dst, ptr[reg_src + vmm_offsets], vmm_mask);
+            vpand(vmm_dst, vmm_dst, vmm_byte_mask);
+        }
+        uni_vcvtdq2ps(vmm_dst, vmm_dst);
+    }
+};
+
+bool MKLDNNPreprocessNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        const auto preprocess = std::dynamic_pointer_cast<const FusedPreprocessNode>(op);
+        if (!preprocess) {
+            errorMessage = "Only FusedPreprocess operation is supported";
+            return false;
+        }
+        if (!one_of(preprocess->get_mode(), InterpolateMode::NEAREST, InterpolateMode::LINEAR, InterpolateMode::LINEAR_ONNX)) {
+            errorMessage = "Supports only nearest and linear resize modes";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNPreprocessNode::MKLDNNPreprocessNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "Preprocess layer with name '" + getName() + "'";
+    const auto preprocess = std::dynamic_pointer_cast<const FusedPreprocessNode>(op);
+    mode = preprocess->get_mode();
+    coordTransformMode = preprocess->get_coordinate_transformation_mode();
+    nearestMode = preprocess->get_nearest_mode();
+    scale = preprocess->get_scale();
+    shift = preprocess->get_shift();
+
+    const auto& srcDims = getInputShapeAtPort(0).getStaticDims();
+    const auto& dstDims = getOutputShapeAtPort(0).getStaticDims();
+    if (srcDims.size() != 4 || dstDims.size() != 4)
+        IE_THROW() << errorPrefix << " supports only 4D tensors";
+    N = srcDims[0];
+    IH = srcDims[1];
+    IW = srcDims[2];
+    C = srcDims[3];
+    OH = dstDims[2];
+    OW = dstDims[3];
+    if (scale.size() != C || shift.size() != C)
+        IE_THROW() << errorPrefix << " has incorrect number of scale/shift values";
+}
+
+void MKLDNNPreprocessNode::getSupportedDescriptors() {
+    if (getParentEdges().size() != 1)
+        IE_THROW() << errorPrefix << " has incorrect number of input edges";
+    if (getChildEdges().empty())
+        IE_THROW() << errorPrefix << " has incorrect number of output edges";
+}
+
+void MKLDNNPreprocessNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    Precision outputPrec = getOriginalOutputPrecisionAtPort(0);
+    if (outputPrec != Precision::BF16 || !mayiuse(avx512_core))
+        outputPrec = Precision::FP32;
+
+    // the blocked layout is preferred, it is what the convolution following the preprocessing consumes
+    std::vector<LayoutType> outputLayouts;
+    if (mayiuse(avx512_common)) {
+        outputLayouts.push_back(LayoutType::nCsp16c);
+    } else if (mayiuse(sse41)) {
+        outputLayouts.push_back(LayoutType::nCsp8c);
+    }
+    outputLayouts.push_back(LayoutType::ncsp);
+
+    impl_desc_type implType = impl_desc_type::ref;
+    if (mayiuse(avx512_common)) {
+        implType = impl_desc_type::jit_avx512;
+    } else if (mayiuse(avx2)) {
+        implType = impl_desc_type::jit_avx2;
+    }
+
+    for (auto layout : outputLayouts) {
+        addSupportedPrimDesc({{LayoutType::ncsp, Precision::U8}},
+                             {{layout, outputPrec}},
+                             implType);
+    }
+}
+
+MKLDNNPreprocessNode::AxisMapping MKLDNNPreprocessNode::buildAxisMapping(size_t inSize, size_t outSize) const {
+    AxisMapping mapping;
+    mapping.index0.resize(outSize);
+    mapping.index1.resize(outSize);
+    mapping.weight.resize(outSize);
+
+    const float ratio = static_cast<float>(outSize) / inSize;
+    const auto inCoordinate = [&](size_t out) {
+        const float x = static_cast<float>(out);
+        switch (coordTransformMode) {
+            case CoordinateTransformMode::HALF_PIXEL:
+                return (x + 0.5f) / ratio - 0.5f;
+            case CoordinateTransformMode::PYTORCH_HALF_PIXEL:
+                return outSize > 1 ? (x + 0.5f) / ratio - 0.5f : 0.f;
+            case CoordinateTransformMode::ASYMMETRIC:
+                return x / ratio;
+            case CoordinateTransformMode::TF_HALF_PIXEL_FOR_NN:
+                return (x + 0.5f) / ratio;
+            case CoordinateTransformMode::ALIGN_CORNERS:
+                return outSize == 1 ? 0.f : x * (inSize - 1) / (outSize - 1);
+            default:
+                IE_THROW() << errorPrefix << " has unsupported coordinate transformation mode";
+        }
+    };
+    const auto nearestIndex = [&](float coordinate) {
+        switch (nearestMode) {
+            case NearestMode::ROUND_PREFER_FLOOR:
+                return coordinate == static_cast<int>(coordinate) + 0.5f ? std::floor(coordinate) : std::round(coordinate);
+            case NearestMode::ROUND_PREFER_CEIL:
+                return std::floor(coordinate + 0.5f);
+            case NearestMode::FLOOR:
+                return std::floor(coordinate);
+            case NearestMode::CEIL:
+                return std::ceil(coordinate);
+            case NearestMode::SIMPLE:
+                return ratio < 1.f ? std::ceil(coordinate) : std::trunc(coordinate);
+            default:
+                IE_THROW() << errorPrefix << " has unsupported nearest mode";
+        }
+    };
+
+    const float maxCoordinate = static_cast<float>(inSize - 1);
+    for (size_t out = 0; out < outSize; out++) {
+        const float coordinate = inCoordinate(out);
+        if (mode == InterpolateMode::NEAREST) {
+            const float index = std::min(std::max(nearestIndex(coordinate), 0.f), maxCoordinate);
+            mapping.index0[out] = mapping.index1[out] = static_cast<size_t>(index);
+            mapping.weight[out] = 0.f;
+        } else {
+            const float clamped = std::min(std::max(coordinate, 0.f), maxCoordinate);
+            const size_t index = static_cast<size_t>(clamped);
+            mapping.index0[out] = index;
+            mapping.index1[out] = std::min(index + 1, inSize - 1);
+            mapping.weight[out] = clamped - index;
+        }
+    }
+    return mapping;
+}
+
+void MKLDNNPreprocessNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate destination memory";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate input memory";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " has unidentified preferable primitive descriptor";
+
+    mappingH = buildAxisMapping(IH, OH);
+    mappingW = buildAxisMapping(IW, OW);
+
+    jit_preprocess_config_params jcp;
+    jcp.is_linear = mode != InterpolateMode::NEAREST;
+    if (mayiuse(avx512_common)) {
+        kernel.reset(new jit_uni_preprocess_kernel_f32<avx512_common>(jcp));
+        vectorSize = cpu_isa_traits<avx512_common>::vlen / sizeof(float);
+    } else if (mayiuse(avx2)) {
+        kernel.reset(new jit_uni_preprocess_kernel_f32<avx2>(jcp));
+        vectorSize = cpu_isa_traits<avx2>::vlen / sizeof(float);
+    }
+    if (!kernel)
+        return;
+    kernel->create_ker();
+
+    offsetsW0.resize(OW);
+    offsetsW1.resize(OW);
+    const size_t srcRowSize = IW * C;
+    kernelWidth = 0lu;
+    for (size_t ow = 0; ow < OW; ow++) {
+        offsetsW0[ow] = static_cast<int>(mappingW.index0[ow] * C);
+        offsetsW1[ow] = static_cast<int>(mappingW.index1[ow] * C);
+    }
+    // the dword read for the last channel must end inside the row, the indices don't decrease along the row
+    while (kernelWidth < OW && mappingW.index1[kernelWidth] * C + C - 1 + sizeof(int) <= srcRowSize)
+        kernelWidth++;
+}
+
+void MKLDNNPreprocessNode::computeTileRef(const uint8_t *srcRow0, const uint8_t *srcRow1, float weightH, size_t c,
+                                          size_t owBegin, size_t owEnd, float *tileRow) const {
+    for (size_t ow = owBegin; ow < owEnd; ow++) {
+        const uint8_t p00 = srcRow0[mappingW.index0[ow] * C + c];
+        if (mode != InterpolateMode::NEAREST) {
+            const uint8_t p01 = srcRow0[mappingW.index1[ow] * C + c];
+            const uint8_t p10 = srcRow1[mappingW.index0[ow] * C + c];
+            const uint8_t p11 = srcRow1[mappingW.index1[ow] * C + c];
+            const float weightW = mappingW.weight[ow];
+            const float top = p00 + (p01 - p00) * weightW;
+            const float bottom = p10 + (p11 - p10) * weightW;
+            tileRow[ow - owBegin] = (top + (bottom - top) * weightH) * scale[c] + shift[c];
+        } else {
+            tileRow[ow - owBegin] = p00 * scale[c] + shift[c];
+        }
+    }
+}
+
+template <typename OutputType>
+void MKLDNNPreprocessNode::preprocessImpl() {
+    const auto* src = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    auto* dst = reinterpret_cast<OutputType*>(dstMemory.GetPtr());
+
+    // nCsp16c/nCsp8c have the channel block as the innermost dimension, ncsp is treated as the block of 1
+    const auto dstDesc = dstMemory.GetDescWithType<BlockedMemoryDesc>();
+    const auto& blockDims = dstDesc->getBlockDims();
+    const auto& dstStrides = dstDesc->getStrides();
+    const size_t blockSize = blockDims.size() == 5 ? blockDims[4] : 1lu;
+    const size_t channelBlocks = blockDims[1];
+    const size_t dstStrideN = dstStrides[0], dstStrideC = dstStrides[1], dstStrideH = dstStrides[2], dstStrideW = dstStrides[3];
+    dst += dstDesc->getOffsetPadding();
+
+    const size_t srcRowSize = IW * C;
+
+    parallel_for2d(N, OH, [&](size_t n, size_t oh) {
+        const uint8_t* srcRow0 = src + (n * IH + mappingH.index0[oh]) * srcRowSize;
+        const uint8_t* srcRow1 = src + (n * IH + mappingH.index1[oh]) * srcRowSize;
+        const float weightH = mappingH.weight[oh];
+        OutputType* dstRow = dst + n * dstStrideN + oh * dstStrideH;
+
+        // the tile is channel-planar, every channel row is computed by one kernel call
+        std::vector<float> tile(tileSize * C);
+        for (size_t ow0 = 0; ow0 < OW; ow0 += tileSize) {
+            const size_t tileWidth = std::min(tileSize, OW - ow0);
+            size_t kernelPixels = 0lu;
+            if (kernel && ow0 < kernelWidth)
+                kernelPixels = std::min(tileWidth, kernelWidth - ow0) / vectorSize * vectorSize;
+
+            for (size_t c = 0; c < C; c++) {
+                float* tileRow = &tile[c * tileSize];
+                if (kernelPixels) {
+                    jit_preprocess_call_args args;
+                    args.src0 = srcRow0 + c;
+                    args.src1 = srcRow1 + c;
+                    args.offset0 = &offsetsW0[ow0];
+                    args.offset1 = &offsetsW1[ow0];
+                    args.weight = &mappingW.weight[ow0];
+                    args.dst = tileRow;
+                    args.work_amount = kernelPixels;
+                    args.weight_h = weightH;
+                    args.scale = scale[c];
+                    args.shift = shift[c];
+                    (*kernel)(&args);
+                }
+                computeTileRef(srcRow0, srcRow1, weightH, c, ow0 + kernelPixels, ow0 + tileWidth, tileRow + kernelPixels);
+            }
+
+            // store in the destination order, the tail channels of the last block are zero padding
+            if (blockSize == 1) {
+                for (size_t c = 0; c < C; c++) {
+                    OutputType* dstPixel = dstRow + c * dstStrideC + ow0 * dstStrideW;
+                    for (size_t i = 0; i < tileWidth; i++) {
+                        dstPixel[i * dstStrideW] = static_cast<OutputType>(tile[c * tileSize + i]);
+                    }
+                }
+            } else {
+                for (size_t cb = 0; cb < channelBlocks; cb++) {
+                    const size_t c0 = cb * blockSize;
+                    const size_t channels = c0 < C ? std::min(blockSize, C - c0) : 0lu;
+                    OutputType* dstBlock = dstRow + cb * dstStrideC + ow0 * dstStrideW;
+                    for (size_t i = 0; i < tileWidth; i++) {
+                        OutputType* dstPixel = dstBlock + i * dstStrideW;
+                        for (size_t c = 0; c < channels; c++) {
+                            dstPixel[c] = static_cast<OutputType>(tile[(c0 + c) * tileSize + i]);
+                        }
+                        for (size_t c = channels; c < blockSize; c++) {
+                            dstPixel[c] = static_cast<OutputType>(0.f);
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+void MKLDNNPreprocessNode::execute(mkldnn::stream strm) {
+    const auto dstPrecision = getChildEdgeAt(0)->getMemory().getDesc().getPrecision();
+    switch (dstPrecision) {
+        case Precision::FP32:
+            preprocessImpl<float>();
+            break;
+        case Precision::BF16:
+            preprocessImpl<bfloat16_t>();
+            break;
+        default:
+            IE_THROW() << errorPrefix << " has unsupported output precision: " << dstPrecision.name();
+    }
+}
+
+bool MKLDNNPreprocessNode::created() const {
+    return getType() == Preprocess;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNPreprocessNode, Preprocess)
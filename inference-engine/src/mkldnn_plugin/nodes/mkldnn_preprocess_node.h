@@ -0,0 +1,108 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ngraph_transformations/op/fused_preprocess.hpp"
+
+namespace MKLDNNPlugin {
+
+struct jit_preprocess_config_params {
+    bool is_linear;
+};
+
+struct jit_preprocess_call_args {
+    const uint8_t *src0;   // first source row shifted to the channel
+    const uint8_t *src1;   // second source row shifted to the channel, used by the linear mode only
+    const int *offset0;    // byte offsets of the first source pixels in the rows
+    const int *offset1;    // byte offsets of the second source pixels, linear mode only
+    const float *weight;   // horizontal weights of the second source pixels, linear mode only
+    float *dst;
+    size_t work_amount;    // number of output pixels, a multiple of the vector length
+    float weight_h;
+    float scale;
+    float shift;
+};
+
+struct jit_uni_preprocess_kernel {
+    void (*ker_)(const jit_preprocess_call_args *);
+
+    void operator()(const jit_preprocess_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_preprocess_kernel(jit_preprocess_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_preprocess_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_preprocess_config_params jcp_;
+};
+
+/**
+ * Executes FusedPreprocessNode: U8 NHWC image -> resize -> x * scale + shift -> FP32/BF16 NCHW (planar or blocked)
+ * in a single pass over the output, so the intermediate FP32 tensors of the unfused subgraph are never materialized.
+ * The output rows are processed in tiles of pixels which stay in L1, the tile of every channel is computed by the
+ * JIT kernel gathering the source pixels (AVX2 and AVX-512), the remaining pixels by the reference code.
+ */
+class MKLDNNPreprocessNode : public MKLDNNNode {
+public:
+    MKLDNNPreprocessNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    using InterpolateMode = FusedPreprocessNode::InterpolateMode;
+    using CoordinateTransformMode = FusedPreprocessNode::CoordinateTransformMode;
+    using NearestMode = FusedPreprocessNode::NearestMode;
+
+    // source indices and the weight of the second one for each output coordinate along a single spatial axis
+    struct AxisMapping {
+        std::vector<size_t> index0;
+        std::vector<size_t> index1;
+        std::vector<float> weight;
+    };
+
+    AxisMapping buildAxisMapping(size_t inSize, size_t outSize) const;
+
+    template <typename OutputType>
+    void preprocessImpl();
+
+    void computeTileRef(const uint8_t *srcRow0, const uint8_t *srcRow1, float weightH, size_t c,
+                        size_t owBegin, size_t owEnd, float *tileRow) const;
+
+    InterpolateMode mode;
+    CoordinateTransformMode coordTransformMode;
+    NearestMode nearestMode;
+    std::vector<float> scale;
+    std::vector<float> shift;
+
+    size_t N = 0lu, C = 0lu, IH = 0lu, IW = 0lu, OH = 0lu, OW = 0lu;
+    AxisMapping mappingH;
+    AxisMapping mappingW;
+
+    // byte offsets of the source pixels in the rows for the kernel
+    std::vector<int> offsetsW0;
+    std::vector<int> offsetsW1;
+    // the kernel reads 4 bytes per pixel, so it processes only the output pixels which don't read past the row
+    size_t kernelWidth = 0lu;
+    size_t vectorSize = 1lu;
+    std::shared_ptr<jit_uni_preprocess_kernel> kernel;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
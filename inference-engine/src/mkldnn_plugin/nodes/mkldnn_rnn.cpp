@@ -10,6 +10,7 @@
 #include "mkldnn_input_node.h"
 #include <mkldnn_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <memory_desc/cpu_memory_desc_utils.h>
 
 #include <ngraph/node.hpp>
 
@@ -110,11 +111,6 @@ const std::map<InferenceEngine::Precision, InferenceEngine::Precision> MKLDNNRNN
 
 bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::GRUCell::get_type_info_static(),
                 ngraph::op::v0::LSTMCell::get_type_info_static(),
@@ -189,6 +185,15 @@ bool MKLDNNRNN::isSupportedOperation(const std::shared_ptr<const ngraph::Node>&
             errorMessage = "Unsupported sequence direction.";
             return false;
         }
+
+        if (isDynamicNgraphNode(op)) {
+            // only the batch and the sequence length may be dynamic, the weights are prepared once for the input size
+            const auto& dataShape = op->get_input_partial_shape(0);
+            if (dataShape.rank().is_dynamic() || dataShape[dataShape.rank().get_length() - 1].is_dynamic()) {
+                errorMessage = "Doesn't support 'data' input with dynamic rank or dynamic input size.";
+                return false;
+            }
+        }
     } catch (...) {
         return false;
     }
@@ -259,9 +264,9 @@ void MKLDNNRNN::initCell(const std::shared_ptr<ngraph::Node>& op) {
     cell_type = ie2dnnl(op);
     cell_act = ie2dnnl(rnnCellBase->get_activations()[0]);  // Works only for RNN with one gate
 
-    auto in_data_dims = op->get_input_shape(0);
-    auto in_h_state_dims = op->get_input_shape(1);
-    auto out_h_state_dims = op->get_output_shape(0);
+    const auto& in_data_dims = getInputShapeAtPort(0).getDims();
+    const auto& in_h_state_dims = getInputShapeAtPort(1).getDims();
+    const auto& out_h_state_dims = getOutputShapeAtPort(0).getDims();
 
     if (in_data_dims.size() != 2 || in_h_state_dims.size() != 2)
         IE_THROW() << "Incorrect shape of input/output ports for layer " << getName();
@@ -271,24 +276,24 @@ void MKLDNNRNN::initCell(const std::shared_ptr<ngraph::Node>& op) {
     T = 1;
     N  = in_data_dims[0];
     DC = in_data_dims[1];
-    SC = in_h_state_dims[1];
+    SC = rnnCellBase->get_hidden_size();
 
     Gb = (cell_type != mkldnn::algorithm::lbr_gru) ? G : G + 1;
 
     // Expected shapes
-    VectorDims D_shape {N, DC}, S_shape {N, SC}, S_4D_shape {L, D, N, SC};
+    VectorDims D_shape {N, DC}, S_shape {N, SC};
 
-    if (in_data_dims != D_shape
-        || in_h_state_dims != S_shape
-        || out_h_state_dims != S_shape)
+    if (!dimsEqualWeak(in_data_dims, D_shape)
+        || !dimsEqualWeak(in_h_state_dims, S_shape)
+        || !dimsEqualWeak(out_h_state_dims, S_shape))
         IE_THROW() << "Incorrect shape of input/output ports for layer " << getName();
 
     if (S == 2) {
-        auto in_c_state_dims = op->get_input_shape(2);
-        auto out_c_state_dims = op->get_output_shape(1);
+        const auto& in_c_state_dims = getInputShapeAtPort(2).getDims();
+        const auto& out_c_state_dims = getOutputShapeAtPort(1).getDims();
 
-        if (in_c_state_dims != S_shape
-            || out_c_state_dims != S_shape)
+        if (!dimsEqualWeak(in_c_state_dims, S_shape)
+            || !dimsEqualWeak(out_c_state_dims, S_shape))
             IE_THROW() << "Incorrect shape of input/output ports for layer " << getName();
     }
 }
@@ -297,23 +302,10 @@ void MKLDNNRNN::fillCellDesc() {
     runtimePrecision = getOriginalInputPrecisionAtPort(0);
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
 
-    Shape S_4D_shape(VectorDims{L, D, N, SC});
-
-    // layer input plus states
-    in_data_d.reserve(S + 1);
-    out_data_d.reserve(S + 1);
-
     // Shapes and Attributes are correct. Can start internal stuff initialization.
-    in_data_d.emplace_back(Shape(VectorDims{T, N, DC}), dataType, memory::format_tag::tnc);
-    out_data_d.emplace_back(Shape(VectorDims{T, N, SC}), dataType, memory::format_tag::tnc);
-
-    in_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
-    out_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
-
-    if (haveCellState(cell_type)) {
-        in_data_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
-        out_data_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
-    }
+    // The dynamic batch is replaced by the dummy one, the primitives for the real batch are created in prepareParams.
+    const auto dummyDims = MemoryDescUtils::makeDummyShape(getInputShapeAtPort(0)).getStaticDims();
+    fillDataDescs(dummyDims[0], T);
 
     copyWeightsData();
 
@@ -356,13 +348,13 @@ void MKLDNNRNN::initSeq(const std::shared_ptr<ngraph::Node>& op) {
     if (!one_of(op->get_output_size(), 2, 3))
         IE_THROW() << "Incorrect number of output ports for layer " << getName();
 
-    in_data_dims = op->get_input_shape(0);
-    out_data_dims = op->get_output_shape(0);
+    auto in_data_dims = getInputShapeAtPort(0).getDims();
+    auto out_data_dims = getOutputShapeAtPort(0).getDims();
 
     if (in_data_dims.size() != 3 || out_data_dims.size() != 4)
         IE_THROW() << "Incorrect shape of input/output ports for layer " << getName();
 
-    N = op->get_input_shape(1)[0];
+    N = getInputShapeAtPort(1).getDims()[0];
     nativeOrder = false;
     const auto rtInfo = op->get_rt_info();
 
@@ -381,29 +373,17 @@ void MKLDNNRNN::initSeq(const std::shared_ptr<ngraph::Node>& op) {
     SC = rnnCellBase->get_hidden_size();
 
     Gb = (cell_type != mkldnn::algorithm::lbr_gru) ? G : G + 1;
-
-    // layer input plus states
-    in_data_d.reserve(S + 1);
-    out_data_d.reserve(S + 1);
 }
 
 void MKLDNNRNN::fillSeqDesc() {
     runtimePrecision = getOriginalInputPrecisionAtPort(0);
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
 
-    Shape S_4D_shape(VectorDims{L, D, N, SC});
-
     // Try to create descriptor and corresponding configuration
-    in_data_d.emplace_back(Shape(VectorDims{in_data_dims}),  dataType, memory::format_tag::tnc);
-    out_data_d.emplace_back(Shape(VectorDims{out_data_dims}), dataType, memory::format_tag::tnc);
-
-    in_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
-    out_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
-
-    if (haveCellState(cell_type)) {
-        in_data_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
-        out_data_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
-    }
+    // The dynamic batch and sequence length are replaced by the dummy ones, the primitives for the real shapes
+    // are created in prepareParams.
+    const auto dummyDims = MemoryDescUtils::makeDummyShape(getInputShapeAtPort(0)).getStaticDims();
+    fillDataDescs(dummyDims[0], dummyDims[1]);
 
     copyWeightsData();
 
@@ -442,7 +422,7 @@ void MKLDNNRNN::fillSeqDesc() {
     out_candidate.reserve(3);
 
     if (nativeOrder) {
-        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(out_data_d[RNNInOutKind::Layer]));
+        out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{T, N, SC}), dataType, memory::format_tag::tnc));
     } else if (N == 1) {
         // WA to avoid reorder after sequence for some models
         out_candidate.emplace_back(std::make_shared<DnnlBlockedMemoryDesc>(Shape(VectorDims{N, T, SC}), dataType, memory::format_tag::tnc));
@@ -624,6 +604,10 @@ void MKLDNNRNN::copyWeightsData() {
         }
     }
 
+    // the weights of the dynamic node are reordered once for all the shapes, so their layout mustn't depend on the batch
+    if (isDynamicNode())
+        w_format = mkldnn::memory::format_tag::ldigo;
+
     if (runtimePrecision == Precision::BF16) {
         fillWeights<uint16_t>(gate_map, wIdx, rIdx);
     } else if (runtimePrecision == Precision::FP32) {
@@ -638,8 +622,30 @@ void MKLDNNRNN::copyWeightsData() {
     if (runtimePrecision == Precision::BF16 || runtimePrecision == Precision::FP32)
         fillBiases<Precision::FP32>(gate_map);
 }
-void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
-                                 const std::vector<MemoryDescPtr> &outputDesc) {
+
+void MKLDNNRNN::fillDataDescs(size_t batch, size_t seqLength) {
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
+    Shape S_4D_shape(VectorDims{L, D, batch, SC});
+
+    // layer input plus states
+    in_data_d.clear();
+    out_data_d.clear();
+    in_data_d.reserve(S + 1);
+    out_data_d.reserve(S + 1);
+
+    in_data_d.emplace_back(Shape(VectorDims{seqLength, batch, DC}), dataType, memory::format_tag::tnc);
+    out_data_d.emplace_back(Shape(VectorDims{seqLength, batch, SC}), dataType, memory::format_tag::tnc);
+
+    in_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
+    out_data_d.emplace_back(S_4D_shape, dataType, memory::format_tag::ldnc);
+
+    if (haveCellState(cell_type)) {
+        in_data_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
+        out_data_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
+    }
+}
+
+MKLDNNDescriptor MKLDNNRNN::createOpDescriptor() const {
     auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(runtimePrecision);
     auto weightsDims = MKLDNNExtensionUtils::convertToDnnlDims(VectorDims{ L, D, DC, G, SC });
     mkldnn::memory::desc w_data_d(weightsDims, dataType, w_format);
@@ -650,7 +656,7 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
 
     switch (cell_type) {
         case mkldnn::algorithm::vanilla_rnn: {
-            MKLDNNDescriptor desc(std::shared_ptr<vanilla_rnn_forward::desc>(
+            return MKLDNNDescriptor(std::shared_ptr<vanilla_rnn_forward::desc>(
                     new vanilla_rnn_forward::desc(prop_kind::forward_scoring, cell_act, direction,
                             /* In Data       */ in_data_d[RNNInOutKind::Layer].getDnnlDesc(),
                             /* In State      */ in_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
@@ -659,10 +665,9 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                             /* Bias          */ w_bias_d,
                             /* Out Data      */ out_data_d[RNNInOutKind::Layer].getDnnlDesc(),
                             /* Out State     */ out_data_d[RNNInOutKind::HiddenState].getDnnlDesc())));
-            descs.push_back(desc);
-        } break;
+        }
         case mkldnn::algorithm::vanilla_gru: {
-            MKLDNNDescriptor desc(std::shared_ptr<gru_forward::desc>(
+            return MKLDNNDescriptor(std::shared_ptr<gru_forward::desc>(
                     new gru_forward::desc(prop_kind::forward_scoring, direction,
                             /* In Data       */ in_data_d[RNNInOutKind::Layer].getDnnlDesc(),
                             /* In State      */ in_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
@@ -671,10 +676,9 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                             /* Bias          */ w_bias_d,
                             /* Out Data      */ out_data_d[RNNInOutKind::Layer].getDnnlDesc(),
                             /* Out State     */ out_data_d[RNNInOutKind::HiddenState].getDnnlDesc())));
-            descs.push_back(desc);
-        } break;
+        }
         case mkldnn::algorithm::lbr_gru: {
-            MKLDNNDescriptor desc(std::shared_ptr<lbr_gru_forward::desc>(
+            return MKLDNNDescriptor(std::shared_ptr<lbr_gru_forward::desc>(
                     new lbr_gru_forward::desc(prop_kind::forward_scoring, direction,
                             /* In Data       */ in_data_d[RNNInOutKind::Layer].getDnnlDesc(),
                             /* In State      */ in_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
@@ -683,10 +687,9 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                             /* Bias          */ w_bias_d,
                             /* Out Data      */ out_data_d[RNNInOutKind::Layer].getDnnlDesc(),
                             /* Out State     */ out_data_d[RNNInOutKind::HiddenState].getDnnlDesc())));
-            descs.push_back(desc);
-        } break;
+        }
         case mkldnn::algorithm::vanilla_lstm: {
-            MKLDNNDescriptor desc(std::shared_ptr<lstm_forward::desc>(
+            return MKLDNNDescriptor(std::shared_ptr<lstm_forward::desc>(
                     new lstm_forward::desc(prop_kind::forward_scoring, direction,
                             /* In Data       */ in_data_d[RNNInOutKind::Layer].getDnnlDesc(),
                             /* In State      */ in_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
@@ -697,11 +700,16 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                             /* Out Data      */ out_data_d[RNNInOutKind::Layer].getDnnlDesc(),
                             /* Out State     */ out_data_d[RNNInOutKind::HiddenState].getDnnlDesc(),
                             /* Out State C   */ out_data_d[RNNInOutKind::CellState].getDnnlDesc())));
-            descs.push_back(desc);
-        } break;
+        }
         default:
-            IE_THROW() << "Unknown cell type";
+            break;
     }
+    IE_THROW() << "Unknown cell type";
+}
+
+void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
+                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    descs.push_back(createOpDescriptor());
 
     // Fill supported config
     NodeConfig config;
@@ -726,6 +734,15 @@ void MKLDNNRNN::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
 }
 
 void MKLDNNRNN::createPrimitive() {
+    if (isDynamicNode()) {
+        if (inputShapesDefined()) {
+            if (needPrepareParams())
+                prepareParams();
+            updateLastInputDims();
+        }
+        return;
+    }
+
     if (cell_type == mkldnn::algorithm::vanilla_rnn) {
         auto prim_desc = createPrimitiveDescriptor<vanilla_rnn_forward::primitive_desc, vanilla_rnn_forward::desc>();
         prim.reset(new vanilla_rnn_forward(prim_desc));
@@ -743,6 +760,55 @@ void MKLDNNRNN::createPrimitive() {
     }
 }
 
+void MKLDNNRNN::prepareParams() {
+    const auto& dataDims = getParentEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    const size_t batch = dataDims[0];
+    const size_t seqLength = is_cell ? 1 : dataDims[1];
+    prim = getPrimitive(batch, seqLength);
+}
+
+std::shared_ptr<mkldnn::primitive> MKLDNNRNN::getPrimitive(size_t batch, size_t seqLength) {
+    const auto key = std::make_pair(batch, seqLength);
+    for (auto it = primitivesCache.begin(); it != primitivesCache.end(); ++it) {
+        if (it->first == key) {
+            primitivesCache.splice(primitivesCache.begin(), primitivesCache, it);
+            return it->second;
+        }
+    }
+
+    fillDataDescs(batch, seqLength);
+    MKLDNNDescriptor desc = createOpDescriptor();
+    auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
+    if (!static_cast<bool>(itpd))
+        IE_THROW() << "Primitive descriptor was not found for node " << getName() << ".";
+
+    // the weights layout is fixed (ldigo), so they are reordered once with the first primitive descriptor
+    if (internalBlobMemory.empty())
+        prepareMemory(getSelectedPrimitiveDescriptor(), itpd);
+
+    std::shared_ptr<mkldnn::primitive> primitive;
+    if (cell_type == mkldnn::algorithm::vanilla_rnn) {
+        primitive = std::make_shared<vanilla_rnn_forward>(vanilla_rnn_forward::primitive_desc(itpd.get()));
+    } else if (cell_type == mkldnn::algorithm::vanilla_gru) {
+        primitive = std::make_shared<gru_forward>(gru_forward::primitive_desc(itpd.get()));
+    } else if (cell_type == mkldnn::algorithm::lbr_gru) {
+        primitive = std::make_shared<lbr_gru_forward>(lbr_gru_forward::primitive_desc(itpd.get()));
+    } else if (cell_type == mkldnn::algorithm::vanilla_lstm) {
+        primitive = std::make_shared<lstm_forward>(lstm_forward::primitive_desc(itpd.get()));
+    } else {
+        IE_THROW() << "Unknown cell type";
+    }
+
+    primitivesCache.emplace_front(key, primitive);
+    if (primitivesCache.size() > primitivesCacheCapacity)
+        primitivesCache.pop_back();
+    return primitive;
+}
+
+void MKLDNNRNN::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
 std::shared_ptr<MemoryDesc> MKLDNNRNN::getSrcMemDesc(mkldnn::primitive_desc_iterator& primitive_desc_it, size_t idx) {
     auto desc = supportedPrimitiveDescriptors[0].getConfig().inConfs[idx].desc;
     return desc->as<BlockedMemoryDesc>()->cloneWithUndefStridesAndOffset();
@@ -8,6 +8,8 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <list>
+#include <utility>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 
 namespace MKLDNNPlugin {
@@ -27,6 +29,9 @@ public:
 
     void execute(mkldnn::stream strm) override;
 
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
     inline bool hasNativeOrder() const {
         return nativeOrder;
     }
@@ -46,6 +51,10 @@ private:
 
     void copyWeightsData();
 
+    void fillDataDescs(size_t batch, size_t seqLength);
+    MKLDNNDescriptor createOpDescriptor() const;
+    std::shared_ptr<mkldnn::primitive> getPrimitive(size_t batch, size_t seqLength);
+
 private:
     InferenceEngine::Precision runtimePrecision;
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
@@ -86,14 +95,15 @@ private:
         CellState   = 2
     };
 
-    std::vector<size_t > in_data_dims;
-    std::vector<size_t > out_data_dims;
-
     size_t wIdx = 0;
     size_t rIdx = 0;
     size_t bIdx = 0;
 
     static const std::map<InferenceEngine::Precision, InferenceEngine::Precision> weightsByLayerPrec;
+
+    /** Primitives of the dynamic node by (batch, sequence length), the most recently used first */
+    std::list<std::pair<std::pair<size_t, size_t>, std::shared_ptr<mkldnn::primitive>>> primitivesCache;
+    static const size_t primitivesCacheCapacity = 16;
 };
 
 }  // namespace MKLDNNPlugin
@@ -198,8 +198,13 @@ private:
 
 }  // namespace MKLDNNPlugin
 
-static int getNumIteration(const std::shared_ptr<const ngraph::Node>& op, const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) {
+static int getNumIteration(const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap,
+                           const std::vector<VectorDims>& inputDims, const std::vector<VectorDims>& outputDims) {
     const auto isIterable = [](const PortMap& rule) { return rule.axis != -1; };
+    // the rules over the undefined dimension (the outputs of the dynamic node) don't restrict the number of iterations
+    const auto isDefined = [](const PortMap& rule, const VectorDims& dimensions) {
+        return static_cast<std::size_t>(rule.axis) >= dimensions.size() || dimensions[rule.axis] != Shape::UNDEFINED_DIM;
+    };
 
     const auto getNumIterations = [](const PortMap& rule, const std::vector<size_t>& dimensions) -> int {
         const auto axis = rule.axis;
@@ -240,12 +245,16 @@ static int getNumIteration(const std::shared_ptr<const ngraph::Node>& op, const
             continue;
         }
 
-        if (rule.from < 0 || rule.from >= static_cast<int64_t>(op->get_input_size())) {
+        if (rule.from < 0 || rule.from >= static_cast<int64_t>(inputDims.size())) {
             IE_THROW() << R"(: Invalid "from" value: "from" = )" << rule.from
-                               << " inputs number = " << op->get_input_size() << " (out of range)";
+                               << " inputs number = " << inputDims.size() << " (out of range)";
+        }
+
+        if (!isDefined(rule, inputDims[rule.from])) {
+            continue;
         }
 
-        const auto currentNumIterations = getNumIterations(rule, op->get_input_shape(rule.from));
+        const auto currentNumIterations = getNumIterations(rule, inputDims[rule.from]);
         if (isDefault) {
             isDefault = false;
             numIterations = currentNumIterations;
@@ -259,12 +268,16 @@ static int getNumIteration(const std::shared_ptr<const ngraph::Node>& op, const
             continue;
         }
 
-        if (rule.from < 0 || rule.from >= static_cast<int64_t>(op->get_output_size())) {
+        if (rule.from < 0 || rule.from >= static_cast<int64_t>(outputDims.size())) {
             IE_THROW() << R"(: Invalid "from" value: "from" = )" << rule.from
-                               << " inputs number = " << op->get_output_size() << " (out of range)";
+                               << " inputs number = " << outputDims.size() << " (out of range)";
         }
 
-        const auto currentNumIterations = getNumIterations(rule, op->get_output_shape(rule.from));
+        if (!isDefined(rule, outputDims[rule.from])) {
+            continue;
+        }
+
+        const auto currentNumIterations = getNumIterations(rule, outputDims[rule.from]);
         if (isDefault) {
             isDefault = false;
             numIterations = currentNumIterations;
@@ -278,17 +291,33 @@ static int getNumIteration(const std::shared_ptr<const ngraph::Node>& op, const
 
 bool MKLDNNTensorIteratorNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v0::TensorIterator::get_type_info_static(),
                 ngraph::op::v5::Loop::get_type_info_static())) {
             errorMessage = "Only opset1 TensorIterator or opset5 Loop operations are supported.";
             return false;
         }
+
+        if (isDynamicNgraphNode(op)) {
+            // the number of iterations is evaluated at runtime, the body is compiled once, so its shapes must be static
+            if (op->get_type_info() != ngraph::op::v0::TensorIterator::get_type_info_static()) {
+                errorMessage = "Doesn't support Loop op with dynamic shapes";
+                return false;
+            }
+            const auto body = std::dynamic_pointer_cast<const ngraph::op::util::SubGraphOp>(op)->get_function();
+            for (const auto& param : body->get_parameters()) {
+                if (param->get_output_partial_shape(0).is_dynamic()) {
+                    errorMessage = "Doesn't support TensorIterator op with dynamic shapes of the body";
+                    return false;
+                }
+            }
+            for (const auto& result : body->get_results()) {
+                if (result->get_input_partial_shape(0).is_dynamic()) {
+                    errorMessage = "Doesn't support TensorIterator op with dynamic shapes of the body";
+                    return false;
+                }
+            }
+        }
     } catch (...) {
         return false;
     }
@@ -382,7 +411,14 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
         }
     }
 
-    n_iter = getNumIteration(ngraphOp, inputPortMap, outputPortMap);
+    if (!isDynamicNode()) {
+        std::vector<VectorDims> inputDims, outputDims;
+        for (size_t i = 0; i < inputShapes.size(); i++)
+            inputDims.push_back(getInputShapeAtPort(i).getStaticDims());
+        for (size_t i = 0; i < outputShapes.size(); i++)
+            outputDims.push_back(getOutputShapeAtPort(i).getStaticDims());
+        n_iter = getNumIteration(inputPortMap, outputPortMap, inputDims, outputDims);
+    }
 
     if (const auto loopOp = std::dynamic_pointer_cast<const ngraph::op::v5::Loop>(ngraphOp)) {
         auto spec_port = loopOp->get_special_body_ports();
@@ -408,8 +444,52 @@ void MKLDNNTensorIteratorNode::initSupportedPrimitiveDescriptors() {
 
 
 void MKLDNNTensorIteratorNode::createPrimitive() {
+    // the mappers capture the output memory as well, so it must be allocated already
+    if (inputShapesDefined() && outputShapesDefined()) {
+        if (needPrepareParams())
+            prepareParams();
+        updateLastInputDims();
+    }
+}
+
+std::vector<VectorDims> MKLDNNTensorIteratorNode::getInputDims() const {
+    std::vector<VectorDims> inputDims;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        inputDims.push_back(getParentEdgesAtPort(i)[0]->getMemory().getStaticDims());
+    return inputDims;
+}
+
+std::vector<VectorDims> MKLDNNTensorIteratorNode::shapeInfer() const {
+    std::vector<VectorDims> outputDims;
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        outputDims.push_back(getOutputShapeAtPort(i).getDims());
+    const int numIterations = getNumIteration(inputPortMap, outputPortMap, getInputDims(), outputDims);
+
+    for (const auto& rule : outputPortMap) {
+        auto dims = output_mem[rule.to]->getStaticDims();
+        if (rule.axis != -1)
+            dims[rule.axis] *= numIterations;
+        outputDims[rule.from] = dims;
+    }
+    return outputDims;
+}
+
+void MKLDNNTensorIteratorNode::prepareParams() {
     const auto &eng = getEngine();
 
+    if (isDynamicNode()) {
+        std::vector<VectorDims> outputDims;
+        for (size_t i = 0; i < outputShapes.size(); i++)
+            outputDims.push_back(getChildEdgesAtPort(i)[0]->getMemory().getStaticDims());
+        n_iter = getNumIteration(inputPortMap, outputPortMap, getInputDims(), outputDims);
+    }
+
+    // the mappers capture the external memory, so they are recreated for each new shape, the body is reused as is
+    first_mappers.clear();
+    last_mappers.clear();
+    before_mappers.clear();
+    after_mappers.clear();
+
     for (auto map_rule : inputPortMap) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
@@ -465,6 +545,10 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     }
 }
 
+void MKLDNNTensorIteratorNode::executeDynamicImpl(mkldnn::stream strm) {
+    execute(strm);
+}
+
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
     sub_graph.ResetInferCount();
 
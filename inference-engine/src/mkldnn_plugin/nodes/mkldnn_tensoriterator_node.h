@@ -66,9 +66,15 @@ public:
     bool created() const override;
     void execute(mkldnn::stream strm) override;
 
+    std::vector<VectorDims> shapeInfer() const override;
+    void prepareParams() override;
+    void executeDynamicImpl(mkldnn::stream strm) override;
+
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
 
 private:
+    std::vector<VectorDims> getInputDims() const;
+
     int n_iter = 0;
 
     MKLDNNExtensionManager::Ptr ext_mng;
@@ -3,6 +3,8 @@
 //
 
 #include <atomic>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <vector>
 #include <thread>
@@ -333,6 +335,81 @@ public:
         return ie.LoadNetwork(cnnNetwork, context, config);
     }
 
+    // the blob is written by the first load, damaged by breakBlob, detected and removed by the second load which
+    // compiles and exports the network again, and the third load imports the new blob
+    void testBrokenBlobIsRecompiled(const std::function<void(std::string& content)>& breakBlob) {
+        const char customData[] = {1, 2, 3, 4, 5, 6, 7, 8};
+        EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+        EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+        EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+        EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            ON_CALL(net, Export(_)).WillByDefault(Invoke([&](std::ostream& s) {
+                s.write(customData, sizeof(customData));
+            }));
+        });
+        auto loadWithCache = [&](Core& ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+            m_testFunction(ie);
+        };
+
+        {
+            EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+            EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+            m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+                EXPECT_CALL(net, Export(_)).Times(1);
+            });
+            testLoad(loadWithCache);
+            m_post_mock_net_callbacks.pop_back();
+        }
+
+        const auto blobs = CommonTestUtils::listFilesWithExt(m_cacheDir, "blob");
+        ASSERT_EQ(1, blobs.size());
+        std::string content;
+        {
+            std::ifstream stream(blobs.front(), std::ios_base::binary);
+            content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        }
+        breakBlob(content);
+        {
+            std::ofstream stream(blobs.front(), std::ios_base::binary | std::ios_base::trunc);
+            stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+        }
+
+        {
+            EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+            EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+            for (auto& net : networks) {
+                EXPECT_CALL(*net, Export(_)).Times(0);
+            }
+            m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+                EXPECT_CALL(net, Export(_)).WillOnce(Invoke([&](std::ostream& s) {
+                    // the new blob is written to a temporary file, so the broken one must be gone already
+                    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").empty());
+                    s.write(customData, sizeof(customData));
+                }));
+            });
+            testLoad(loadWithCache);
+            m_post_mock_net_callbacks.pop_back();
+            EXPECT_EQ(2, networks.size());
+        }
+
+        {
+            EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+            EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+            EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+            for (auto& net : networks) {
+                EXPECT_CALL(*net, Export(_)).Times(0);
+            }
+            testLoad(loadWithCache);
+        }
+    }
+
 private:
     template <class T>
     std::function<T> make_std_function(const std::string& functionName) {
@@ -461,6 +538,105 @@ TEST_P(CachingTest, TestLoad) {
     }
 }
 
+TEST_P(CachingTest, TestLoadMmap) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {CONFIG_KEY(CACHE_MMAP), CONFIG_VALUE(YES)}});
+            m_testFunction(ie);
+        });
+        EXPECT_EQ(networks.size(), 1);
+    }
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        for (auto& net : networks) {
+            EXPECT_CALL(*net, Export(_)).Times(0); // No more 'Export' for existing networks
+        }
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {CONFIG_KEY(CACHE_MMAP), CONFIG_VALUE(YES)}});
+            m_testFunction(ie);
+        });
+        EXPECT_EQ(networks.size(), 1);
+    }
+}
+
+TEST_P(CachingTest, TestCacheSizeLimit) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    {
+        // least recently used entry, evicted on the next write
+        std::ofstream stream(m_cacheDir + CommonTestUtils::FileSeparator + "outdated.blob", std::ios_base::binary);
+        stream << "SomeOutdatedBlob";
+    }
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+            EXPECT_CALL(net, Export(_)).Times(1);
+        });
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {CONFIG_KEY(CACHE_SIZE_LIMIT), "1"}});
+            m_testFunction(ie);
+        });
+        // the entry which has just been written is never evicted
+        EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 1);
+    }
+    m_post_mock_net_callbacks.pop_back();
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(!m_remoteContext ? 1 : 0);
+        for (auto& net : networks) {
+            EXPECT_CALL(*net, Export(_)).Times(0);
+        }
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {CONFIG_KEY(CACHE_SIZE_LIMIT), "1"}});
+            m_testFunction(ie);
+        });
+    }
+}
+
+TEST_P(CachingTest, TestCorruptedBlobIsRecompiled) {
+    testBrokenBlobIsRecompiled([](std::string& content) {
+        ASSERT_FALSE(content.empty());
+        content.back() ^= 0x20;
+    });
+}
+
+TEST_P(CachingTest, TestTruncatedBlobIsRecompiled) {
+    testBrokenBlobIsRecompiled([](std::string& content) {
+        ASSERT_GT(content.size(), 4);
+        content.resize(content.size() - 4);
+    });
+}
+
+TEST_P(CachingTest, TestWrongCacheSizeLimit) {
+    Core ie;
+    for (const std::string value : {"-1", "+1", " 1", "1k", "", "abc", "99999999999999999999999"}) {
+        ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_SIZE_LIMIT), value}}), InferenceEngine::Exception) << value;
+    }
+    ASSERT_NO_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_SIZE_LIMIT), "0"}}));
+}
+
 TEST_P(CachingTest, TestLoadCustomImportExport) {
     const char customData[] = {1, 2, 3, 4, 5};
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
@@ -0,0 +1,128 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_parallel.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <transformations/rt_info/attributes.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "manager.hpp"
+#include "transformations/serialize.hpp"
+
+using namespace ngraph;
+
+namespace {
+// the layers and edges of the IR are parsed by the threads of the current arena, a single thread parses them in order
+template <typename F>
+void run_single_threaded(const F& func) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    tbb::task_arena arena(1);
+    arena.execute(func);
+#elif IE_THREAD == IE_THREAD_OMP
+    const auto threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    func();
+    omp_set_num_threads(threads);
+#else
+    func();
+#endif
+}
+
+// the branches share the input and are concatenated, so the topological order of the layers differs from their ids
+std::shared_ptr<Function> makeMultiLayerFunction(size_t numBranches, size_t depth) {
+    auto data = std::make_shared<ov::opset8::Parameter>(element::f32, Shape{1, 8});
+    data->set_friendly_name("data");
+    OutputVector branches;
+    for (size_t b = 0; b < numBranches; b++) {
+        Output<Node> branch = data;
+        for (size_t d = 0; d < depth; d++) {
+            const auto name = "branch" + std::to_string(b) + "_" + std::to_string(d);
+            std::vector<float> values(8);
+            for (size_t i = 0; i < values.size(); i++) {
+                values[i] = static_cast<float>(b * depth + d) + static_cast<float>(i) / 8.f;
+            }
+            auto constant = ov::opset8::Constant::create(element::f32, Shape{1, 8}, values);
+            constant->set_friendly_name(name + "_const");
+            auto add = std::make_shared<ov::opset8::Add>(branch, constant);
+            add->set_friendly_name(name + "_add");
+            add->get_rt_info()[FusedNames::get_type_info_static()] = FusedNames(name + "_fused");
+            auto relu = std::make_shared<ov::opset8::Relu>(add);
+            relu->set_friendly_name(name + "_relu");
+            relu->output(0).get_tensor().set_names({name + "_tensor"});
+            branch = relu;
+        }
+        branches.push_back(branch);
+    }
+    auto concat = std::make_shared<ov::opset8::Concat>(branches, 1);
+    concat->set_friendly_name("concat");
+    auto result = std::make_shared<ov::opset8::Result>(concat);
+    return std::make_shared<Function>(ResultVector{result}, ParameterVector{data});
+}
+}  // namespace
+
+class ParallelDeserializationTest : public CommonTestUtils::TestsCommon {
+protected:
+    std::string test_name = GetTestName() + "_" + GetTimestamp();
+    std::string m_out_xml_path = test_name + ".xml";
+    std::string m_out_bin_path = test_name + ".bin";
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(m_out_xml_path, m_out_bin_path);
+    }
+
+    std::shared_ptr<Function> readWithIRFrontend() {
+        ov::AnyVector params{m_out_xml_path, m_out_bin_path};
+        auto FE = manager.load_by_model(params);
+        if (!FE)
+            return nullptr;
+        auto inputModel = FE->load(params);
+        return inputModel ? FE->convert(inputModel) : nullptr;
+    }
+
+private:
+    ov::frontend::FrontEndManager manager;
+};
+
+TEST_F(ParallelDeserializationTest, ParallelResultMatchesSequential) {
+    pass::Manager m;
+    m.register_pass<pass::Serialize>(m_out_xml_path, m_out_bin_path);
+    m.run_passes(makeMultiLayerFunction(8, 16));
+
+    std::shared_ptr<Function> sequential;
+    run_single_threaded([&] {
+        sequential = readWithIRFrontend();
+    });
+    auto parallel = readWithIRFrontend();
+    ASSERT_NE(nullptr, sequential);
+    ASSERT_NE(nullptr, parallel);
+
+    const auto comparator = FunctionsComparator::with_default()
+                                .enable(FunctionsComparator::CONST_VALUES)
+                                .enable(FunctionsComparator::NAMES)
+                                .enable(FunctionsComparator::RUNTIME_KEYS)
+                                .enable(FunctionsComparator::ATTRIBUTES)
+                                .enable(FunctionsComparator::TENSOR_NAMES);
+    const auto res = comparator.compare(parallel, sequential);
+    ASSERT_TRUE(res.valid) << res.message;
+
+    // the comparator walks the graphs from the results, so the order of the nodes is checked separately
+    const auto sequentialOps = sequential->get_ordered_ops();
+    const auto parallelOps = parallel->get_ordered_ops();
+    ASSERT_EQ(sequentialOps.size(), parallelOps.size());
+    for (size_t i = 0; i < sequentialOps.size(); i++) {
+        ASSERT_EQ(sequentialOps[i]->get_friendly_name(), parallelOps[i]->get_friendly_name()) << "at " << i;
+        const auto& sequentialInfo = sequentialOps[i]->get_rt_info();
+        const auto& parallelInfo = parallelOps[i]->get_rt_info();
+        ASSERT_EQ(sequentialInfo.size(), parallelInfo.size()) << sequentialOps[i]->get_friendly_name();
+        const std::string& key = FusedNames::get_type_info_static();
+        ASSERT_EQ(sequentialInfo.count(key), parallelInfo.count(key)) << sequentialOps[i]->get_friendly_name();
+        if (sequentialInfo.count(key)) {
+            ASSERT_EQ(sequentialInfo.at(key).as<FusedNames>().getNames(),
+                      parallelInfo.at(key).as<FusedNames>().getNames());
+        }
+    }
+}
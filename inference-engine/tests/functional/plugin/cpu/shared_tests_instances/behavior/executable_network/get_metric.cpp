@@ -49,6 +49,21 @@ INSTANTIATE_TEST_SUITE_P(
         smoke_IEClassExecutableNetworkSetConfigTest, IEClassExecutableNetworkSetConfigTest,
         ::testing::Values("CPU"));
 
+INSTANTIATE_TEST_SUITE_P(
+        smoke_IEClassExecutableNetworkSupportedConfigTest, IEClassExecutableNetworkSupportedConfigTest,
+        ::testing::Combine(::testing::Values("CPU"),
+                           ::testing::Values(std::make_pair(CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "1"),
+                                             std::make_pair(CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "4"),
+                                             std::make_pair(CONFIG_KEY(PERFORMANCE_HINT), CONFIG_VALUE(LATENCY)),
+                                             std::make_pair(CONFIG_KEY(PERFORMANCE_HINT), CONFIG_VALUE(THROUGHPUT)))));
+
+INSTANTIATE_TEST_SUITE_P(
+        smoke_IEClassExecutableNetworkUnsupportedConfigTest, IEClassExecutableNetworkUnsupportedConfigTest,
+        ::testing::Combine(::testing::Values("CPU"),
+                           ::testing::Values(std::make_pair(CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "OFF"),
+                                             std::make_pair(CONFIG_KEY(PERFORMANCE_HINT), "NONE"),
+                                             std::make_pair(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS), CONFIG_VALUE(YES)))));
+
 //
 // Hetero Executable Network GetMetric
 //
@@ -0,0 +1,84 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_tensor_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+using BinaryConvolutionDynamicCPUTestParams = std::tuple<ov::test::InputShape,  // data shape [N, C, H, W]
+                                                         ngraph::op::PadType,
+                                                         float>;                // pad value
+
+// the batch and the spatial dimensions change between the inferences, the SAME_* paddings are updated for each shape
+class BinaryConvolutionLayerCPUDynamicTest : public testing::WithParamInterface<BinaryConvolutionDynamicCPUTestParams>,
+                                             virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<BinaryConvolutionDynamicCPUTestParams> obj) {
+        ov::test::InputShape shape;
+        ngraph::op::PadType padType;
+        float padValue;
+        std::tie(shape, padType, padValue) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+        for (const auto& item : shape.second) {
+            result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "AP=" << padType << "_";
+        result << "PV=" << padValue;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        ov::test::InputShape shape;
+        ngraph::op::PadType padType;
+        float padValue;
+        std::tie(shape, padType, padValue) = this->GetParam();
+
+        init_input_shapes({shape});
+        auto params = ngraph::builder::makeDynamicParams(ngraph::element::f32, inputDynamicShapes);
+        auto binaryConvolution = ngraph::builder::makeBinaryConvolution(params[0], {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, padType, 8, padValue);
+        function = std::make_shared<ngraph::Function>(binaryConvolution->outputs(), params, "binary_convolution_dynamic");
+    }
+
+    // the binary convolution treats the data as bits, so the inputs are zeros and ones
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInput = function->inputs().front();
+        auto tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes.front(), 2, 0, 1);
+        inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+    }
+};
+
+TEST_P(BinaryConvolutionLayerCPUDynamicTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNodeOfTypeCount(executableNetwork, "BinaryConvolution", 1);
+}
+
+namespace {
+
+// a shape is repeated to check the cached kernels are reused
+const std::vector<ov::test::InputShape> dynamicShapes = {
+    {{-1, 16, -1, -1}, {{1, 16, 5, 5}, {2, 16, 9, 7}, {1, 16, 3, 11}, {1, 16, 5, 5}}},
+    {{{1, 3}, 16, {3, 12}, {3, 12}}, {{3, 16, 12, 3}, {1, 16, 6, 6}, {3, 16, 12, 3}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_BinaryConvolution_Dynamic, BinaryConvolutionLayerCPUDynamicTest,
+                         ::testing::Combine(::testing::ValuesIn(dynamicShapes),
+                                            ::testing::Values(ngraph::op::PadType::EXPLICIT, ngraph::op::PadType::SAME_UPPER,
+                                                              ngraph::op::PadType::SAME_LOWER),
+                                            ::testing::Values(0.f, 1.f)),
+                         BinaryConvolutionLayerCPUDynamicTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
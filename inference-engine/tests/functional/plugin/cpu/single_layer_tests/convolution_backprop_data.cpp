@@ -6,6 +6,7 @@
 #include "test_utils/convolution_params.hpp"
 #include "test_utils/fusing_test_utils.hpp"
 #include "shared_test_classes/base/layer_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
 #include "ngraph_functions/utils/ngraph_helpers.hpp"
 #include "ngraph_functions/builders.hpp"
 #include <shared_test_classes/single_layer/convolution_backprop_data.hpp>
@@ -117,6 +118,49 @@ TEST_P(DeconvolutionLayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(executableNetwork, "Deconvolution");
 }
 
+using DeconvolutionDynamicCPUTestParams = std::tuple<ov::test::InputShape,  // data shape [N, C, H, W]
+                                                     ngraph::op::PadType>;
+
+// the batch and the spatial dimensions change between the inferences, the SAME_* paddings are updated for each shape
+class DeconvolutionLayerCPUDynamicTest : public testing::WithParamInterface<DeconvolutionDynamicCPUTestParams>,
+                                         virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<DeconvolutionDynamicCPUTestParams> obj) {
+        ov::test::InputShape shape;
+        ngraph::op::PadType padType;
+        std::tie(shape, padType) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+        for (const auto& item : shape.second) {
+            result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "AP=" << padType;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        ov::test::InputShape shape;
+        ngraph::op::PadType padType;
+        std::tie(shape, padType) = this->GetParam();
+
+        init_input_shapes({shape});
+        auto params = ngraph::builder::makeDynamicParams(ngraph::element::f32, inputDynamicShapes);
+        auto deconvolution = ngraph::builder::makeConvolutionBackpropData(params[0], ngraph::element::f32, {3, 3}, {2, 2}, {1, 1}, {1, 1},
+                                                                          {1, 1}, padType, 8);
+        function = std::make_shared<ngraph::Function>(deconvolution->outputs(), params, "convolutionBackpropData_dynamic");
+    }
+};
+
+TEST_P(DeconvolutionLayerCPUDynamicTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNodeOfTypeCount(executableNetwork, "Deconvolution", 1);
+}
+
 namespace {
 
 /* COMMON PARAMS */
@@ -385,5 +429,20 @@ INSTANTIATE_TEST_SUITE_P(smoke_Deconv_2D_1x1_BF16, DeconvolutionLayerCPUTest,
 
 /* ========= */
 
+/* ============= Dynamic shapes ============= */
+// a shape is repeated to check the cached primitives are reused
+const std::vector<ov::test::InputShape> dynamicShapes = {
+    {{-1, 4, -1, -1}, {{1, 4, 5, 5}, {2, 4, 9, 7}, {1, 4, 3, 11}, {1, 4, 5, 5}}},
+    {{{1, 3}, 4, {3, 12}, {3, 12}}, {{3, 4, 12, 3}, {1, 4, 6, 6}, {3, 4, 12, 3}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Deconv_2D_Dynamic_FP32, DeconvolutionLayerCPUDynamicTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(dynamicShapes),
+        ::testing::Values(ngraph::op::PadType::EXPLICIT, ngraph::op::PadType::SAME_UPPER, ngraph::op::PadType::SAME_LOWER)),
+    DeconvolutionLayerCPUDynamicTest::getTestCaseName);
+
+/* ========= */
+
 } // namespace
 } // namespace CPULayerTestsDefinitions
@@ -3,9 +3,11 @@
 //
 
 #include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
 
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include <ngraph/opsets/opset8.hpp>
 
 using namespace InferenceEngine;
 using namespace CPUTestUtils;
@@ -203,6 +205,68 @@ TEST_P(DefConvLayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(executableNetwork, "DeformableConvolution");
 }
 
+using DefConvDynamicCPUTestParams = std::tuple<ov::test::InputShape,  // data shape [N, C, H, W]
+                                               ngraph::op::PadType,
+                                               CPUSpecificParams>;
+
+// the batch and the spatial dimensions change between the inferences, the SAME_* paddings are updated for each shape
+class DefConvLayerCPUDynamicTest : public testing::WithParamInterface<DefConvDynamicCPUTestParams>,
+                                   virtual public ov::test::SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<DefConvDynamicCPUTestParams> obj) {
+        ov::test::InputShape shape;
+        ngraph::op::PadType padType;
+        CPUSpecificParams cpuParams;
+        std::tie(shape, padType, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+        for (const auto& item : shape.second) {
+            result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "AP=" << padType;
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t kernel = 3;
+    static constexpr size_t outChannels = 16;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        ov::test::InputShape shape;
+        ngraph::op::PadType padType;
+        CPUSpecificParams cpuParams;
+        std::tie(shape, padType, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+        // the offsets have the spatial dimensions of the output, they are kept by the SAME_* paddings
+        const size_t reduction = padType == ngraph::op::PadType::EXPLICIT ? kernel - 1 : 0;
+        ov::test::InputShape offsetsShape{{shape.first[0], 2 * kernel * kernel, ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {}};
+        for (const auto& target : shape.second) {
+            offsetsShape.second.push_back({target[0], 2 * kernel * kernel, target[2] - reduction, target[3] - reduction});
+        }
+        init_input_shapes({shape, offsetsShape});
+        auto params = ngraph::builder::makeDynamicParams(ngraph::element::f32, inputDynamicShapes);
+
+        const size_t inChannels = shape.first[1].get_length();
+        auto filters = ngraph::builder::makeConstant<float>(ngraph::element::f32, {outChannels, inChannels, kernel, kernel}, {}, true);
+        auto deformableConvolution = std::make_shared<ngraph::opset8::DeformableConvolution>(params[0], params[1], filters,
+                                                                                             ngraph::Strides{1, 1}, ngraph::CoordinateDiff{0, 0},
+                                                                                             ngraph::CoordinateDiff{0, 0}, ngraph::Strides{1, 1},
+                                                                                             padType);
+        function = makeNgraphFunction(ngraph::element::f32, params, deformableConvolution, "deformable_convolution_dynamic");
+    }
+};
+
+TEST_P(DefConvLayerCPUDynamicTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckPluginRelatedResults(executableNetwork, "DeformableConvolution");
+}
+
 namespace {
 
 /* CPU PARAMS */
@@ -414,5 +478,19 @@ INSTANTIATE_TEST_SUITE_P(DefConvLayoutTest3, DefConvLayerCPUTest, params3, DefCo
 INSTANTIATE_TEST_SUITE_P(DefConvLayoutTest4, DefConvLayerCPUTest, params4, DefConvLayerCPUTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(DefConvLayoutTest5, DefConvLayerCPUTest, params5, DefConvLayerCPUTest::getTestCaseName);
 
+
+// the channels are multiples of the SIMD width, so the jit kernel is selected
+const std::vector<ov::test::InputShape> dynamicShapes = {
+    {{-1, 16, -1, -1}, {{1, 16, 5, 5}, {2, 16, 9, 7}, {1, 16, 3, 11}, {1, 16, 5, 5}}},
+    {{{1, 3}, 16, {3, 12}, {3, 12}}, {{3, 16, 12, 3}, {1, 16, 6, 6}, {3, 16, 12, 3}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DefConvLayoutTest_Dynamic, DefConvLayerCPUDynamicTest,
+                         ::testing::Combine(::testing::ValuesIn(dynamicShapes),
+                                            ::testing::Values(ngraph::op::PadType::EXPLICIT, ngraph::op::PadType::SAME_UPPER,
+                                                              ngraph::op::PadType::SAME_LOWER),
+                                            ::testing::ValuesIn(filterCPUInfoForDevice())),
+                         DefConvLayerCPUDynamicTest::getTestCaseName);
+
 } // namespace
 } // namespace CPULayerTestsDefinitions
@@ -5,6 +5,9 @@
 #include "shared_test_classes/single_layer/gru_sequence.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset5.hpp>
 #include "transformations/op_conversions/bidirectional_sequences_decomposition.hpp"
 #include "transformations/op_conversions/convert_sequences_to_tensor_iterator.hpp"
 
@@ -162,6 +165,66 @@ TEST_P(GRUSequenceCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(executableNetwork, "RNNSeq");
 }
 
+using GRUSequenceDynamicCpuParams = std::tuple<ov::test::InputShape,  // data shape [N, T, input_size]
+                                               size_t>;               // hidden size
+
+// the batch and the sequence length are dynamic, the sequence lengths are the broadcasted T dimension of the data,
+// so the sequence is executed by the RNN node and isn't converted to TensorIterator
+class GRUSequenceDynamicCPUTest : public testing::WithParamInterface<GRUSequenceDynamicCpuParams>,
+                                  virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<GRUSequenceDynamicCpuParams> &obj) {
+        ov::test::InputShape dataShape;
+        size_t hiddenSize;
+        std::tie(dataShape, hiddenSize) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({dataShape.first}) << "_TS=";
+        for (const auto& item : dataShape.second) {
+            result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "hidden_size=" << hiddenSize;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        ov::test::InputShape dataShape;
+        size_t hiddenSize;
+        std::tie(dataShape, hiddenSize) = this->GetParam();
+
+        ov::test::InputShape stateShape{{dataShape.first[0], 1, static_cast<int64_t>(hiddenSize)}, {}};
+        for (const auto& target : dataShape.second) {
+            stateShape.second.push_back({target[0], 1, hiddenSize});
+        }
+        init_input_shapes({dataShape, stateShape});
+        auto params = ngraph::builder::makeDynamicParams(ngraph::element::f32, inputDynamicShapes);
+
+        auto shapeOf = std::make_shared<ngraph::opset5::ShapeOf>(params[0]);
+        auto axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto length = std::make_shared<ngraph::opset5::Gather>(shapeOf, ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {1}), axis);
+        auto batch = std::make_shared<ngraph::opset5::Gather>(shapeOf, ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {0}), axis);
+        auto seqLengths = std::make_shared<ngraph::opset5::Broadcast>(length, batch);
+
+        const size_t inputSize = dataShape.first[2].get_length();
+        auto W = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 3 * hiddenSize, inputSize}, {}, true);
+        auto R = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 3 * hiddenSize, hiddenSize}, {}, true);
+        auto B = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 3 * hiddenSize}, {}, true);
+        auto sequence = std::make_shared<ngraph::opset5::GRUSequence>(params[0], params[1], seqLengths, W, R, B, hiddenSize,
+                                                                      ngraph::op::RecurrentSequenceDirection::FORWARD);
+        function = std::make_shared<ngraph::Function>(sequence->outputs(), params, "gru_sequence_dynamic");
+    }
+};
+
+TEST_P(GRUSequenceDynamicCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNodeOfTypeCount(executableNetwork, "RNNSeq", 1);
+    CheckNodeOfTypeCount(executableNetwork, "TensorIterator", 0);
+}
+
 namespace {
 /* CPU PARAMS */
 std::vector<std::map<std::string, std::string>> additionalConfig
@@ -214,5 +277,17 @@ INSTANTIATE_TEST_SUITE_P(smoke_GRUSequenceCPUBatchSizeOne,
                                            ::testing::Values(cpuParamsBatchSizeOne),
                                            ::testing::ValuesIn(additionalConfig)),
                         GRUSequenceCPUTest::getTestCaseName);
+
+const std::vector<ov::test::InputShape> dynamicShapes = {
+    {{-1, -1, 10}, {{1, 2, 10}, {3, 7, 10}, {1, 2, 10}, {2, 1, 10}}},
+    {{-1, 5, 10}, {{2, 5, 10}, {1, 5, 10}, {4, 5, 10}}},
+    {{{1, 4}, {1, 8}, 10}, {{4, 8, 10}, {1, 1, 10}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_GRUSequenceCPU_Dynamic,
+                        GRUSequenceDynamicCPUTest,
+                        ::testing::Combine(::testing::ValuesIn(dynamicShapes),
+                                           ::testing::Values(1lu, 10lu)),
+                        GRUSequenceDynamicCPUTest::getTestCaseName);
 } // namespace
 } // namespace CPULayerTestsDefinitions
@@ -284,6 +284,52 @@ const auto testParams3D = ::testing::Combine(fullyConnectedParams3D,
 
 INSTANTIATE_TEST_SUITE_P(smoke_FC_3D, MatMulLayerCPUTest, testParams3D, MatMulLayerCPUTest::getTestCaseName);
 
+const std::vector<ShapeRelatedParams> IS_Dynamic = {
+    {
+        { //dynamic case description each pair per each input has {{dynamic shape}, {{static shape case1}, {static shape case2}, ...}
+            {{-1, 120}, {{59, 120}, {1, 120}, {128, 120}, {59, 120}}}, // input 0
+            {{120, 50}, {{120, 50}, {120, 50}, {120, 50}, {120, 50}}}  // input 1
+        },
+        {false, false}
+    },
+    {
+        { //dynamic case description each pair per each input has {{dynamic shape}, {{static shape case1}, {static shape case2}, ...}
+            {{-1, 120}, {{59, 120}, {1, 120}, {128, 120}, {59, 120}}}, // input 0
+            {{50, 120}, {{50, 120}, {50, 120}, {50, 120}, {50, 120}}}  // input 1
+        },
+        {false, true}
+    },
+    {
+        { //dynamic case description each pair per each input has {{dynamic shape}, {{static shape case1}, {static shape case2}, ...}
+            {{1, -1, 120}, {{1, 32, 120}, {1, 7, 120}, {1, 32, 120}}}, // input 0
+            {{120, 16}, {{120, 16}, {120, 16}, {120, 16}}}             // input 1
+        },
+        {false, false}
+    },
+    {
+        { //dynamic case description each pair per each input has {{dynamic shape}, {{static shape case1}, {static shape case2}, ...}
+            {{{1, 4}, {1, 64}, 120}, {{2, 10, 120}, {4, 64, 120}, {1, 1, 120}}}, // input 0
+            {{120, 5}, {{120, 5}, {120, 5}, {120, 5}}}                           // input 1
+        },
+        {false, false}
+    },
+};
+
+const auto fullyConnectedParamsDynamic = ::testing::Combine(::testing::ValuesIn(IS_Dynamic),
+                                                            ::testing::ValuesIn(netPRCs),
+                                                            ::testing::Values(ElementType::undefined),
+                                                            ::testing::Values(ElementType::undefined),
+                                                            ::testing::Values(helpers::InputLayerType::CONSTANT),
+                                                            ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                                            ::testing::ValuesIn(additionalConfig));
+
+const auto testParamsDynamic = ::testing::Combine(fullyConnectedParamsDynamic,
+                                                  ::testing::Values(MatMulNodeType::FullyConnected),
+                                                  ::testing::Values(emptyFusingSpec),
+                                                  ::testing::ValuesIn(filterSpecificParams()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_Dynamic, MatMulLayerCPUTest, testParamsDynamic, MatMulLayerCPUTest::getTestCaseName);
+
 std::vector<std::map<std::string, std::string>> filterAdditionalConfig_Brgemm() {
     std::vector<std::map<std::string, std::string>> additionalConfig = {
         std::map<std::string, std::string>{/* empty config */}
@@ -525,6 +571,40 @@ const auto testParams = ::testing::Combine(matMulParams,
 
 INSTANTIATE_TEST_SUITE_P(smoke_MM, MatMulLayerCPUTest, testParams, MatMulLayerCPUTest::getTestCaseName);
 
+// FullyConnected doesn't support the dynamic data of rank 4, so the MatMul with constant weights isn't converted to it
+const std::vector<ShapeRelatedParams> IS_Dynamic_4D_ConstWeights = {
+    {
+        { //dynamic case description each pair per each input has {{dynamic shape}, {{static shape case1}, {static shape case2}, ...}
+            {{-1, -1, -1, 120}, {{1, 2, 32, 120}, {2, 3, 7, 120}, {1, 2, 32, 120}}}, // input 0
+            {{120, 16}, {{120, 16}, {120, 16}, {120, 16}}}                         // input 1
+        },
+        {false, false}
+    },
+    {
+        { //dynamic case description each pair per each input has {{dynamic shape}, {{static shape case1}, {static shape case2}, ...}
+            {{-1, -1, -1, 120}, {{1, 1, 5, 120}, {3, 2, 10, 120}}}, // input 0
+            {{16, 120}, {{16, 120}, {16, 120}}}                     // input 1
+        },
+        {false, true}
+    },
+};
+
+const auto matMulParamsDynamic4DConstWeights = ::testing::Combine(::testing::ValuesIn(IS_Dynamic_4D_ConstWeights),
+                                                                  ::testing::ValuesIn(netPRCs),
+                                                                  ::testing::Values(ElementType::undefined),
+                                                                  ::testing::Values(ElementType::undefined),
+                                                                  ::testing::Values(helpers::InputLayerType::CONSTANT),
+                                                                  ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                                                                  ::testing::ValuesIn(additionalConfig));
+
+const auto testParamsDynamic4DConstWeights = ::testing::Combine(matMulParamsDynamic4DConstWeights,
+                                                                ::testing::Values(MatMulNodeType::MatMul),
+                                                                ::testing::Values(emptyFusingSpec),
+                                                                ::testing::ValuesIn(filterSpecificParams()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MM_Dynamic_4D_ConstWeights, MatMulLayerCPUTest, testParamsDynamic4DConstWeights,
+                         MatMulLayerCPUTest::getTestCaseName);
+
 } // namespace matmul
 
 } // namespace
@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <ngraph/opsets/opset8.hpp>
+
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+using TensorIteratorDynamicCpuParams = std::tuple<ov::test::InputShape>;  // data shape [N, T, C]
+
+/*  X[N, T, C] -> TensorIterator(slices X by T, body: h = Tanh(x_t + h)) -> Y[N, T, C], h[N, 1, C]
+    the body must be static, so only the sequence length is dynamic and it changes between the inferences
+*/
+class TensorIteratorDynamicCPUTest : public testing::WithParamInterface<TensorIteratorDynamicCpuParams>,
+                                     virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorDynamicCpuParams> &obj) {
+        ov::test::InputShape dataShape;
+        std::tie(dataShape) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({dataShape.first}) << "_TS=";
+        for (const auto& item : dataShape.second) {
+            result << CommonTestUtils::vec2str(item) << "_";
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        ov::test::InputShape dataShape;
+        std::tie(dataShape) = this->GetParam();
+
+        const auto& staticShape = dataShape.second.front();
+        const ov::Shape hiddenShape{staticShape[0], 1, staticShape[2]};
+        ov::test::InputShape stateShape{hiddenShape, std::vector<ov::Shape>(dataShape.second.size(), hiddenShape)};
+        init_input_shapes({dataShape, stateShape});
+        auto params = ngraph::builder::makeDynamicParams(ngraph::element::f32, inputDynamicShapes);
+
+        auto x = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, hiddenShape);
+        auto h = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, hiddenShape);
+        auto add = std::make_shared<ngraph::opset8::Add>(x, h);
+        auto tanh = std::make_shared<ngraph::opset8::Tanh>(add);
+        auto hOut = std::make_shared<ngraph::opset8::Result>(tanh);
+        auto body = std::make_shared<ngraph::Function>(ngraph::ResultVector{hOut}, ngraph::ParameterVector{x, h});
+
+        auto tensorIterator = std::make_shared<ngraph::opset8::TensorIterator>();
+        tensorIterator->set_function(body);
+        tensorIterator->set_sliced_input(x, params[0], 0, 1, 1, -1, 1);
+        tensorIterator->set_merged_input(h, params[1], hOut);
+        auto sequenceOut = tensorIterator->get_concatenated_slices(hOut, 0, 1, 1, -1, 1);
+        auto lastOut = tensorIterator->get_iter_value(hOut, -1);
+
+        function = std::make_shared<ngraph::Function>(ngraph::OutputVector{sequenceOut, lastOut}, params, "tensor_iterator_dynamic");
+    }
+};
+
+TEST_P(TensorIteratorDynamicCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNodeOfTypeCount(executableNetwork, "TensorIterator", 1);
+}
+
+namespace {
+
+const std::vector<ov::test::InputShape> dynamicShapes = {
+    {{2, -1, 8}, {{2, 5, 8}, {2, 1, 8}, {2, 12, 8}, {2, 5, 8}}},
+    {{1, {1, 10}, 4}, {{1, 10, 4}, {1, 3, 4}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorCPU_Dynamic,
+                        TensorIteratorDynamicCPUTest,
+                        ::testing::Combine(::testing::ValuesIn(dynamicShapes)),
+                        TensorIteratorDynamicCPUTest::getTestCaseName);
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,83 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ie_compound_blob.h>
+#include <blob_factory.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#ifdef ENABLE_GAPI_PREPROCESSING
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+constexpr size_t batch = 2lu, channels = 3lu, height = 16lu, width = 20lu;
+
+CNNNetwork makeNetwork() {
+    auto params = builder::makeParams(element::f32, {{batch, channels, height, width}});
+    auto relu = std::make_shared<opset8::Relu>(params[0]);
+    CNNNetwork network(std::make_shared<Function>(relu, params, "BatchedImagesPreprocessing"));
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->getPreProcess().setResizeAlgorithm(ResizeAlgorithm::RESIZE_BILINEAR);
+    return network;
+}
+
+// the images are filled with a single value, so the resized batch items have the same value whatever the image size
+Blob::Ptr makeImage(Precision precision, size_t imageHeight, size_t imageWidth, uint8_t value) {
+    auto image = make_blob_with_precision(TensorDesc(precision, {1, channels, imageHeight, imageWidth}, Layout::NCHW));
+    image->allocate();
+    if (precision == Precision::U8) {
+        auto data = image->buffer().as<uint8_t*>();
+        std::fill(data, data + image->size(), value);
+    } else {
+        auto data = image->buffer().as<float*>();
+        std::fill(data, data + image->size(), static_cast<float>(value));
+    }
+    return image;
+}
+}  // namespace
+
+// the CPU plugin checks the precision of the images of a compound blob since the blob has no tensor desc of its own
+TEST(BatchedImagesPreprocessingTest, smoke_InferBatchOfImagesOfDifferentSizes) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+    const auto inputName = execNet.GetInputsInfo().begin()->first;
+
+    const std::vector<uint8_t> values = {10, 200};
+    std::vector<Blob::Ptr> images = {makeImage(Precision::U8, 32, 40, values[0]), makeImage(Precision::U8, 12, 9, values[1])};
+    ASSERT_NO_THROW(request.SetBlob(inputName, make_shared_blob<BatchedBlob>(images)));
+    ASSERT_NO_THROW(request.Infer());
+
+    auto output = request.GetBlob(execNet.GetOutputsInfo().begin()->first);
+    auto outputData = output->buffer().as<const float*>();
+    const size_t batchSize = channels * height * width;
+    for (size_t b = 0; b < batch; b++) {
+        for (size_t i = 0; i < batchSize; i++) {
+            ASSERT_EQ(static_cast<float>(values[b]), outputData[b * batchSize + i]) << "batch item " << b << ", element " << i;
+        }
+    }
+}
+
+TEST(BatchedImagesPreprocessingTest, smoke_RejectImagesOfWrongPrecision) {
+    auto ie = PluginCache::get().ie();
+    auto execNet = ie->LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+    const auto inputName = execNet.GetInputsInfo().begin()->first;
+
+    std::vector<Blob::Ptr> images = {makeImage(Precision::FP32, 32, 40, 10), makeImage(Precision::FP32, 12, 9, 200)};
+    ASSERT_THROW(request.SetBlob(inputName, make_shared_blob<BatchedBlob>(images)), ParameterMismatch);
+}
+
+}  // namespace SubgraphTestsDefinitions
+
+#endif  // ENABLE_GAPI_PREPROCESSING
@@ -0,0 +1,140 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset8.hpp>
+#include "openvino/runtime/core.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ngraph;
+
+namespace CPULayerTestsDefinitions {
+
+namespace {
+constexpr size_t hidden = 4;
+
+// key/value cache: the state is concatenated with the new tokens and the result is assigned back
+std::shared_ptr<Function> makeCacheFunction(size_t batch = 1) {
+    const PartialShape shape{static_cast<int64_t>(batch), Dimension::dynamic(), hidden};
+    auto input = std::make_shared<opset8::Parameter>(element::f32, shape);
+    auto variable = std::make_shared<Variable>(VariableInfo{shape, element::f32, "cache"});
+    auto zero = opset8::Constant::create(element::f32, Shape{}, {0});
+    auto init = std::make_shared<opset8::Multiply>(input, zero);
+    auto read = std::make_shared<opset8::ReadValue>(init, variable);
+    auto concat = std::make_shared<opset8::Concat>(OutputVector{read, input}, 1);
+    auto assign = std::make_shared<opset8::Assign>(concat, variable);
+    auto result = std::make_shared<opset8::Result>(concat);
+    return std::make_shared<Function>(ResultVector{result}, SinkVector{assign}, ParameterVector{input});
+}
+
+std::vector<float> infer(ov::runtime::InferRequest& request, const std::vector<float>& tokens) {
+    ov::runtime::Tensor tensor(element::f32, Shape{1, tokens.size() / hidden, hidden});
+    std::copy(tokens.begin(), tokens.end(), tensor.data<float>());
+    request.set_input_tensor(tensor);
+    request.infer();
+    auto output = request.get_output_tensor();
+    return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+}
+
+std::vector<float> tokens(size_t count, float value) {
+    return std::vector<float>(count * hidden, value);
+}
+
+std::vector<float> concat(std::vector<float> lhs, const std::vector<float>& rhs) {
+    lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+    return lhs;
+}
+}  // namespace
+
+TEST(DynamicStateTest, smoke_AppendTrimReset) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::runtime::Core core;
+    auto request = core.compile_model(makeCacheFunction(), CommonTestUtils::DEVICE_CPU).create_infer_request();
+    auto states = request.query_state();
+    ASSERT_EQ(1, states.size());
+    auto& state = states.front();
+
+    // the state grows with each inference
+    auto expected = tokens(2, 1.f);
+    ASSERT_EQ(expected, infer(request, tokens(2, 1.f)));
+    for (int i = 2; i < 40; i++) {
+        expected = concat(expected, tokens(1, static_cast<float>(i)));
+        ASSERT_EQ(expected, infer(request, tokens(1, static_cast<float>(i))));
+    }
+    ASSERT_EQ((Shape{1, 40, hidden}), state.get_state().get_shape());
+
+    // the beam search restart from the shorter prefix
+    state.trim(3);
+    ASSERT_EQ((Shape{1, 3, hidden}), state.get_state().get_shape());
+    expected = concat(concat(tokens(2, 1.f), tokens(1, 2.f)), tokens(1, 7.f));
+    ASSERT_EQ(expected, infer(request, tokens(1, 7.f)));
+    ASSERT_ANY_THROW(state.trim(5));
+
+    state.reset();
+    ASSERT_EQ(tokens(1, 3.f), infer(request, tokens(1, 3.f)));
+
+    // the state set by the user is copied
+    ov::runtime::Tensor newState(element::f32, Shape{1, 2, hidden});
+    std::fill_n(newState.data<float>(), newState.get_size(), 5.f);
+    state.set_state(newState);
+    ASSERT_EQ(concat(tokens(2, 5.f), tokens(1, 6.f)), infer(request, tokens(1, 6.f)));
+}
+
+TEST(DynamicStateTest, smoke_SetStateChecksPrecisionAndStaticDims) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::runtime::Core core;
+    auto request = core.compile_model(makeCacheFunction(), CommonTestUtils::DEVICE_CPU).create_infer_request();
+    auto state = request.query_state().front();
+    const auto initialShape = state.get_state().get_shape();
+
+    // the same element size, but a different precision
+    ASSERT_ANY_THROW(state.set_state(ov::runtime::Tensor(element::i32, Shape{1, 2, hidden})));
+    // the batch and the hidden size are static
+    ASSERT_ANY_THROW(state.set_state(ov::runtime::Tensor(element::f32, Shape{2, 2, hidden})));
+    ASSERT_ANY_THROW(state.set_state(ov::runtime::Tensor(element::f32, Shape{1, 2, hidden + 1})));
+    ASSERT_ANY_THROW(state.set_state(ov::runtime::Tensor(element::f32, Shape{1, 2})));
+
+    // the rejected states don't change the current one
+    ASSERT_EQ(initialShape, state.get_state().get_shape());
+    ASSERT_NO_THROW(state.set_state(ov::runtime::Tensor(element::f32, Shape{1, 5, hidden})));
+    ASSERT_EQ((Shape{1, 5, hidden}), state.get_state().get_shape());
+}
+
+// the rows of the batches are not adjacent in the state buffer, so the concatenation copies the state to its output
+TEST(DynamicStateTest, smoke_AppendToStateWithBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t batch = 2;
+    ov::runtime::Core core;
+    auto request = core.compile_model(makeCacheFunction(batch), CommonTestUtils::DEVICE_CPU).create_infer_request();
+    auto state = request.query_state().front();
+
+    std::vector<std::vector<float>> expected(batch);
+    for (int i = 1; i < 20; i++) {
+        ov::runtime::Tensor tensor(element::f32, Shape{batch, 1, hidden});
+        for (size_t b = 0; b < batch; b++) {
+            const auto value = static_cast<float>(b == 0 ? i : -i);
+            std::fill_n(tensor.data<float>() + b * hidden, hidden, value);
+            expected[b] = concat(expected[b], tokens(1, value));
+        }
+        request.set_input_tensor(tensor);
+        request.infer();
+        auto output = request.get_output_tensor();
+        ASSERT_EQ((Shape{batch, static_cast<size_t>(i), hidden}), output.get_shape());
+        ASSERT_EQ(concat(expected[0], expected[1]),
+                  std::vector<float>(output.data<float>(), output.data<float>() + output.get_size()));
+    }
+
+    state.trim(2);
+    auto trimmed = state.get_state();
+    ASSERT_EQ((Shape{batch, 2, hidden}), trimmed.get_shape());
+    ASSERT_EQ(concat(concat(tokens(1, 1.f), tokens(1, 2.f)), concat(tokens(1, -1.f), tokens(1, -2.f))),
+              std::vector<float>(trimmed.data<float>(), trimmed.data<float>() + trimmed.get_size()));
+}
+
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,381 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ie_system_conf.h>
+#include <algorithm>
+#include <chrono>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+// the blocked layout the fused nodes store the planar output in when the following convolution consumes it
+cpu_memory_format_t getBlockedFormat() {
+    if (with_cpu_x86_avx512f())
+        return nChw16c;
+    if (with_cpu_x86_sse42())
+        return nChw8c;
+    return nchw;
+}
+
+std::string getExecValue(ExecutableNetwork& execNet, const std::string& nodeType, const std::string& key) {
+    auto function = execNet.GetExecGraphInfo().getFunction();
+    for (const auto& node : function->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == nodeType)
+            return rtInfo.at(key).as<std::string>();
+    }
+    IE_THROW() << "No node of type " << nodeType << " in the executable graph";
+}
+
+cpu_memory_format_t getOutputFormat(ExecutableNetwork& execNet, const std::string& nodeType) {
+    return CPUTestsBase::cpu_str2fmt(getExecValue(execNet, nodeType, ExecGraphInfoSerialization::OUTPUT_LAYOUTS).c_str());
+}
+
+// the fused nodes have JIT kernels on the machines with AVX2
+std::string getExpectedImplType() {
+    if (with_cpu_x86_avx512f())
+        return "jit_avx512";
+    if (with_cpu_x86_avx2())
+        return "jit_avx2";
+    return "ref";
+}
+
+template <typename F>
+double medianTimeMs(const F& func, size_t iterations) {
+    func();
+    std::vector<double> times;
+    for (size_t i = 0; i < iterations; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+std::shared_ptr<Function> makePreprocessing(const SizeVector& inputShape, const std::vector<int64_t>& outputSize,
+                                            op::v4::Interpolate::InterpolateMode mode) {
+    const size_t channels = inputShape[3];
+    auto params = builder::makeParams(element::u8, {inputShape});
+    auto convert = std::make_shared<opset4::Convert>(params[0], element::f32);
+
+    op::v4::Interpolate::InterpolateAttrs attrs;
+    attrs.mode = mode;
+    attrs.shape_calculation_mode = op::v4::Interpolate::ShapeCalcMode::SIZES;
+    attrs.coordinate_transformation_mode = op::v4::Interpolate::CoordinateTransformMode::HALF_PIXEL;
+    attrs.nearest_mode = op::v4::Interpolate::NearestMode::ROUND_PREFER_FLOOR;
+    auto sizes = opset4::Constant::create(element::i64, Shape{2}, outputSize);
+    auto scales = opset4::Constant::create(element::f32, Shape{2}, {1.f, 1.f});
+    auto axes = opset4::Constant::create(element::i64, Shape{2}, {1, 2});
+    auto interpolate = std::make_shared<opset4::Interpolate>(convert, sizes, scales, axes, attrs);
+
+    std::vector<float> mean(channels), scale(channels);
+    for (size_t c = 0; c < channels; c++) {
+        mean[c] = 100.f + c;
+        scale[c] = 1.f / (50.f + c);
+    }
+    auto subtract = std::make_shared<opset4::Subtract>(interpolate, opset4::Constant::create(element::f32, Shape{1, 1, 1, channels}, mean));
+    auto multiply = std::make_shared<opset4::Multiply>(subtract, opset4::Constant::create(element::f32, Shape{1, 1, 1, channels}, scale));
+    auto order = opset4::Constant::create(element::i64, Shape{4}, {0, 3, 1, 2});
+    auto transpose = std::make_shared<opset4::Transpose>(multiply, order);
+    return std::make_shared<Function>(transpose, params, "FusePreprocessing");
+}
+
+std::shared_ptr<Node> makeConsumer(const std::shared_ptr<Node>& output) {
+    return builder::makeConvolution(output, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, op::PadType::EXPLICIT, 16);
+}
+}  // namespace
+
+using FusePreprocessingTestParams = std::tuple<SizeVector,                         // input shape (NHWC)
+                                               std::vector<int64_t>,               // output spatial size
+                                               op::v4::Interpolate::InterpolateMode,
+                                               bool>;                              // followed by Convolution
+
+/*  FusePreprocessingTest graph, all the nodes except Input are expected to be fused into a single Preprocess node
+      -----------
+      |Input U8 |
+      -----------
+           |
+      -----------
+      | Convert |
+      -----------
+           |
+    ---------------
+    | Interpolate |
+    ---------------
+           |
+      -----------
+      |Subtract |
+      -----------
+           |
+      -----------
+      |Multiply |
+      -----------
+           |
+      -----------
+      |Transpose|
+      -----------
+           |
+    ---------------
+    |[Convolution]|
+    ---------------
+           |
+      -----------
+      | Output  |
+      -----------
+*/
+
+class FusePreprocessingTest : public testing::WithParamInterface<FusePreprocessingTestParams>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FusePreprocessingTestParams> obj) {
+        SizeVector inputShape;
+        std::vector<int64_t> outputSize;
+        op::v4::Interpolate::InterpolateMode mode;
+        bool withConvolution;
+        std::tie(inputShape, outputSize, mode, withConvolution) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OS=" << CommonTestUtils::vec2str(outputSize) << "_";
+        result << "Mode=" << mode;
+        if (withConvolution)
+            result << "_Convolution";
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        std::vector<int64_t> outputSize;
+        op::v4::Interpolate::InterpolateMode mode;
+        std::tie(inputShape, outputSize, mode, withConvolution) = this->GetParam();
+
+        function = makePreprocessing(inputShape, outputSize, mode);
+        if (withConvolution) {
+            auto result = makeConsumer(function->get_results()[0]->get_input_node_shared_ptr(0));
+            function = std::make_shared<Function>(result, function->get_parameters(), "FusePreprocessing");
+        }
+    }
+
+    bool withConvolution = false;
+};
+
+TEST_P(FusePreprocessingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "Preprocess", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Interpolate", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Transpose", 0);
+    ASSERT_EQ(getExpectedImplType(), getExecValue(executableNetwork, "Preprocess", ExecGraphInfoSerialization::IMPL_TYPE));
+    if (withConvolution)
+        ASSERT_EQ(getBlockedFormat(), getOutputFormat(executableNetwork, "Preprocess"));
+}
+
+// the fused node replaces the resize done by the G-API preprocessing of the input followed by the normalization in the graph,
+// it must not be noticeably slower on the typical camera frame
+TEST(FusePreprocessingPerfTest, smoke_NotSlowerThanGAPIPreprocessing) {
+    if (!with_cpu_x86_avx2())
+        GTEST_SKIP();
+    const size_t IH = 480, IW = 640, C = 3;
+    const std::vector<int64_t> outputSize = {224, 224};
+    auto ie = PluginCache::get().ie();
+
+    auto fusedNet = ie->LoadNetwork(CNNNetwork(makePreprocessing({1, IH, IW, C}, outputSize, op::v4::Interpolate::InterpolateMode::LINEAR)),
+                                    CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(getExpectedImplType(), getExecValue(fusedNet, "Preprocess", ExecGraphInfoSerialization::IMPL_TYPE));
+    auto fusedRequest = fusedNet.CreateInferRequest();
+    fusedRequest.SetBlob(fusedNet.GetInputsInfo().begin()->first,
+                         FuncTestUtils::createAndFillBlob(TensorDesc(Precision::U8, {1, IH, IW, C}, Layout::NHWC)));
+
+    auto params = builder::makeParams(element::f32, {{1, C, static_cast<size_t>(outputSize[0]), static_cast<size_t>(outputSize[1])}});
+    auto subtract = std::make_shared<opset4::Subtract>(params[0], opset4::Constant::create(element::f32, Shape{1, C, 1, 1}, {100.f, 101.f, 102.f}));
+    auto multiply = std::make_shared<opset4::Multiply>(subtract, opset4::Constant::create(element::f32, Shape{1, C, 1, 1}, {0.02f, 0.019f, 0.018f}));
+    CNNNetwork gapiNetwork(std::make_shared<Function>(multiply, params, "GAPIPreprocessing"));
+    auto inputInfo = gapiNetwork.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(Precision::U8);
+    inputInfo->setLayout(Layout::NHWC);
+    inputInfo->getPreProcess().setResizeAlgorithm(ResizeAlgorithm::RESIZE_BILINEAR);
+    auto gapiNet = ie->LoadNetwork(gapiNetwork, CommonTestUtils::DEVICE_CPU);
+    auto gapiRequest = gapiNet.CreateInferRequest();
+    gapiRequest.SetBlob(gapiNet.GetInputsInfo().begin()->first,
+                        FuncTestUtils::createAndFillBlob(TensorDesc(Precision::U8, {1, C, IH, IW}, Layout::NHWC)));
+
+    const size_t iterations = 50;
+    const double fusedTime = medianTimeMs([&] { fusedRequest.Infer(); }, iterations);
+    const double gapiTime = medianTimeMs([&] { gapiRequest.Infer(); }, iterations);
+    std::cout << "Fused preprocessing: " << fusedTime << " ms, G-API preprocessing: " << gapiTime << " ms" << std::endl;
+    // the bound leaves room for the noise of the shared machines
+    ASSERT_LE(fusedTime, 2 * gapiTime);
+}
+
+using FuseColorConversionTestParams = std::tuple<SizeVector,  // image shape (NHW)
+                                                 bool,        // I420 or NV12
+                                                 bool,        // single plane or separate planes
+                                                 bool,        // planar (NCHW) or interleaved (NHWC) output
+                                                 bool>;       // followed by Convolution, planar output only
+
+/*  FuseColorConversionTest graph, all the nodes except Inputs are expected to be fused into a single ColorConvert node
+      ----------------
+      |Input(s) U8   |
+      ----------------
+             |
+    -------------------
+    |NV12toBGR/I420toBGR|
+    -------------------
+             |
+        -----------
+        | Convert |
+        -----------
+             |
+        -----------
+        |Subtract |
+        -----------
+             |
+        -----------
+        |Multiply |
+        -----------
+             |
+      ---------------
+      | [Transpose] |
+      ---------------
+             |
+     ---------------
+     |[Convolution]|
+     ---------------
+             |
+        -----------
+        | Output  |
+        -----------
+*/
+
+class FuseColorConversionTest : public testing::WithParamInterface<FuseColorConversionTestParams>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FuseColorConversionTestParams> obj) {
+        SizeVector imageShape;
+        bool isI420, isSinglePlane, isPlanar, withConvolution;
+        std::tie(imageShape, isI420, isSinglePlane, isPlanar, withConvolution) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(imageShape) << "_";
+        result << (isI420 ? "I420" : "NV12") << "_";
+        result << (isSinglePlane ? "SinglePlane" : "MultiPlane") << "_";
+        result << (isPlanar ? "Planar" : "Interleaved");
+        if (withConvolution)
+            result << "_Convolution";
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector imageShape;
+        bool isI420, isSinglePlane, isPlanar;
+        std::tie(imageShape, isI420, isSinglePlane, isPlanar, withConvolution) = this->GetParam();
+        const size_t N = imageShape[0], H = imageShape[1], W = imageShape[2];
+
+        std::vector<SizeVector> planeShapes;
+        if (isSinglePlane) {
+            planeShapes = {{N, H * 3 / 2, W, 1}};
+        } else if (isI420) {
+            planeShapes = {{N, H, W, 1}, {N, H / 2, W / 2, 1}, {N, H / 2, W / 2, 1}};
+        } else {
+            planeShapes = {{N, H, W, 1}, {N, H / 2, W / 2, 2}};
+        }
+        auto params = builder::makeParams(element::u8, planeShapes);
+        const auto planes = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(params));
+
+        std::shared_ptr<Node> color;
+        if (isI420) {
+            color = isSinglePlane ? std::make_shared<opset8::I420toBGR>(planes[0])
+                                  : std::make_shared<opset8::I420toBGR>(planes[0], planes[1], planes[2]);
+        } else {
+            color = isSinglePlane ? std::make_shared<opset8::NV12toBGR>(planes[0])
+                                  : std::make_shared<opset8::NV12toBGR>(planes[0], planes[1]);
+        }
+        auto convert = std::make_shared<opset8::Convert>(color, element::f32);
+        auto subtract = std::make_shared<opset8::Subtract>(convert, opset8::Constant::create(element::f32, Shape{1, 1, 1, 3}, {103.f, 116.f, 123.f}));
+        std::shared_ptr<Node> result = std::make_shared<opset8::Multiply>(subtract, opset8::Constant::create(element::f32, Shape{1, 1, 1, 3},
+                                                                                                               {0.017f, 0.018f, 0.019f}));
+        if (isPlanar) {
+            auto order = opset8::Constant::create(element::i64, Shape{4}, {0, 3, 1, 2});
+            result = std::make_shared<opset8::Transpose>(result, order);
+        }
+        if (withConvolution)
+            result = makeConsumer(result);
+
+        function = std::make_shared<Function>(result, params, "FuseColorConversion");
+    }
+
+    bool withConvolution = false;
+};
+
+TEST_P(FuseColorConversionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckNodeOfTypeCount(executableNetwork, "ColorConvert", 1);
+    CheckNodeOfTypeCount(executableNetwork, "Convert", 0);
+    CheckNodeOfTypeCount(executableNetwork, "Transpose", 0);
+    ASSERT_EQ(getExpectedImplType(), getExecValue(executableNetwork, "ColorConvert", ExecGraphInfoSerialization::IMPL_TYPE));
+    if (withConvolution)
+        ASSERT_EQ(getBlockedFormat(), getOutputFormat(executableNetwork, "ColorConvert"));
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 32, 48, 3},
+    {2, 17, 29, 4},
+};
+
+const std::vector<std::vector<int64_t>> outputSizes = {
+    {16, 24},
+    {40, 70},
+};
+
+const std::vector<op::v4::Interpolate::InterpolateMode> modes = {
+    op::v4::Interpolate::InterpolateMode::NEAREST,
+    op::v4::Interpolate::InterpolateMode::LINEAR,
+    op::v4::Interpolate::InterpolateMode::LINEAR_ONNX,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FusePreprocessing, FusePreprocessingTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(outputSizes),
+                                            ::testing::ValuesIn(modes),
+                                            ::testing::Bool()),
+                         FusePreprocessingTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseColorConversion, FuseColorConversionTest,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 16, 24}, SizeVector{2, 10, 6}, SizeVector{1, 4, 150}),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Values(false)),
+                         FuseColorConversionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseColorConversionBlocked, FuseColorConversionTest,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 16, 24}, SizeVector{2, 10, 6}),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true)),
+                         FuseColorConversionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
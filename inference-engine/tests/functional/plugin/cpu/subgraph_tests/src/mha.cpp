@@ -0,0 +1,243 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_tensor_utils.hpp"
+#include <ngraph/opsets/opset8.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+enum class MaskType {
+    NONE,
+    PADDING,  // [B, 1, 1, L] input
+    CAUSAL    // [1, 1, Lq, Lk] constant lower-triangular, sliced from the [1, 1, 512, 512] one for the dynamic shapes
+};
+
+std::ostream& operator<<(std::ostream& os, MaskType type) {
+    switch (type) {
+        case MaskType::NONE: return os << "none";
+        case MaskType::PADDING: return os << "padding";
+        case MaskType::CAUSAL: return os << "causal";
+    }
+    return os;
+}
+
+// Q shape [B, H, Lq, D] and K/V shape [B, H, Lk, D]
+using AttentionShapes = std::pair<InputShape, InputShape>;
+
+using MHATestParams = std::tuple<AttentionShapes,
+                                 MaskType,
+                                 std::map<std::string, std::string>>;  // additional config
+
+/*  MHATest graph, all the nodes except Inputs are expected to be fused into a single MultiHeadAttention node
+    if the key length is dynamic or long enough
+      -------   -------
+      |  Q  |   |  K  |
+      -------   -------
+          |       |
+    -------------------------
+    | MatMul(transpose_b)   |
+    -------------------------
+              |
+        -------------
+        |  Divide   |
+        -------------
+              |
+        -------------   ----------
+        |   [Add]   |---| [mask] |
+        -------------   ----------
+              |
+        -------------
+        |  Softmax  |
+        -------------
+              |         -------
+        -------------   |  V  |
+        |  MatMul   |---|     |
+        -------------   -------
+*/
+
+class MHATest : public testing::WithParamInterface<MHATestParams>,
+                virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MHATestParams> obj) {
+        AttentionShapes shapes;
+        MaskType maskType;
+        std::map<std::string, std::string> additionalConfig;
+        std::tie(shapes, maskType, additionalConfig) = obj.param;
+
+        std::ostringstream result;
+        for (const auto& shape : {shapes.first, shapes.second}) {
+            result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_";
+            result << "TS=";
+            for (const auto& item : shape.second) {
+                result << CommonTestUtils::vec2str(item) << "_";
+            }
+        }
+        result << "Mask=" << maskType;
+        for (const auto& item : additionalConfig) {
+            result << "_" << item.first << "=" << item.second;
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        AttentionShapes attentionShapes;
+        MaskType maskType;
+        std::map<std::string, std::string> additionalConfig;
+        std::tie(attentionShapes, maskType, additionalConfig) = this->GetParam();
+        const auto& queryShape = attentionShapes.first;
+        const auto& keyShape = attentionShapes.second;
+        configuration.insert(additionalConfig.begin(), additionalConfig.end());
+        if (additionalConfig[InferenceEngine::PluginConfigParams::KEY_ENFORCE_BF16] == InferenceEngine::PluginConfigParams::YES)
+            abs_threshold = 2e-2f;
+
+        const bool dynamicKeys = keyShape.first.rank().is_static() && keyShape.first.size() == 4 && keyShape.first[2].is_dynamic();
+        const auto minKeyLength = additionalConfig.count(InferenceEngine::PluginConfigInternalParams::KEY_CPU_MHA_MIN_KEY_LENGTH) ?
+                                  std::stoul(additionalConfig[InferenceEngine::PluginConfigInternalParams::KEY_CPU_MHA_MIN_KEY_LENGTH]) : 128lu;
+        expectFused = dynamicKeys || keyShape.second.front()[2] >= minKeyLength;
+
+        std::vector<InputShape> shapes{queryShape, keyShape, keyShape};
+        if (maskType == MaskType::PADDING) {
+            InputShape maskShape;
+            if (keyShape.first.rank().is_static() && keyShape.first.size() == 4)
+                maskShape.first = {keyShape.first[0], 1, 1, keyShape.first[2]};
+            for (const auto& target : keyShape.second) {
+                maskShape.second.push_back({target[0], 1, 1, target[2]});
+            }
+            shapes.push_back(maskShape);
+        }
+        init_input_shapes(shapes);
+
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        auto qk = std::make_shared<opset8::MatMul>(params[0], params[1], false, true);
+        const float headSize = static_cast<float>(queryShape.second.front().back());
+        std::shared_ptr<Node> scores = std::make_shared<opset8::Divide>(qk, opset8::Constant::create(element::f32, Shape{}, {std::sqrt(headSize)}));
+        if (maskType == MaskType::PADDING) {
+            scores = std::make_shared<opset8::Add>(scores, params[3]);
+        } else if (maskType == MaskType::CAUSAL && dynamicKeys) {
+            // the rows [Lk - Lq, Lk) and the columns [0, Lk) of the square mask are the causal mask of the current shapes
+            const size_t maxLength = 512;
+            std::vector<float> mask(maxLength * maxLength, 0.f);
+            for (size_t i = 0; i < maxLength; i++) {
+                for (size_t j = i + 1; j < maxLength; j++) {
+                    mask[i * maxLength + j] = -10000.f;
+                }
+            }
+            const auto getLength = [](const Output<Node>& input) {
+                return std::make_shared<opset8::Gather>(std::make_shared<opset8::ShapeOf>(input),
+                                                        opset8::Constant::create(element::i64, Shape{1}, {2}),
+                                                        opset8::Constant::create(element::i64, Shape{}, {0}));
+            };
+            const auto queryLength = getLength(params[0]);
+            const auto keyLength = getLength(params[1]);
+            const auto leading = opset8::Constant::create(element::i64, Shape{2}, {0, 0});
+            const auto begin = std::make_shared<opset8::Concat>(OutputVector{leading, std::make_shared<opset8::Subtract>(keyLength, queryLength),
+                                                                             opset8::Constant::create(element::i64, Shape{1}, {0})}, 0);
+            const auto end = std::make_shared<opset8::Concat>(OutputVector{opset8::Constant::create(element::i64, Shape{2}, {1, 1}),
+                                                                           keyLength, keyLength}, 0);
+            const auto slice = std::make_shared<opset8::StridedSlice>(
+                opset8::Constant::create(element::f32, Shape{1, 1, maxLength, maxLength}, mask), begin, end,
+                opset8::Constant::create(element::i64, Shape{4}, {1, 1, 1, 1}), std::vector<int64_t>(4, 0), std::vector<int64_t>(4, 0));
+            scores = std::make_shared<opset8::Add>(scores, slice);
+        } else if (maskType == MaskType::CAUSAL) {
+            // the last query attends to all the keys, the square mask is recognized as the causal one
+            const size_t queryLength = queryShape.second.front()[2];
+            const size_t keyLength = keyShape.second.front()[2];
+            std::vector<float> mask(queryLength * keyLength, 0.f);
+            for (size_t i = 0; i < queryLength; i++) {
+                for (size_t j = i + keyLength - queryLength + 1; j < keyLength; j++) {
+                    mask[i * keyLength + j] = -10000.f;
+                }
+            }
+            scores = std::make_shared<opset8::Add>(scores, opset8::Constant::create(element::f32, Shape{1, 1, queryLength, keyLength}, mask));
+        }
+        auto softmax = std::make_shared<opset8::Softmax>(scores, -1);
+        auto pv = std::make_shared<opset8::MatMul>(softmax, params[2]);
+
+        function = std::make_shared<Function>(pv, params, "MHA");
+    }
+
+    // the values in [-1, 1] keep the scores moderate, so the BF16 rounding doesn't change the softmax much
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); i++) {
+            const auto& funcInput = funcInputs[i];
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i], 2, -1, 256);
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+
+    bool expectFused = true;
+};
+
+TEST_P(MHATest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNodeOfTypeCount(executableNetwork, "MultiHeadAttention", expectFused ? 1 : 0);
+    CheckNodeOfTypeCount(executableNetwork, "Softmax", expectFused ? 0 : 1);
+}
+
+namespace {
+
+// the short sequences are not fused, Lq != Lk covers the prompt continuation and the single token decoding
+const std::vector<AttentionShapes> staticShapes = {
+    {{{}, {{1, 2, 16, 8}}}, {{}, {{1, 2, 16, 8}}}},
+    {{{}, {{2, 4, 77, 64}}}, {{}, {{2, 4, 77, 64}}}},
+    {{{}, {{1, 2, 160, 32}}}, {{}, {{1, 2, 160, 32}}}},
+    {{{}, {{1, 2, 20, 32}}}, {{}, {{1, 2, 200, 32}}}},
+    {{{}, {{2, 2, 1, 16}}}, {{}, {{2, 2, 130, 16}}}},
+};
+
+const std::vector<AttentionShapes> dynamicShapes = {
+    {{{-1, 4, -1, 32}, {{1, 4, 1, 32}, {2, 4, 100, 32}, {1, 4, 33, 32}}},
+     {{-1, 4, -1, 32}, {{1, 4, 1, 32}, {2, 4, 100, 32}, {1, 4, 33, 32}}}},
+    {{{1, 4, -1, 32}, {{1, 4, 1, 32}, {1, 4, 7, 32}}},
+     {{1, 4, -1, 32}, {{1, 4, 150, 32}, {1, 4, 300, 32}}}},
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+    cpuEmptyPluginConfig,
+    cpuBF16PluginConfig,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_Static, MHATest,
+                         ::testing::Combine(::testing::ValuesIn(staticShapes),
+                                            ::testing::Values(MaskType::NONE, MaskType::PADDING, MaskType::CAUSAL),
+                                            ::testing::ValuesIn(configs)),
+                         MHATest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_Dynamic, MHATest,
+                         ::testing::Combine(::testing::ValuesIn(dynamicShapes),
+                                            ::testing::Values(MaskType::NONE, MaskType::PADDING, MaskType::CAUSAL),
+                                            ::testing::ValuesIn(configs)),
+                         MHATest::getTestCaseName);
+
+// the threshold of the static key length is configurable: the 16 keys are fused with zero, the 160 keys are not with 200
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_MinKeyLength_Fused, MHATest,
+                         ::testing::Combine(::testing::Values(staticShapes[0]),
+                                            ::testing::Values(MaskType::NONE, MaskType::CAUSAL),
+                                            ::testing::Values(std::map<std::string, std::string>{
+                                                {InferenceEngine::PluginConfigInternalParams::KEY_CPU_MHA_MIN_KEY_LENGTH, "0"}})),
+                         MHATest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_MinKeyLength_NotFused, MHATest,
+                         ::testing::Combine(::testing::Values(staticShapes[2]),
+                                            ::testing::Values(MaskType::NONE, MaskType::CAUSAL),
+                                            ::testing::Values(std::map<std::string, std::string>{
+                                                {InferenceEngine::PluginConfigInternalParams::KEY_CPU_MHA_MIN_KEY_LENGTH, "200"}})),
+                         MHATest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset8.hpp>
+#include <ie_plugin_config.hpp>
+#include "openvino/runtime/core.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ngraph;
+
+namespace CPULayerTestsDefinitions {
+
+namespace {
+constexpr size_t size = 8;
+
+// accumulator: the input is added to the state and the sum is assigned back
+std::shared_ptr<Function> makeAccumulatorFunction() {
+    auto input = std::make_shared<opset8::Parameter>(element::f32, Shape{1, size});
+    auto variable = std::make_shared<Variable>(VariableInfo{PartialShape{1, size}, element::f32, "accumulator"});
+    auto init = opset8::Constant::create(element::f32, Shape{1, size}, {0});
+    auto read = std::make_shared<opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<opset8::Add>(read, input);
+    auto assign = std::make_shared<opset8::Assign>(add, variable);
+    auto result = std::make_shared<opset8::Result>(add);
+    return std::make_shared<Function>(ResultVector{result}, SinkVector{assign}, ParameterVector{input});
+}
+}  // namespace
+
+// each request keeps its own state while the requests run concurrently on several streams
+TEST(StatefulStreamsTest, smoke_IndependentRequestStates) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t numRequests = 8;
+    constexpr size_t numIterations = 20;
+
+    ov::runtime::Core core;
+    auto network = core.compile_model(makeAccumulatorFunction(), CommonTestUtils::DEVICE_CPU,
+                                      {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "4"}});
+    std::vector<ov::runtime::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++) {
+        requests.push_back(network.create_infer_request());
+        ASSERT_EQ(1, requests.back().query_state().size());
+        ov::runtime::Tensor tensor(element::f32, Shape{1, size});
+        std::fill_n(tensor.data<float>(), size, static_cast<float>(i + 1));
+        requests.back().set_input_tensor(tensor);
+    }
+
+    for (size_t iteration = 1; iteration <= numIterations; iteration++) {
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        for (size_t i = 0; i < numRequests; i++) {
+            requests[i].wait();
+            auto output = requests[i].get_output_tensor();
+            const auto expected = static_cast<float>(iteration * (i + 1));
+            for (size_t j = 0; j < size; j++) {
+                ASSERT_EQ(expected, output.data<float>()[j]);
+            }
+        }
+    }
+
+    // the reset of one request doesn't affect the others
+    requests.front().query_state().front().reset();
+    for (auto& request : requests) {
+        request.infer();
+    }
+    ASSERT_EQ(1.f, requests.front().get_output_tensor().data<float>()[0]);
+    ASSERT_EQ(static_cast<float>((numIterations + 1) * 2), requests[1].get_output_tensor().data<float>()[0]);
+}
+
+}  // namespace CPULayerTestsDefinitions
@@ -0,0 +1,167 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <ngraph/opsets/opset8.hpp>
+#include <ie_plugin_config.hpp>
+#include "openvino/runtime/core.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ngraph;
+
+namespace CPULayerTestsDefinitions {
+
+namespace {
+constexpr size_t size = 16;
+
+enum class StateBinding {
+    IN_PLACE,  // the graph reads and writes the state buffers directly
+    COPY       // the state is shared with the outputs, so it is copied to and from the graph memory
+};
+
+std::ostream& operator<<(std::ostream& os, StateBinding binding) {
+    return os << (binding == StateBinding::IN_PLACE ? "InPlace" : "Copy");
+}
+
+/*  The state accumulates the input, the first output is computed from the previous state
+    IN_PLACE: output = state * input, state = state + input; the ReadValue and the Add feed only eltwise nodes
+    COPY:     output = state, state = state + input; the ReadValue and the Add also feed the Results
+*/
+std::shared_ptr<Function> makeAccumulatorFunction(StateBinding binding) {
+    auto input = std::make_shared<opset8::Parameter>(element::f32, Shape{1, size});
+    auto variable = std::make_shared<Variable>(VariableInfo{PartialShape{1, size}, element::f32, "accumulator"});
+    auto init = opset8::Constant::create(element::f32, Shape{1, size}, {0});
+    auto read = std::make_shared<opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<opset8::Add>(read, input);
+    auto assign = std::make_shared<opset8::Assign>(add, variable);
+    ResultVector results;
+    if (binding == StateBinding::IN_PLACE) {
+        results.push_back(std::make_shared<opset8::Result>(std::make_shared<opset8::Multiply>(read, input)));
+    } else {
+        results.push_back(std::make_shared<opset8::Result>(read));
+        results.push_back(std::make_shared<opset8::Result>(add));
+    }
+    return std::make_shared<Function>(results, SinkVector{assign}, ParameterVector{input});
+}
+
+void setInput(ov::runtime::InferRequest& request, float value) {
+    ov::runtime::Tensor tensor(element::f32, Shape{1, size});
+    std::fill_n(tensor.data<float>(), size, value);
+    request.set_input_tensor(tensor);
+}
+
+void checkTensor(const ov::runtime::Tensor& tensor, float expected) {
+    ASSERT_EQ(size, tensor.get_size());
+    for (size_t i = 0; i < size; i++) {
+        ASSERT_EQ(expected, tensor.data<float>()[i]) << "at " << i;
+    }
+}
+
+void checkOutputs(ov::runtime::InferRequest& request, StateBinding binding, float previous, float input) {
+    if (binding == StateBinding::IN_PLACE) {
+        checkTensor(request.get_output_tensor(0), previous * input);
+    } else {
+        checkTensor(request.get_output_tensor(0), previous);
+        checkTensor(request.get_output_tensor(1), previous + input);
+    }
+}
+}  // namespace
+
+class StaticStateTest : public testing::WithParamInterface<StateBinding>, public testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StateBinding>& obj) {
+        std::ostringstream result;
+        result << "Binding=" << obj.param;
+        return result.str();
+    }
+};
+
+// the requests share the graph of a single stream, so each inference must see the state of its own request
+TEST_P(StaticStateTest, RequestsOnOneStream) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t numRequests = 3;
+    constexpr size_t numIterations = 10;
+    const auto binding = GetParam();
+
+    ov::runtime::Core core;
+    auto network = core.compile_model(makeAccumulatorFunction(binding), CommonTestUtils::DEVICE_CPU,
+                                      {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+    std::vector<ov::runtime::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++) {
+        requests.push_back(network.create_infer_request());
+        setInput(requests.back(), static_cast<float>(i + 1));
+    }
+
+    for (size_t iteration = 0; iteration < numIterations; iteration++) {
+        for (size_t i = 0; i < numRequests; i++) {
+            requests[i].infer();
+            const auto input = static_cast<float>(i + 1);
+            checkOutputs(requests[i], binding, iteration * input, input);
+            checkTensor(requests[i].query_state().front().get_state(), (iteration + 1) * input);
+        }
+    }
+
+    // the asynchronous requests run one after another on the stream
+    for (auto& request : requests) {
+        request.start_async();
+    }
+    for (size_t i = 0; i < numRequests; i++) {
+        requests[i].wait();
+        const auto input = static_cast<float>(i + 1);
+        checkOutputs(requests[i], binding, numIterations * input, input);
+    }
+}
+
+TEST_P(StaticStateTest, SetGetResetState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto binding = GetParam();
+    ov::runtime::Core core;
+    auto network = core.compile_model(makeAccumulatorFunction(binding), CommonTestUtils::DEVICE_CPU);
+    auto request = network.create_infer_request();
+    auto other = network.create_infer_request();
+    setInput(request, 2.f);
+    setInput(other, 3.f);
+    auto state = request.query_state().front();
+
+    ov::runtime::Tensor newState(element::f32, Shape{1, size});
+    std::fill_n(newState.data<float>(), size, 10.f);
+    state.set_state(newState);
+    // the user tensor is copied, so its later changes don't affect the state
+    std::fill_n(newState.data<float>(), size, 100.f);
+    other.infer();
+
+    // the state snapshot taken before the inferences is not changed by them
+    auto snapshot = state.get_state();
+    for (float previous = 10.f; previous < 20.f; previous += 2.f) {
+        request.infer();
+        checkOutputs(request, binding, previous, 2.f);
+    }
+    checkTensor(snapshot, 10.f);
+    checkTensor(state.get_state(), 20.f);
+
+    // the reset of one request doesn't affect the other one
+    state.reset();
+    request.infer();
+    checkOutputs(request, binding, 0.f, 2.f);
+    other.infer();
+    checkOutputs(other, binding, 3.f, 3.f);
+
+    // the state buffer is bound to the graph, so its size can't be changed
+    ov::runtime::Tensor wrongState(element::f32, Shape{1, size * 2});
+    ASSERT_ANY_THROW(state.set_state(wrongState));
+    request.infer();
+    checkOutputs(request, binding, 2.f, 2.f);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_StaticState, StaticStateTest,
+                         ::testing::Values(StateBinding::IN_PLACE, StateBinding::COPY),
+                         StaticStateTest::getTestCaseName);
+
+}  // namespace CPULayerTestsDefinitions
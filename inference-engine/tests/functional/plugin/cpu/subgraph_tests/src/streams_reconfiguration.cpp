@@ -0,0 +1,178 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <future>
+
+#include <ngraph/opsets/opset8.hpp>
+#include <ie_plugin_config.hpp>
+#include "openvino/runtime/core.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine::PluginConfigParams;
+
+namespace CPULayerTestsDefinitions {
+
+namespace {
+constexpr size_t stateSize = 8;
+
+// the input is added to the state and the sum is assigned back
+std::shared_ptr<Function> makeAccumulatorFunction() {
+    auto input = std::make_shared<opset8::Parameter>(element::f32, Shape{1, stateSize});
+    auto variable = std::make_shared<Variable>(VariableInfo{PartialShape{1, stateSize}, element::f32, "accumulator"});
+    auto init = opset8::Constant::create(element::f32, Shape{1, stateSize}, {0});
+    auto read = std::make_shared<opset8::ReadValue>(init, variable);
+    auto add = std::make_shared<opset8::Add>(read, input);
+    auto assign = std::make_shared<opset8::Assign>(add, variable);
+    auto result = std::make_shared<opset8::Result>(add);
+    return std::make_shared<Function>(ResultVector{result}, SinkVector{assign}, ParameterVector{input});
+}
+
+ov::runtime::Tensor makeInput(const ov::runtime::ExecutableNetwork& network, float scale) {
+    const auto& input = network.input();
+    ov::runtime::Tensor tensor(input.get_element_type(), input.get_shape());
+    auto data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); i++) {
+        data[i] = scale * static_cast<float>(static_cast<int>(i % 17) - 8) / 8.f;
+    }
+    return tensor;
+}
+
+void compareTensors(const ov::runtime::Tensor& expected, const ov::runtime::Tensor& actual) {
+    ASSERT_EQ(expected.get_size(), actual.get_size());
+    for (size_t i = 0; i < expected.get_size(); i++) {
+        // the partitioning of the work between threads may change the order of the accumulations
+        ASSERT_NEAR(expected.data<float>()[i], actual.data<float>()[i], 1e-4f * (1.f + std::abs(expected.data<float>()[i])))
+            << "at " << i;
+    }
+}
+}  // namespace
+
+// every switch is applied to the requests created before it and to the new ones
+TEST(StreamsReconfigurationTest, smoke_InferenceIsCorrectAfterSwitch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    constexpr size_t numRequests = 4;
+    const std::string throughput = CONFIG_VALUE(THROUGHPUT);
+    const std::string latency = CONFIG_VALUE(LATENCY);
+    const std::vector<std::pair<ov::runtime::ParamMap, unsigned int /*expected optimal requests, 0 if any*/>> switches = {
+        {{{KEY_PERFORMANCE_HINT, throughput}}, 0},
+        {{{KEY_CPU_THROUGHPUT_STREAMS, std::string{"4"}}}, 4},
+        {{{KEY_CPU_THROUGHPUT_STREAMS, std::string{"1"}}, {KEY_CPU_THREADS_NUM, std::string{"2"}}}, 1},
+        {{{KEY_PERFORMANCE_HINT, latency}}, 0},
+        {{{KEY_PERFORMANCE_HINT, throughput}, {KEY_PERFORMANCE_HINT_NUM_REQUESTS, std::string{"2"}}}, 0},
+    };
+
+    ov::runtime::Core core;
+    auto network = core.compile_model(ngraph::builder::subgraph::makeConvPoolRelu({4, 3, 64, 64}),
+                                      CommonTestUtils::DEVICE_CPU,
+                                      {{KEY_PERFORMANCE_HINT, latency}});
+    std::vector<ov::runtime::InferRequest> requests;
+    std::vector<ov::runtime::Tensor> references;
+    for (size_t i = 0; i < numRequests; i++) {
+        requests.push_back(network.create_infer_request());
+        requests.back().set_input_tensor(makeInput(network, static_cast<float>(i + 1)));
+        requests.back().infer();
+        auto output = requests.back().get_output_tensor();
+        references.emplace_back(output.get_element_type(), output.get_shape());
+        std::copy_n(output.data<float>(), output.get_size(), references.back().data<float>());
+    }
+
+    for (size_t s = 0; s < switches.size(); s++) {
+        SCOPED_TRACE("switch " + std::to_string(s));
+        const auto& configSwitch = switches[s];
+        network.set_config(configSwitch.first);
+        const auto optimalRequests = network.get_metric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        if (configSwitch.second != 0) {
+            ASSERT_EQ(configSwitch.second, optimalRequests);
+        }
+
+        for (auto& request : requests) {
+            request.start_async();
+        }
+        for (size_t i = 0; i < numRequests; i++) {
+            requests[i].wait();
+            compareTensors(references[i], requests[i].get_output_tensor());
+        }
+        for (size_t i = 0; i < numRequests; i++) {
+            requests[i].infer();
+            compareTensors(references[i], requests[i].get_output_tensor());
+        }
+
+        auto request = network.create_infer_request();
+        request.set_input_tensor(makeInput(network, 1.f));
+        request.infer();
+        compareTensors(references.front(), request.get_output_tensor());
+    }
+}
+
+// the request running during the switch completes on the previous streams and moves to the new ones with its state
+TEST(StreamsReconfigurationTest, smoke_RunningRequestMovesToNewStreams) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::runtime::Core core;
+    auto network = core.compile_model(makeAccumulatorFunction(), CommonTestUtils::DEVICE_CPU,
+                                      {{KEY_CPU_THROUGHPUT_STREAMS, "1"}});
+    auto running = network.create_infer_request();
+    auto idle = network.create_infer_request();
+    for (auto request : {&running, &idle}) {
+        ov::runtime::Tensor tensor(element::f32, Shape{1, stateSize});
+        std::fill_n(tensor.data<float>(), stateSize, request == &running ? 1.f : 2.f);
+        request->set_input_tensor(tensor);
+    }
+    auto checkOutput = [](ov::runtime::InferRequest& request, float expected) {
+        auto output = request.get_output_tensor();
+        for (size_t i = 0; i < stateSize; i++) {
+            ASSERT_EQ(expected, output.data<float>()[i]) << "at " << i;
+        }
+    };
+    running.infer();
+    idle.infer();
+
+    // the request stays busy until its callback returns
+    std::promise<void> callbackRelease;
+    auto callbackReleased = callbackRelease.get_future().share();
+    running.set_callback([callbackReleased](std::exception_ptr) {
+        callbackReleased.wait();
+    });
+    running.start_async();
+
+    // the switch doesn't wait for the running request
+    auto switched = std::async(std::launch::async, [&network] {
+        network.set_config({{KEY_CPU_THROUGHPUT_STREAMS, std::string{"2"}}});
+    });
+    const auto switchStatus = switched.wait_for(std::chrono::seconds(30));
+    callbackRelease.set_value();
+    ASSERT_EQ(std::future_status::ready, switchStatus);
+    switched.get();
+    running.wait();
+    checkOutput(running, 2.f);
+    ASSERT_EQ(2u, network.get_metric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+
+    // both requests keep accumulating their states on the new streams
+    running.set_callback([](std::exception_ptr) {});
+    for (float iteration = 3.f; iteration < 6.f; iteration += 1.f) {
+        running.start_async();
+        idle.start_async();
+        running.wait();
+        idle.wait();
+        checkOutput(running, iteration);
+        checkOutput(idle, 2.f * (iteration - 1.f));
+    }
+
+    // and a request created after the switch starts from the initial state
+    auto created = network.create_infer_request();
+    created.set_input_tensor(running.get_input_tensor());
+    created.infer();
+    checkOutput(created, 1.f);
+}
+
+}  // namespace CPULayerTestsDefinitions
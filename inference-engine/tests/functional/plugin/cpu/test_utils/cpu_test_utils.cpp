@@ -342,6 +342,23 @@ void CheckNodeOfTypeCount(InferenceEngine::ExecutableNetwork &execNet, std::stri
 
     ASSERT_EQ(expectedCount, actualNodeCount) << "Unexpected count of the node type '" << nodeType << "' ";
 }
+
+void CheckNodeOfTypeCount(ov::runtime::ExecutableNetwork &execNet, std::string nodeType, size_t expectedCount) {
+    auto function = execNet.get_runtime_model();
+    ASSERT_NE(nullptr, function);
+    size_t actualNodeCount = 0;
+    for (const auto &node : function->get_ops()) {
+        const auto & rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        IE_ASSERT(rtInfo.end() != it);
+        if (it->second.as<std::string>() == nodeType) {
+            actualNodeCount++;
+        }
+    }
+
+    ASSERT_EQ(expectedCount, actualNodeCount) << "Unexpected count of the node type '" << nodeType << "' ";
+}
+
 std::vector<CPUSpecificParams> filterCPUInfoForDevice(std::vector<CPUSpecificParams> CPUParams) {
     std::vector<CPUSpecificParams> resCPUParams;
     const int selectedTypeIndex = 3;
@@ -302,6 +302,38 @@ TEST(IEClassBasicTest, smoke_SetConfigHeteroNoThrow) {
     ASSERT_FALSE(value);
 }
 
+TEST(IEClassBasicTest, smoke_SetConfigHeteroPipeliningNoThrow) {
+    InferenceEngine::Core  ie = BehaviorTestsUtils::createIECoreWithTemplate();
+    bool value = true;
+
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINING)).as<bool>());
+    ASSERT_FALSE(value);
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(PIPELINING), InferenceEngine::PluginConfigParams::YES}},
+                                 CommonTestUtils::DEVICE_HETERO));
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(PIPELINING)).as<bool>());
+    ASSERT_TRUE(value);
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(PIPELINING), InferenceEngine::PluginConfigParams::NO}},
+                                 CommonTestUtils::DEVICE_HETERO));
+}
+
+TEST(IEClassBasicTest, smoke_SetConfigHeteroCostModelPartitioningNoThrow) {
+    InferenceEngine::Core  ie = BehaviorTestsUtils::createIECoreWithTemplate();
+    bool value = true;
+
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING)).as<bool>());
+    ASSERT_FALSE(value);
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING), InferenceEngine::PluginConfigParams::YES}},
+                                 CommonTestUtils::DEVICE_HETERO));
+    ASSERT_NO_THROW(value = ie.GetConfig("HETERO", HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING)).as<bool>());
+    ASSERT_TRUE(value);
+
+    ASSERT_NO_THROW(ie.SetConfig({{HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING), InferenceEngine::PluginConfigParams::NO}},
+                                 CommonTestUtils::DEVICE_HETERO));
+}
+
 TEST_P(IEClassSpecificDeviceTestSetConfig, SetConfigSpecificDeviceNoThrow) {
     InferenceEngine::Core ie = BehaviorTestsUtils::createIECoreWithTemplate();
 
@@ -9,6 +9,7 @@
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
 #include "ie_algorithm.hpp"
+#include "hetero/hetero_plugin_config.hpp"
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -183,4 +184,31 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, pipelinedOverlappingRequests) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    functionRefs = ngraph::clone_function(*function);
+    configuration[HETERO_CONFIG_KEY(PIPELINING)] = CONFIG_VALUE(YES);
+    LoadNetwork();
+    ASSERT_TRUE(executableNetwork.GetConfig(HETERO_CONFIG_KEY(PIPELINING)).as<bool>());
+    GenerateInputs();
+
+    // more requests than subgraphs, so the requests occupy the stages at the same time
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (int i = 0; i < 4; ++i) {
+        inferRequest = executableNetwork.CreateInferRequest();
+        ConfigureInferRequest();
+        requests.push_back(inferRequest);
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::InferRequest::RESULT_READY));
+        inferRequest = request;
+        Validate();
+    }
+}
+
 }  //  namespace HeteroTests
@@ -21,8 +21,8 @@ std::shared_ptr<Node> makeBinaryConvolution(const Output<Node> &in,
                                             size_t numOutChannels,
                                             float padValue,
                                             const std::vector<int8_t> &filterWeihgts) {
-    auto shape = in.get_shape();
-    std::vector<size_t> filterWeightsShape = {numOutChannels, shape[1]};
+    auto shape = in.get_partial_shape();
+    std::vector<size_t> filterWeightsShape = {numOutChannels, static_cast<size_t>(shape[1].get_length())};
     filterWeightsShape.insert(filterWeightsShape.end(), filterSize.begin(), filterSize.end());
     auto filterWeightsNode = std::make_shared<op::Constant>(element::u1, filterWeightsShape);
     const size_t byteNum = (ngraph::shape_size(filterWeightsShape) + 7) / 8;
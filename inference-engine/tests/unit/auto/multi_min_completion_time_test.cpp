@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_metric_helpers.hpp>
+#include <common_test_utils/test_constants.hpp>
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_icore.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinference_plugin.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
+#include <multi-device/multi_device_config.hpp>
+#include <ngraph_functions/subgraph_builders.hpp>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include "plugin/mock_auto_device_plugin.hpp"
+#include "cpp/ie_plugin.hpp"
+#include "mock_common.hpp"
+
+using ::testing::MatcherCast;
+using ::testing::StrEq;
+using ::testing::Return;
+using ::testing::AtLeast;
+using ::testing::AnyNumber;
+using ::testing::InvokeWithoutArgs;
+using ::testing::_;
+using Config = std::map<std::string, std::string>;
+using namespace MockMultiDevice;
+
+// MULTI:CPU,CPU with a single worker request per device, the devices differ only in the latencies set by the tests
+class MultiMinCompletionTimeTest : public ::testing::Test {
+public:
+    std::shared_ptr<MockICore>                      core;
+    std::shared_ptr<MockMultiDeviceInferencePlugin> plugin;
+    InferenceEngine::CNNNetwork                     cnnNet;
+    std::vector<std::shared_ptr<MockIExecutableNetworkInternal>> mockIExeNets;
+    std::vector<ov::runtime::SoPtr<IExecutableNetworkInternal>>  mockExeNetworks;
+    std::vector<std::shared_ptr<MockIInferRequestInternal>>      inferReqInternals;
+    std::vector<InferenceEngine::InferencePlugin>                mockPlugins;
+
+    void SetUp() override {
+        for (int i = 0; i < 2; i++) {
+            auto mockIExeNet = std::make_shared<MockIExecutableNetworkInternal>();
+            auto mockIPluginPtr = std::make_shared<MockIInferencePlugin>();
+            ON_CALL(*mockIPluginPtr, LoadNetwork(MatcherCast<const CNNNetwork&>(_), _)).WillByDefault(Return(mockIExeNet));
+            EXPECT_CALL(*mockIPluginPtr, LoadNetwork(MatcherCast<const CNNNetwork&>(_), _)).Times(1);
+            mockPlugins.emplace_back(InferenceEngine::InferencePlugin{{}, mockIPluginPtr});
+            mockExeNetworks.push_back(mockPlugins.back().LoadNetwork(CNNNetwork{}, {}));
+
+            auto inferReqInternal = std::make_shared<MockIInferRequestInternal>();
+            ON_CALL(*mockIExeNet, CreateInferRequest()).WillByDefault(Return(inferReqInternal));
+            EXPECT_CALL(*mockIExeNet, CreateInferRequest()).Times(1);
+            EXPECT_CALL(*inferReqInternal, SetCallback).Times(AtLeast(1));
+            unsigned int optimalNum = 1;
+            ON_CALL(*mockIExeNet, GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+                .WillByDefault(RETURN_MOCK_VALUE(optimalNum));
+            EXPECT_CALL(*mockIExeNet, GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)))).Times(AnyNumber());
+            EXPECT_CALL(*mockIExeNet, GetConfig(_)).Times(AnyNumber());
+            mockIExeNets.push_back(mockIExeNet);
+            inferReqInternals.push_back(inferReqInternal);
+        }
+
+        core = std::shared_ptr<MockICore>(new MockICore());
+        plugin = std::shared_ptr<MockMultiDeviceInferencePlugin>(new MockMultiDeviceInferencePlugin());
+        plugin->SetCore(core);
+        cnnNet = InferenceEngine::CNNNetwork(ngraph::builder::subgraph::makeConvPoolRelu());
+
+        // the network is loaded twice to the same device
+        EXPECT_CALL(*core, LoadNetwork(::testing::Matcher<const InferenceEngine::CNNNetwork&>(_),
+                                       ::testing::Matcher<const std::string&>(StrEq(CommonTestUtils::DEVICE_CPU)),
+                                       ::testing::Matcher<const Config&>(_)))
+            .WillOnce(Return(mockExeNetworks[0]))
+            .WillOnce(Return(mockExeNetworks[1]));
+        std::vector<DeviceInformation> metaDevices = {{CommonTestUtils::DEVICE_CPU, {}, -1, ""},
+                                                      {CommonTestUtils::DEVICE_CPU, {}, -1, ""}};
+        ON_CALL(*plugin, ParseMetaDevices(_, _)).WillByDefault(Return(metaDevices));
+        EXPECT_CALL(*plugin, ParseMetaDevices(_, _)).Times(AnyNumber());
+    }
+
+    void TearDown() override {
+        plugin.reset();
+        core.reset();
+        mockIExeNets.clear();
+        mockExeNetworks.clear();
+        mockPlugins.clear();
+        inferReqInternals.clear();
+    }
+
+    MultiDeviceExecutableNetwork::Ptr LoadMulti(const std::string& policy) {
+        Config config = {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                          CommonTestUtils::DEVICE_CPU + std::string(",") + CommonTestUtils::DEVICE_CPU},
+                         {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, policy}};
+        auto network = std::dynamic_pointer_cast<MultiDeviceExecutableNetwork>(plugin->LoadExeNetworkImpl(cnnNet, config));
+        EXPECT_NE(nullptr, network);
+        return network;
+    }
+
+    static void SetLatency(const MultiDeviceExecutableNetwork::Ptr& network, const DeviceName& device, double latency) {
+        std::lock_guard<std::mutex> lock(network->_latencyMutex);
+        network->_deviceLatencies.at(device)._avgLatency = latency;
+    }
+
+    // returns the worker name the task was started on, or an empty string if the task was queued
+    static DeviceName Schedule(const MultiDeviceExecutableNetwork::Ptr& network) {
+        DeviceName scheduledTo;
+        network->ScheduleToWorkerInferRequest([&] {
+            for (auto&& workerRequests : network->_workerRequests) {
+                for (auto&& workerRequest : workerRequests.second) {
+                    if (&workerRequest == MultiDeviceExecutableNetwork::_thisWorkerInferRequest) {
+                        scheduledTo = workerRequests.first;
+                    }
+                }
+            }
+            // the request is already counted when it is started
+            std::lock_guard<std::mutex> lock(network->_latencyMutex);
+            EXPECT_EQ(1, network->_deviceLatencies.at(scheduledTo)._inFlight);
+        });
+        return scheduledTo;
+    }
+};
+
+TEST_F(MultiMinCompletionTimeTest, repeatedDeviceGetsItsOwnNetworkAndWorkers) {
+    auto network = LoadMulti(InferenceEngine::MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME);
+    ASSERT_EQ(2, network->_networksPerDevice.size());
+    ASSERT_NE(network->_networksPerDevice.at("CPU")._ptr, network->_networksPerDevice.at("CPU_1")._ptr);
+    ASSERT_EQ(1, network->_workerRequests.at("CPU").size());
+    ASSERT_EQ(1, network->_workerRequests.at("CPU_1").size());
+    ASSERT_EQ(1, network->_deviceLatencies.at("CPU")._numWorkers);
+    ASSERT_EQ(1, network->_deviceLatencies.at("CPU_1")._numWorkers);
+}
+
+TEST_F(MultiMinCompletionTimeTest, fasterDeviceIsPreferred) {
+    auto network = LoadMulti(InferenceEngine::MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME);
+    SetLatency(network, "CPU", 1000.0);
+    SetLatency(network, "CPU_1", 100.0);
+    ASSERT_EQ("CPU_1", Schedule(network));
+
+    // waiting for the busy faster device (100 + 100 / 1) is expected to complete earlier than the slower one
+    ASSERT_EQ("", Schedule(network));
+    InferenceEngine::Task task;
+    ASSERT_TRUE(network->_inferPipelineTasks.try_pop(task));
+}
+
+TEST_F(MultiMinCompletionTimeTest, slowerDeviceIsUsedWhenFasterIsBusy) {
+    auto network = LoadMulti(InferenceEngine::MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME);
+    SetLatency(network, "CPU", 150.0);
+    SetLatency(network, "CPU_1", 100.0);
+    ASSERT_EQ("CPU_1", Schedule(network));
+    ASSERT_EQ("CPU", Schedule(network));
+}
+
+TEST_F(MultiMinCompletionTimeTest, deviceWithoutLatencyIsTriedFirst) {
+    auto network = LoadMulti(InferenceEngine::MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME);
+    SetLatency(network, "CPU", 100.0);
+    ASSERT_EQ("CPU_1", Schedule(network));
+}
+
+TEST_F(MultiMinCompletionTimeTest, priorityPolicyIgnoresLatencies) {
+    auto network = LoadMulti(InferenceEngine::MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY);
+    SetLatency(network, "CPU", 1000.0);
+    SetLatency(network, "CPU_1", 100.0);
+    ASSERT_EQ("CPU", Schedule(network));
+    ASSERT_EQ("CPU_1", Schedule(network));
+    ASSERT_EQ("", Schedule(network));
+    InferenceEngine::Task task;
+    ASSERT_TRUE(network->_inferPipelineTasks.try_pop(task));
+}
@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <ngraph/opsets/opset8.hpp>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "partitioning.hpp"
+
+using namespace HeteroPlugin;
+using namespace ngraph;
+
+namespace {
+
+// input -> A(Relu) -> B(Sigmoid) -> C(Multiply by weights) -> output
+std::shared_ptr<Function> makeChain() {
+    auto input = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 16});
+    input->set_friendly_name("input");
+    auto a = std::make_shared<opset8::Relu>(input);
+    a->set_friendly_name("A");
+    auto b = std::make_shared<opset8::Sigmoid>(a);
+    b->set_friendly_name("B");
+    auto weights = opset8::Constant::create(element::f32, Shape{1, 16}, {2});
+    weights->set_friendly_name("weights");
+    auto c = std::make_shared<opset8::Multiply>(b, weights);
+    c->set_friendly_name("C");
+    auto output = std::make_shared<opset8::Result>(c);
+    output->set_friendly_name("output");
+    return std::make_shared<Function>(ResultVector{output}, ParameterVector{input});
+}
+
+InferenceEngine::QueryNetworkResult query(const std::shared_ptr<Function>& function,
+                                          const std::string& device,
+                                          const std::vector<std::string>& unsupported) {
+    InferenceEngine::QueryNetworkResult result;
+    for (auto&& node : function->get_ops()) {
+        const auto& name = node->get_friendly_name();
+        if (std::find(unsupported.begin(), unsupported.end(), name) == unsupported.end()) {
+            result.supportedLayersMap.emplace(name, device);
+        }
+    }
+    return result;
+}
+
+// number of subgraphs HETERO creates: connected components of operations with the same affinity
+std::size_t countSubgraphs(const std::shared_ptr<Function>& function,
+                           const std::map<std::string, std::string>& affinities) {
+    std::unordered_map<const Node*, const Node*> parents;
+    std::function<const Node*(const Node*)> find = [&](const Node* node) {
+        auto parent = parents.at(node);
+        return parent == node ? node : (parents[node] = find(parent));
+    };
+    for (auto&& node : function->get_ops()) {
+        parents[node.get()] = node.get();
+    }
+    for (auto&& node : function->get_ops()) {
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output().get_node();
+            if (affinities.at(source->get_friendly_name()) == affinities.at(node->get_friendly_name())) {
+                parents[find(source)] = find(node.get());
+            }
+        }
+    }
+    std::size_t count = 0;
+    for (auto&& parent : parents) {
+        count += parent.first == parent.second ? 1 : 0;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST(HeteroPartitioningTest, FragmentIsMergedWithItsConstantsAndIO) {
+    auto function = makeChain();
+    AffinityCostModel costModel{{{"DEV0", query(function, "DEV0", {"B"})}, {"DEV1", query(function, "DEV1", {})}}};
+
+    auto affinities = costModel.GetDefaultAffinities();
+    ASSERT_EQ(3, countSubgraphs(function, affinities));
+
+    costModel.Refine(function, affinities);
+    for (auto&& node : function->get_ops()) {
+        ASSERT_EQ("DEV1", affinities.at(node->get_friendly_name())) << node->get_friendly_name();
+    }
+    ASSERT_EQ(1, countSubgraphs(function, affinities));
+}
+
+TEST(HeteroPartitioningTest, ConstantsStayWithUnmovedConsumers) {
+    auto function = makeChain();
+    // C cannot be moved, so its constant and the result stay on DEV0 with it
+    AffinityCostModel costModel{{{"DEV0", query(function, "DEV0", {"B"})}, {"DEV1", query(function, "DEV1", {"C"})}}};
+
+    auto affinities = costModel.GetDefaultAffinities();
+    costModel.Refine(function, affinities);
+    ASSERT_EQ("DEV1", affinities.at("input"));
+    ASSERT_EQ("DEV1", affinities.at("A"));
+    ASSERT_EQ("DEV1", affinities.at("B"));
+    ASSERT_EQ("DEV0", affinities.at("C"));
+    ASSERT_EQ("DEV0", affinities.at("weights"));
+    ASSERT_EQ("DEV0", affinities.at("output"));
+    ASSERT_EQ(2, countSubgraphs(function, affinities));
+}
+
+TEST(HeteroPartitioningTest, SharedConstantFollowsFirstConsumerInTopologicalOrder) {
+    // input -> first(Multiply by weights) -> Relu -> second(Multiply by the same weights) -> output,
+    // first runs only on DEV0 and second only on DEV1
+    for (int attempt = 0; attempt < 8; ++attempt) {
+        auto input = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 16});
+        input->set_friendly_name("input");
+        auto weights = opset8::Constant::create(element::f32, Shape{1, 16}, {2});
+        weights->set_friendly_name("weights");
+        auto first = std::make_shared<opset8::Multiply>(input, weights);
+        first->set_friendly_name("first");
+        auto relu = std::make_shared<opset8::Relu>(first);
+        relu->set_friendly_name("relu");
+        auto second = std::make_shared<opset8::Multiply>(relu, weights);
+        second->set_friendly_name("second");
+        auto output = std::make_shared<opset8::Result>(second);
+        output->set_friendly_name("output");
+        auto function = std::make_shared<Function>(ResultVector{output}, ParameterVector{input});
+
+        AffinityCostModel costModel{{{"DEV0", query(function, "DEV0", {"second"})},
+                                     {"DEV1", query(function, "DEV1", {"first"})}}};
+        auto affinities = costModel.GetDefaultAffinities();
+        costModel.Refine(function, affinities);
+        ASSERT_EQ("DEV0", affinities.at("first"));
+        ASSERT_EQ("DEV1", affinities.at("second"));
+        // the consumers are ordered by the node addresses in the graph, which differ from attempt to attempt
+        ASSERT_EQ("DEV0", affinities.at("weights")) << "attempt " << attempt;
+    }
+}
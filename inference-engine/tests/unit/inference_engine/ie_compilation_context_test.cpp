@@ -403,6 +403,41 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstants) {
+    auto createNetworkWithConstant = [](const std::vector<float>& values) {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{values.size()});
+        data->set_friendly_name("Parameter");
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{values.size()}, values);
+        constant->set_friendly_name("constant");
+        auto add = std::make_shared<ngraph::opset6::Add>(data, constant);
+        add->set_friendly_name("add");
+        auto res = std::make_shared<ngraph::opset6::Result>(add);
+        res->set_friendly_name("res");
+        return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res},
+                                                             ngraph::ParameterVector{data}));
+    };
+    // Bigger than a single chunk of the parallel constant hashing
+    std::vector<float> values(1024 * 1024, 1.f);
+    auto net1 = createNetworkWithConstant(values);
+    auto net2 = createNetworkWithConstant(values);
+    values.back() = 2.f;
+    auto net3 = createNetworkWithConstant(values);
+    auto net4 = createNetworkWithConstant({1.f});
+    auto net5 = createNetworkWithConstant({2.f});
+
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    // Hash of the same constant is taken from the cache
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+
+    ASSERT_NE(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+
+    ASSERT_NE(NetworkCompilationContext::computeHash(net4, {}),
+              NetworkCompilationContext::computeHash(net5, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include "ie_plugin_config.hpp"
+#include "ie_warm_start_executable_network.hpp"
+
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iinfer_request_internal.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class WarmStartExecutableNetworkTests : public ::testing::Test {
+protected:
+    std::shared_ptr<MockIExecutableNetworkInternal> warmNetwork;
+    std::shared_ptr<MockIExecutableNetworkInternal> compiledNetwork;
+    std::shared_ptr<MockIInferRequestInternal> warmRequest;
+    std::shared_ptr<MockIInferRequestInternal> compiledRequest;
+    // the background compilation is blocked until the promise is set
+    std::shared_ptr<std::promise<void>> compileRelease;
+    std::shared_ptr<std::promise<void>> compileStarted;
+    std::shared_ptr<std::promise<void>> compileFinished;
+
+    void SetUp() override {
+        warmNetwork = std::make_shared<MockIExecutableNetworkInternal>();
+        compiledNetwork = std::make_shared<MockIExecutableNetworkInternal>();
+        warmRequest = std::make_shared<MockIInferRequestInternal>();
+        compiledRequest = std::make_shared<MockIInferRequestInternal>();
+        compileRelease = std::make_shared<std::promise<void>>();
+        compileStarted = std::make_shared<std::promise<void>>();
+        compileFinished = std::make_shared<std::promise<void>>();
+        ON_CALL(*warmNetwork, CreateInferRequest()).WillByDefault(Return(warmRequest));
+        ON_CALL(*compiledNetwork, CreateInferRequest()).WillByDefault(Return(compiledRequest));
+        ON_CALL(*compiledNetwork, GetInputsInfo()).WillByDefault(Return(ConstInputsDataMap{}));
+        ON_CALL(*compiledNetwork, GetOutputsInfo()).WillByDefault(Return(ConstOutputsDataMap{}));
+    }
+
+    WarmStartExecutableNetwork::CompileFunction makeCompile(bool fail = false) {
+        auto network = compiledNetwork;
+        auto started = compileStarted;
+        auto finished = compileFinished;
+        auto release = compileRelease->get_future().share();
+        return [network, started, finished, release, fail]() -> SoExecutableNetworkInternal {
+            started->set_value();
+            release.wait();
+            finished->set_value();
+            if (fail) {
+                IE_THROW() << "Compilation failed";
+            }
+            return {nullptr, network};
+        };
+    }
+
+    static void waitForSwitch(const WarmStartExecutableNetwork::Ptr& network) {
+        size_t generation = 0;
+        for (int i = 0; i < 1000 && generation == 0; i++) {
+            network->GetCurrentNetwork(generation);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_EQ(1, generation);
+    }
+};
+
+TEST_F(WarmStartExecutableNetworkTests, requestSwitchesToCompiledNetwork) {
+    auto network = std::make_shared<WarmStartExecutableNetwork>(SoExecutableNetworkInternal{nullptr, warmNetwork},
+                                                                makeCompile());
+    auto request = network->CreateInferRequest();
+
+    EXPECT_CALL(*warmRequest, Infer()).Times(1);
+    EXPECT_CALL(*compiledRequest, Infer()).Times(0);
+    request->Infer();
+
+    compileRelease->set_value();
+    waitForSwitch(network);
+
+    EXPECT_CALL(*compiledRequest, Infer()).Times(1);
+    request->Infer();
+    size_t generation = 0;
+    ASSERT_EQ(compiledNetwork, network->GetCurrentNetwork(generation)._ptr);
+}
+
+TEST_F(WarmStartExecutableNetworkTests, configWaitsForCompiledNetwork) {
+    auto network = std::make_shared<WarmStartExecutableNetwork>(SoExecutableNetworkInternal{nullptr, warmNetwork},
+                                                                makeCompile());
+    // the keys of the requested device are not known to the warm network
+    EXPECT_CALL(*warmNetwork, SetConfig(_)).Times(0);
+    EXPECT_CALL(*compiledNetwork, SetConfig(_)).Times(1);
+    auto configured = std::async(std::launch::async, [&network] {
+        network->SetConfig({{"KEY", std::string{"VALUE"}}});
+    });
+    ASSERT_EQ(std::future_status::timeout, configured.wait_for(std::chrono::milliseconds(50)));
+
+    compileRelease->set_value();
+    ASSERT_EQ(std::future_status::ready, configured.wait_for(std::chrono::seconds(10)));
+    configured.get();
+}
+
+TEST_F(WarmStartExecutableNetworkTests, metricsAreReportedByCompiledNetwork) {
+    auto network = std::make_shared<WarmStartExecutableNetwork>(SoExecutableNetworkInternal{nullptr, warmNetwork},
+                                                                makeCompile());
+    EXPECT_CALL(*warmNetwork, GetMetric(_)).Times(0);
+    EXPECT_CALL(*warmNetwork, GetConfig(_)).Times(0);
+    EXPECT_CALL(*compiledNetwork, GetMetric(_)).WillOnce(Return(Parameter{4u}));
+    EXPECT_CALL(*compiledNetwork, GetConfig(_)).WillOnce(Return(Parameter{std::string{"VALUE"}}));
+    compileRelease->set_value();
+    ASSERT_EQ(4u, network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    ASSERT_EQ("VALUE", network->GetConfig("KEY").as<std::string>());
+}
+
+TEST_F(WarmStartExecutableNetworkTests, warmNetworkServesIfCompilationFails) {
+    auto network = std::make_shared<WarmStartExecutableNetwork>(SoExecutableNetworkInternal{nullptr, warmNetwork},
+                                                                makeCompile(true));
+    auto request = network->CreateInferRequest();
+    compileRelease->set_value();
+
+    // only the compiled network can be exported, so the compilation error is reported there
+    std::stringstream stream;
+    ASSERT_THROW(network->Export(stream), Exception);
+
+    EXPECT_CALL(*warmRequest, Infer()).Times(1);
+    EXPECT_CALL(*compiledRequest, Infer()).Times(0);
+    request->Infer();
+    size_t generation = 0;
+    ASSERT_EQ(warmNetwork, network->GetCurrentNetwork(generation)._ptr);
+    ASSERT_EQ(0, generation);
+
+    // the warm network becomes the final one
+    EXPECT_CALL(*warmNetwork, GetMetric(_)).WillOnce(Return(Parameter{1u}));
+    ASSERT_EQ(1u, network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+}
+
+TEST_F(WarmStartExecutableNetworkTests, destructionDoesNotWaitForCompilation) {
+    auto network = std::make_shared<WarmStartExecutableNetwork>(SoExecutableNetworkInternal{nullptr, warmNetwork},
+                                                                makeCompile());
+    compileStarted->get_future().wait();
+
+    // the compilation is still blocked here, so the release would hang if it waited for it
+    auto destroyed = std::async(std::launch::async, [&network] {
+        network.reset();
+    });
+    ASSERT_EQ(std::future_status::ready, destroyed.wait_for(std::chrono::seconds(10)));
+
+    // the compilation finishing after the release is dropped
+    EXPECT_CALL(*compiledNetwork, CreateInferRequest()).Times(0);
+    compileRelease->set_value();
+    ASSERT_EQ(std::future_status::ready, compileFinished->get_future().wait_for(std::chrono::seconds(10)));
+}
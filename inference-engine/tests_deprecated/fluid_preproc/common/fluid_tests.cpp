@@ -830,6 +830,70 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST_P(ResizeBatchTestIE, AccuracyTest)
+{
+    int type = 0, interp = 0;
+    cv::Size sz_out;
+    double tolerance = 0.0;
+    std::tie(type, interp, sz_out, tolerance) = GetParam();
+
+    // the images of the batch have different sizes
+    const std::vector<cv::Size> sizes_in = { cv::Size(640, 480), cv::Size(320, 200), cv::Size(113, 71) };
+    const size_t batch = sizes_in.size();
+
+    std::vector<cv::Mat> in_mats;
+    for (const auto& sz_in : sizes_in) {
+        cv::Mat in_mat(sz_in, type);
+        cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+        in_mats.push_back(in_mat);
+    }
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    size_t channels = CV_MAT_CN(type);
+    CV_Assert(1 == channels || 3 == channels);
+
+    int depth = CV_MAT_DEPTH(type);
+    CV_Assert(CV_8U == depth || CV_32F == depth);
+
+    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+
+    using namespace InferenceEngine;
+
+    // HWC blobs: channels are interleaved, output images are stacked along the batch dimension
+    Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+    int out_sizes[] = { static_cast<int>(batch), sz_out.height, sz_out.width };
+    cv::Mat out_mat(3, out_sizes, type);
+
+    std::vector<Blob::Ptr> in_blobs;
+    for (auto& in_mat : in_mats) {
+        ASSERT_TRUE(in_mat.isContinuous());
+        TensorDesc in_desc(precision, { 1, channels, static_cast<size_t>(in_mat.rows),
+                                        static_cast<size_t>(in_mat.cols) }, Layout::NHWC);
+        in_blobs.push_back(make_blob_with_precision(in_desc, in_mat.data));
+    }
+    TensorDesc out_desc(precision, { batch, channels, static_cast<size_t>(sz_out.height),
+                                     static_cast<size_t>(sz_out.width) }, Layout::NHWC);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc, out_mat.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(std::make_shared<CompoundBlob>(in_blobs));
+
+    ResizeAlgorithm algorithm = cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR;
+    PreProcessInfo info;
+    info.setResizeAlgorithm(algorithm);
+
+    preprocess->execute(out_blob, info, false);
+
+    // OpenCV code and comparison //////////////////////////////////////////////
+    for (size_t i = 0; i < batch; ++i) {
+        cv::Mat out_mat_ocv;
+        cv::resize(in_mats[i], out_mat_ocv, sz_out, 0, 0, interp);
+        cv::Mat out_item(sz_out, type, out_mat.ptr(static_cast<int>(i)));
+        EXPECT_LE(cv::norm(out_mat_ocv, out_item, cv::NORM_INF), tolerance) << "image " << i;
+    }
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
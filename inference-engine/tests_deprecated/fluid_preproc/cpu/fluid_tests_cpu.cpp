@@ -239,6 +239,12 @@ INSTANTIATE_TEST_SUITE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+INSTANTIATE_TEST_SUITE_P(ResizeBatchTestFluid, ResizeBatchTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3, CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::Size(320, 200), cv::Size(224, 224)),
+                                Values(4))); // error not more than 4 unit
+
 INSTANTIATE_TEST_SUITE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
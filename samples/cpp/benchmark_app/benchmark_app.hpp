@@ -26,6 +26,13 @@ static const char model_message[] =
     "Required. Path to an .xml/.onnx file with a trained model or to a .blob files with "
     "a trained compiled model.";
 
+/// @brief message for shape distribution
+static const char shape_distribution_message[] =
+    "Optional. Path to a file with the distribution of the input shapes. Each line contains the shapes in the -shape "
+    "format and the optional weight, e.g. \"input_ids[1,128],attention_mask[1,128] 35\". The network is reshaped to "
+    "cover all the shapes and the shapes of each request are sampled from the distribution. Latency and throughput "
+    "are reported per shape.";
+
 /// @brief message for performance hint
 static const char hint_message[] =
     "Optional. Performance hint (optimize for latency or throughput). "
@@ -78,6 +85,31 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for arrival process of the open-loop mode
+static const char arrival_message[] =
+    "Optional. Enables the open-loop mode: the requests are submitted at the arrival times regardless of the "
+    "completions, the latency includes the time spent in the queue. Arrival process: \"constant\" rate, "
+    "\"poisson\" process with the mean rate or \"trace\" replay of the timestamps from -arrival_trace file. "
+    "Requires async API.";
+
+/// @brief message for arrival rate of the open-loop mode
+static const char arrival_rate_message[] =
+    "Optional. Mean number of requests per second for the constant and poisson arrival processes.";
+
+/// @brief message for arrival trace of the open-loop mode
+static const char arrival_trace_message[] =
+    "Optional. Path to a text file with the arrival timestamps in milliseconds, one per line.";
+
+/// @brief message for the rate sweep of the open-loop mode
+static const char rate_sweep_message[] =
+    "Optional. Comma-separated list of arrival rates (requests per second). The open-loop run is repeated for each "
+    "rate, the constant arrival process is used unless -arrival is set.";
+
+/// @brief message for latency SLO of the open-loop mode
+static const char slo_message[] =
+    "Optional. Latency service level objective in milliseconds for the 99th percentile of the total latency. "
+    "With -rate_sweep the highest rate meeting the SLO is reported as the throughput at SLO.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -248,6 +280,21 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint32(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Arrival process of the open-loop mode, closed-loop if empty
+DEFINE_string(arrival, "", arrival_message);
+
+/// @brief Arrival rate of the open-loop mode in requests per second
+DEFINE_double(rate, 0.0, arrival_rate_message);
+
+/// @brief Arrival timestamps file of the open-loop mode
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief Arrival rates to sweep in the open-loop mode
+DEFINE_string(rate_sweep, "", rate_sweep_message);
+
+/// @brief Latency SLO in milliseconds
+DEFINE_double(slo, 0.0, slo_message);
+
 /// @brief Enforces bf16 execution with bfloat16 precision on systems having this capability
 DEFINE_bool(enforcebf16, false, enforce_bf16_message);
 
@@ -322,6 +369,9 @@ DEFINE_string(iscale, "", input_image_scale_message);
 /// @brief Define flag for using input image mean <br>
 DEFINE_string(imean, "", input_image_mean_message);
 
+/// @brief Define parameter for the shape distribution file <br>
+DEFINE_string(shape_distribution, "", shape_distribution_message);
+
 /**
  * @brief This function show a help message
  */
@@ -347,9 +397,16 @@ static void showUsage() {
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
+    std::cout << "    -shape_distribution \"<path>\"  " << shape_distribution_message << std::endl;
     std::cout << "    -cache_dir \"<path>\"        " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << std::endl << "  Open-loop load options:" << std::endl;
+    std::cout << "    -arrival \"<constant/poisson/trace>\"  " << arrival_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_trace \"<path>\"   " << arrival_trace_message << std::endl;
+    std::cout << "    -rate_sweep \"<list>\"      " << rate_sweep_message << std::endl;
+    std::cout << "    -slo \"<float>\"            " << slo_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -13,6 +13,7 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -43,15 +44,23 @@ public:
 
     void startAsync() {
         _startTime = Time::now();
+        updateQueueTime();
         _request.StartAsync();
     }
 
+    /// @brief Sets the time the request was scheduled to arrive at (open-loop mode). The time spent before the
+    /// request is started is reported as the queueing time.
+    void setArrivalTime(const Time::time_point& arrivalTime) {
+        _arrivalTime = arrivalTime;
+    }
+
     void wait() {
         _request.Wait(InferenceEngine::InferRequest::RESULT_READY);
     }
 
     void infer() {
         _startTime = Time::now();
+        updateQueueTime();
         _request.Infer();
         _endTime = Time::now();
         _callbackQueue(_id, getExecutionTimeInMilliseconds());
@@ -74,10 +83,44 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueTimeInMilliseconds() const {
+        return _queueTime;
+    }
+
+    /// @brief Marks the request with the shape bucket of its current inputs (shape distribution replay)
+    void setShapeBucket(size_t bucket) {
+        _shapeBucket = static_cast<int>(bucket);
+        _firstSeenShape = _seenShapeBuckets.insert(bucket).second;
+    }
+
+    /// @brief Returns the shape bucket of the inputs, -1 if the inputs are not sampled from the distribution
+    int getShapeBucket() const {
+        return _shapeBucket;
+    }
+
+    /// @brief Returns true if the request is executed with the shape bucket for the first time
+    bool isFirstSeenShape() const {
+        return _firstSeenShape;
+    }
+
 private:
+    void updateQueueTime() {
+        if (_arrivalTime == Time::time_point::min()) {
+            _queueTime = 0.0;
+            return;
+        }
+        _queueTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime).count() * 0.000001;
+        _arrivalTime = Time::time_point::min();
+    }
+
     InferenceEngine::InferRequest _request;
     Time::time_point _startTime;
     Time::time_point _endTime;
+    Time::time_point _arrivalTime = Time::time_point::min();
+    double _queueTime = 0.0;
+    int _shapeBucket = -1;
+    bool _firstSeenShape = false;
+    std::set<size_t> _seenShapeBuckets;
     size_t _id;
     QueueCallbackFunction _callbackQueue;
 };
@@ -108,6 +151,9 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueTimes.clear();
+        _shapeBuckets.clear();
+        _firstSeenShapes.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -117,6 +163,9 @@ public:
     void putIdleRequest(size_t id, const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueTimes.push_back(requests.at(id)->getQueueTimeInMilliseconds());
+        _shapeBuckets.push_back(requests.at(id)->getShapeBucket());
+        _firstSeenShapes.push_back(requests.at(id)->isFirstSeenShape());
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -144,6 +193,21 @@ public:
         return _latencies;
     }
 
+    /// @brief Queueing times of the completed requests, in the same order as the latencies
+    std::vector<double> getQueueTimes() {
+        return _queueTimes;
+    }
+
+    /// @brief Shape buckets of the completed requests, in the same order as the latencies
+    std::vector<int> getShapeBuckets() {
+        return _shapeBuckets;
+    }
+
+    /// @brief Flags of the completed requests executed with the shape bucket for the first time
+    std::vector<bool> getFirstSeenShapes() {
+        return _firstSeenShapes;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -153,4 +217,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueTimes;
+    std::vector<int> _shapeBuckets;
+    std::vector<bool> _firstSeenShapes;
 };
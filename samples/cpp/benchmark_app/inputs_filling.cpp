@@ -195,6 +195,34 @@ void fillBlobRandom(Blob::Ptr& inputBlob,
     }
 }
 
+void fillBlobRandom(Blob::Ptr& inputBlob, const Precision& precision, const std::string& inputName) {
+    if (precision == Precision::FP32) {
+        fillBlobRandom<float, float>(inputBlob);
+    } else if (precision == Precision::FP16) {
+        fillBlobRandom<short, short>(inputBlob);
+    } else if (precision == Precision::I32) {
+        fillBlobRandom<int32_t, int32_t>(inputBlob);
+    } else if (precision == Precision::I64) {
+        fillBlobRandom<int64_t, int64_t>(inputBlob);
+    } else if (precision == Precision::U8) {
+        // uniform_int_distribution<uint8_t> is not allowed in the C++17
+        // standard and vs2017/19
+        fillBlobRandom<uint8_t, uint32_t>(inputBlob);
+    } else if (precision == Precision::I8) {
+        // uniform_int_distribution<int8_t> is not allowed in the C++17 standard
+        // and vs2017/19
+        fillBlobRandom<int8_t, int32_t>(inputBlob);
+    } else if (precision == Precision::U16) {
+        fillBlobRandom<uint16_t, uint16_t>(inputBlob);
+    } else if (precision == Precision::I16) {
+        fillBlobRandom<int16_t, int16_t>(inputBlob);
+    } else if (precision == Precision::BOOL) {
+        fillBlobRandom<uint8_t, uint32_t>(inputBlob, 0, 1);
+    } else {
+        IE_THROW() << "Input precision is not supported for " << inputName;
+    }
+}
+
 template <typename T>
 void fillBlobImInfo(Blob::Ptr& inputBlob, const size_t& batchSize, std::pair<size_t, size_t> image_size) {
     MemoryBlob::Ptr minput = as<MemoryBlob>(inputBlob);
@@ -422,31 +450,32 @@ void fillBlobs(const std::vector<std::string>& inputFiles,
             slog::info << "Fill input '" << item.first << "' with random values ("
                        << std::string((app_info.isImage() ? "image" : "some binary data")) << " is expected)"
                        << slog::endl;
-            if (precision == InferenceEngine::Precision::FP32) {
-                fillBlobRandom<float, float>(inputBlob);
-            } else if (precision == InferenceEngine::Precision::FP16) {
-                fillBlobRandom<short, short>(inputBlob);
-            } else if (precision == InferenceEngine::Precision::I32) {
-                fillBlobRandom<int32_t, int32_t>(inputBlob);
-            } else if (precision == InferenceEngine::Precision::I64) {
-                fillBlobRandom<int64_t, int64_t>(inputBlob);
-            } else if (precision == InferenceEngine::Precision::U8) {
-                // uniform_int_distribution<uint8_t> is not allowed in the C++17
-                // standard and vs2017/19
-                fillBlobRandom<uint8_t, uint32_t>(inputBlob);
-            } else if (precision == InferenceEngine::Precision::I8) {
-                // uniform_int_distribution<int8_t> is not allowed in the C++17 standard
-                // and vs2017/19
-                fillBlobRandom<int8_t, int32_t>(inputBlob);
-            } else if (precision == InferenceEngine::Precision::U16) {
-                fillBlobRandom<uint16_t, uint16_t>(inputBlob);
-            } else if (precision == InferenceEngine::Precision::I16) {
-                fillBlobRandom<int16_t, int16_t>(inputBlob);
-            } else if (precision == InferenceEngine::Precision::BOOL) {
-                fillBlobRandom<uint8_t, uint32_t>(inputBlob, 0, 1);
-            } else {
-                IE_THROW() << "Input precision is not supported for " << item.first;
-            }
+            fillBlobRandom(inputBlob, precision, item.first);
         }
     }
 }
+
+Blob::Ptr createRandomBlob(const std::string& inputName, const Precision& precision, const SizeVector& shape) {
+    TensorDesc desc(precision, shape, TensorDesc::getLayoutByDims(shape));
+    Blob::Ptr blob;
+    if (precision == Precision::FP32) {
+        blob = make_shared_blob<float>(desc);
+    } else if (precision == Precision::FP16 || precision == Precision::I16) {
+        blob = make_shared_blob<int16_t>(desc);
+    } else if (precision == Precision::I32) {
+        blob = make_shared_blob<int32_t>(desc);
+    } else if (precision == Precision::I64) {
+        blob = make_shared_blob<int64_t>(desc);
+    } else if (precision == Precision::U8 || precision == Precision::BOOL) {
+        blob = make_shared_blob<uint8_t>(desc);
+    } else if (precision == Precision::I8) {
+        blob = make_shared_blob<int8_t>(desc);
+    } else if (precision == Precision::U16) {
+        blob = make_shared_blob<uint16_t>(desc);
+    } else {
+        IE_THROW() << "Input precision is not supported for " << inputName;
+    }
+    blob->allocate();
+    fillBlobRandom(blob, precision, inputName);
+    return blob;
+}
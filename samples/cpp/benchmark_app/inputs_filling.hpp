@@ -14,4 +14,9 @@
 void fillBlobs(const std::vector<std::string>& inputFiles,
                const size_t& batchSize,
                benchmark_app::InputsInfo& app_inputs_info,
-               std::vector<InferReqWrap::Ptr> requests);
\ No newline at end of file
+               std::vector<InferReqWrap::Ptr> requests);
+
+/// @brief Creates the blob of the given shape filled with random values
+InferenceEngine::Blob::Ptr createRandomBlob(const std::string& inputName,
+                                            const InferenceEngine::Precision& precision,
+                                            const InferenceEngine::SizeVector& shape);
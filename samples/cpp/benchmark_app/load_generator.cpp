@@ -0,0 +1,152 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "load_generator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+ArrivalProcess parseArrivalProcess(const std::string& name) {
+    if (name == "constant")
+        return ArrivalProcess::CONSTANT;
+    if (name == "poisson")
+        return ArrivalProcess::POISSON;
+    if (name == "trace")
+        return ArrivalProcess::TRACE;
+    throw std::logic_error("Incorrect arrival process '" + name +
+                           "'. Please set -arrival option to `constant`, `poisson` or `trace` value.");
+}
+
+std::vector<uint64_t> readArrivalTrace(const std::string& filePath) {
+    std::ifstream file(filePath);
+    if (!file.is_open())
+        throw std::logic_error("Can't open the arrival trace file " + filePath);
+
+    std::vector<uint64_t> arrivals;
+    double first = 0.0, previous = 0.0;
+    std::string line;
+    while (std::getline(file, line)) {
+        line.erase(0, line.find_first_not_of(" \t\r"));
+        if (line.empty() || line[0] == '#')
+            continue;
+        const double timestamp = std::stod(line);
+        if (arrivals.empty()) {
+            first = timestamp;
+        } else if (timestamp < previous) {
+            throw std::logic_error("Timestamps in the arrival trace file " + filePath + " must be non-decreasing");
+        }
+        previous = timestamp;
+        arrivals.push_back(static_cast<uint64_t>((timestamp - first) * 1000000.0));
+    }
+    if (arrivals.empty())
+        throw std::logic_error("The arrival trace file " + filePath + " has no timestamps");
+    return arrivals;
+}
+
+std::vector<uint64_t> generateArrivals(ArrivalProcess process,
+                                       double rate,
+                                       uint64_t durationNs,
+                                       size_t count,
+                                       const std::vector<uint64_t>& trace) {
+    auto limitReached = [&](const std::vector<uint64_t>& arrivals, uint64_t next) {
+        return (count != 0 && arrivals.size() >= count) || (durationNs != 0 && next >= durationNs);
+    };
+
+    std::vector<uint64_t> arrivals;
+    if (process == ArrivalProcess::TRACE) {
+        for (auto arrival : trace) {
+            if (limitReached(arrivals, arrival))
+                break;
+            arrivals.push_back(arrival);
+        }
+        return arrivals;
+    }
+
+    if (rate <= 0.0)
+        throw std::logic_error("Arrival rate must be positive. Please set -rate option.");
+    if (count == 0 && durationNs == 0)
+        throw std::logic_error("Open-loop run must be limited by the time or by the number of iterations");
+
+    const double meanIntervalNs = 1000000000.0 / rate;
+    // fixed seed, so the runs with the same rate are reproducible
+    std::mt19937_64 generator(0);
+    std::exponential_distribution<double> interval(1.0);
+    double next = 0.0;
+    while (!limitReached(arrivals, static_cast<uint64_t>(next))) {
+        arrivals.push_back(static_cast<uint64_t>(next));
+        next += (process == ArrivalProcess::POISSON ? interval(generator) : 1.0) * meanIntervalNs;
+    }
+    return arrivals;
+}
+
+namespace {
+// nearest-rank percentile of the sorted values
+double getSortedPercentile(const std::vector<double>& sorted, double percentile) {
+    auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+    return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+}
+}  // namespace
+
+double getPercentile(std::vector<double> values, double percentile) {
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    return getSortedPercentile(values, percentile);
+}
+
+LatencyStatistics LatencyStatistics::compute(std::vector<double> values) {
+    LatencyStatistics statistics;
+    if (values.empty())
+        return statistics;
+    std::sort(values.begin(), values.end());
+    statistics.p50 = getSortedPercentile(values, 50);
+    statistics.p90 = getSortedPercentile(values, 90);
+    statistics.p99 = getSortedPercentile(values, 99);
+    statistics.p999 = getSortedPercentile(values, 99.9);
+    statistics.max = values.back();
+    statistics.avg = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    return statistics;
+}
+
+OpenLoopResult runOpenLoop(InferRequestsQueue& inferRequestsQueue,
+                           const std::vector<uint64_t>& arrivals,
+                           const std::function<void(const InferReqWrap::Ptr&)>& prepareRequest) {
+    inferRequestsQueue.resetTimes();
+
+    const auto startTime = Time::now();
+    for (auto arrival : arrivals) {
+        const auto arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(ns(arrival));
+        std::this_thread::sleep_until(arrivalTime);
+
+        // blocks if all the requests are busy, the waiting time is accounted as the queueing time
+        auto inferRequest = inferRequestsQueue.getIdleRequest();
+        if (!inferRequest) {
+            throw std::logic_error("No idle Infer Requests!");
+        }
+        // rethrows the error of the previous execution of this request, if any
+        inferRequest->wait();
+        if (prepareRequest) {
+            prepareRequest(inferRequest);
+        }
+        inferRequest->setArrivalTime(arrivalTime);
+        inferRequest->startAsync();
+    }
+    inferRequestsQueue.waitAll();
+
+    OpenLoopResult result;
+    result.inferTimes = inferRequestsQueue.getLatencies();
+    result.queueTimes = inferRequestsQueue.getQueueTimes();
+    result.count = result.inferTimes.size();
+    result.durationMs = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
+    result.totalTimes.resize(result.count);
+    for (size_t i = 0; i < result.count; i++) {
+        result.totalTimes[i] = result.queueTimes[i] + result.inferTimes[i];
+    }
+    return result;
+}
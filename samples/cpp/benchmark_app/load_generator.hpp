@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+
+/// @brief Arrival processes of the open-loop load generator
+enum class ArrivalProcess {
+    CONSTANT,  //!< requests arrive at a constant rate
+    POISSON,   //!< exponentially distributed inter-arrival times with the given mean rate
+    TRACE,     //!< arrival timestamps are replayed from a trace file
+};
+
+ArrivalProcess parseArrivalProcess(const std::string& name);
+
+/**
+ * @brief Reads the arrival timestamps from the trace file: one timestamp in milliseconds per line, lines starting
+ * with '#' are skipped. The timestamps must be non-decreasing, they are shifted to start from zero.
+ * @return Arrival offsets in nanoseconds
+ */
+std::vector<uint64_t> readArrivalTrace(const std::string& filePath);
+
+/**
+ * @brief Generates the arrival offsets (in nanoseconds from the start) of the open-loop run
+ * @param process Arrival process
+ * @param rate Mean number of requests per second, not used for the trace
+ * @param durationNs Time limit, 0 if not limited
+ * @param count Number of requests limit, 0 if not limited
+ * @param trace Arrival offsets read from the trace file
+ */
+std::vector<uint64_t> generateArrivals(ArrivalProcess process,
+                                       double rate,
+                                       uint64_t durationNs,
+                                       size_t count,
+                                       const std::vector<uint64_t>& trace);
+
+/// @brief Latency distribution summary, all values are in milliseconds
+struct LatencyStatistics {
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double max = 0.0;
+    double avg = 0.0;
+
+    static LatencyStatistics compute(std::vector<double> values);
+};
+
+/// @brief Nearest-rank percentile of the values, percentile is in the (0, 100] range
+double getPercentile(std::vector<double> values, double percentile);
+
+/// @brief Results of the open-loop run
+struct OpenLoopResult {
+    size_t count = 0;
+    double durationMs = 0.0;
+    // time from the scheduled arrival until the request is started
+    std::vector<double> queueTimes;
+    std::vector<double> inferTimes;
+    // queueing time plus inference time
+    std::vector<double> totalTimes;
+};
+
+/**
+ * @brief Submits the requests at the given arrival times regardless of the completions. If no request is idle at
+ * the arrival time, the request waits for one and the waiting time is accounted as the queueing time, so the
+ * latency is measured from the scheduled arrival and not from the actual submission.
+ * The prepareRequest function, if set, is called for each request before it is started (e.g. to set the inputs).
+ */
+OpenLoopResult runOpenLoop(InferRequestsQueue& inferRequestsQueue,
+                           const std::vector<uint64_t>& arrivals,
+                           const std::function<void(const InferReqWrap::Ptr&)>& prepareRequest = nullptr);
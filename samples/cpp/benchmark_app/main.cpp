@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <gna/gna_config.hpp>
 #include <gpu/gpu_config.hpp>
 #include <inference_engine.hpp>
@@ -20,8 +21,10 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "progress_bar.hpp"
 #include "remote_blobs_filling.hpp"
+#include "shape_distribution.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
 
@@ -64,6 +67,26 @@ bool ParseAndCheckCommandLine(int argc, char* argv[]) {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
                                "either `throughput`(tput) or `latency' value.");
     }
+    if (!FLAGS_arrival.empty() || !FLAGS_rate_sweep.empty()) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop mode requires async API. Please set -api option to `async` value.");
+        }
+        auto process = FLAGS_arrival.empty() ? ArrivalProcess::CONSTANT : parseArrivalProcess(FLAGS_arrival);
+        if (process == ArrivalProcess::TRACE) {
+            if (FLAGS_arrival_trace.empty()) {
+                throw std::logic_error("Trace arrival process requires the timestamps file. Please set -arrival_trace "
+                                       "option.");
+            }
+            if (!FLAGS_rate_sweep.empty()) {
+                throw std::logic_error("-rate_sweep option can't be used with the trace arrival process.");
+            }
+        } else if (FLAGS_rate_sweep.empty() && FLAGS_rate <= 0.0) {
+            throw std::logic_error("Arrival rate must be positive. Please set -rate option.");
+        }
+    }
+    if (FLAGS_slo < 0.0) {
+        throw std::logic_error("Latency SLO must not be negative. Please set -slo option to a positive value.");
+    }
     if (!FLAGS_report_type.empty() && FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport &&
         FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" +
@@ -386,6 +409,7 @@ int main(int argc, char* argv[]) {
         Precision precision = Precision::UNSPECIFIED;
         std::string topology_name = "";
         benchmark_app::InputsInfo app_inputs_info;
+        std::vector<ShapeBucket> shapeBuckets;
         std::string output_name;
 
         // Takes priority over config from file
@@ -465,6 +489,19 @@ int main(int argc, char* argv[]) {
             // use batch size according to provided layout and shapes
             batchSize = (!FLAGS_layout.empty()) ? getBatchSize(app_inputs_info) : cnnNetwork.getBatchSize();
 
+            if (!FLAGS_shape_distribution.empty()) {
+                // the dimensions differing between the buckets become dynamic
+                shapeBuckets = readShapeDistribution(FLAGS_shape_distribution, app_inputs_info);
+                auto partialShapes = getShapeDistributionPartialShapes(shapeBuckets, app_inputs_info);
+                slog::info << "Reshaping network to cover " << shapeBuckets.size() << " shape buckets" << slog::endl;
+                startTime = Time::now();
+                IE_SUPPRESS_DEPRECATED_START
+                cnnNetwork.reshape(partialShapes);
+                IE_SUPPRESS_DEPRECATED_END
+                duration_ms = double_to_string(get_total_ms_time(startTime));
+                slog::info << "Reshape network took " << duration_ms << " ms" << slog::endl;
+            }
+
             topology_name = cnnNetwork.getName();
             slog::info << (FLAGS_b != 0 ? "Network batch size was changed to: " : "Network batch size: ") << batchSize
                        << slog::endl;
@@ -523,6 +560,10 @@ int main(int argc, char* argv[]) {
                 batchSize = 1;
             }
         }
+        if (!FLAGS_shape_distribution.empty() && shapeBuckets.empty()) {
+            shapeBuckets = readShapeDistribution(FLAGS_shape_distribution, app_inputs_info);
+        }
+
         // ----------------- 8. Querying optimal runtime parameters
         // -----------------------------------------------------
         next_step();
@@ -615,7 +656,22 @@ int main(int argc, char* argv[]) {
         next_step();
 
         InferRequestsQueue inferRequestsQueue(exeNetwork, nireq);
-        if (isFlagSetInCommandLine("use_device_mem")) {
+        std::vector<std::map<std::string, Blob::Ptr>> shapeBucketBlobs;
+        std::function<void(const InferReqWrap::Ptr&)> prepareRequest;
+        if (!shapeBuckets.empty()) {
+            if (isFlagSetInCommandLine("use_device_mem"))
+                IE_THROW() << "-shape_distribution option can't be used with -use_device_mem option.";
+            // the inputs of each request are sampled from the shape distribution before the request is started
+            shapeBucketBlobs = createShapeBucketBlobs(shapeBuckets, app_inputs_info);
+            auto sampler = std::make_shared<ShapeSampler>(shapeBuckets);
+            prepareRequest = [sampler, &shapeBucketBlobs](const InferReqWrap::Ptr& request) {
+                const auto bucket = sampler->next();
+                for (const auto& input : shapeBucketBlobs[bucket]) {
+                    request->setBlob(input.first, input.second);
+                }
+                request->setShapeBucket(bucket);
+            };
+        } else if (isFlagSetInCommandLine("use_device_mem")) {
             if (device_name.find("GPU") == 0)
                 ::gpu::fillRemoteBlobs(inputFiles, batchSize, app_inputs_info, inferRequestsQueue.requests, exeNetwork);
             else if (device_name.find("CPU") == 0)
@@ -670,6 +726,9 @@ int main(int argc, char* argv[]) {
         if (!inferRequest) {
             IE_THROW() << "No idle Infer Requests!";
         }
+        if (prepareRequest) {
+            prepareRequest(inferRequest);
+        }
         if (FLAGS_api == "sync") {
             inferRequest->infer();
         } else {
@@ -683,59 +742,134 @@ int main(int argc, char* argv[]) {
                                       {{"first inference time (ms)", duration_ms}});
         inferRequestsQueue.resetTimes();
 
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                IE_THROW() << "No idle Infer Requests!";
+        double latency = 0.0;
+        double totalDuration = 0.0;
+        double fps = 0.0;
+        const bool openLoop = !FLAGS_arrival.empty() || !FLAGS_rate_sweep.empty();
+        OpenLoopResult openLoopResult;
+        std::vector<std::string> rateSweepReport;
+        double throughputAtSlo = 0.0;
+        if (openLoop) {
+            /** Submit the requests at the arrival times, the latency includes the queueing time **/
+            const auto process =
+                FLAGS_arrival.empty() ? ArrivalProcess::CONSTANT : parseArrivalProcess(FLAGS_arrival);
+            std::vector<uint64_t> trace;
+            if (process == ArrivalProcess::TRACE) {
+                trace = readArrivalTrace(FLAGS_arrival_trace);
             }
-
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
+            std::vector<double> rates;
+            if (FLAGS_rate_sweep.empty()) {
+                rates.push_back(FLAGS_rate);
             } else {
-                // As the inference request is currently idle, the wait() adds no
-                // additional overhead (and should return immediately). The primary
-                // reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as
-                // well, but as it uses just error codes it has no details like ‘what()’
-                // method of `std::exception` So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->startAsync();
+                for (const auto& rate : split(FLAGS_rate_sweep, ',')) {
+                    rates.push_back(std::stod(rate));
+                }
             }
-            iteration++;
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+            for (auto rate : rates) {
+                const auto arrivals = generateArrivals(process, rate, duration_nanoseconds, niter, trace);
+                openLoopResult = runOpenLoop(inferRequestsQueue, arrivals, prepareRequest);
+                progressBar.addProgress(progressBarTotalCount / rates.size());
 
-            if (niter > 0) {
-                progressBar.addProgress(1);
-            } else {
-                // calculate how many progress intervals are covered by current
-                // iteration. depends on the current iteration time and time of each
-                // progress interval. Previously covered progress intervals must be
-                // skipped.
-                auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
-                size_t newProgress = execTime / progressIntervalTime - progressCnt;
-                progressBar.addProgress(newProgress);
-                progressCnt += newProgress;
+                const auto total = LatencyStatistics::compute(openLoopResult.totalTimes);
+                const double runFps = batchSize * 1000.0 * openLoopResult.count / openLoopResult.durationMs;
+                const bool sloMet = FLAGS_slo > 0.0 && total.p99 <= FLAGS_slo;
+                if (sloMet) {
+                    throughputAtSlo = std::max(throughputAtSlo, runFps);
+                }
+                if (rates.size() > 1) {
+                    std::stringstream line;
+                    line << "Rate " << double_to_string(rate) << " req/s: throughput " << double_to_string(runFps)
+                         << " FPS, p99 latency " << double_to_string(total.p99) << " ms";
+                    if (FLAGS_slo > 0.0) {
+                        line << (sloMet ? " (SLO met)" : " (SLO violated)");
+                    }
+                    rateSweepReport.push_back(line.str());
+                    if (statistics) {
+                        statistics->addParameters(
+                            StatisticsReport::Category::EXECUTION_RESULTS,
+                            {
+                                {"throughput at rate " + double_to_string(rate), double_to_string(runFps)},
+                                {"p99 latency at rate " + double_to_string(rate) + " (ms)",
+                                 double_to_string(total.p99)},
+                            });
+                    }
+                }
             }
-        }
 
-        // wait the latest inference executions
-        inferRequestsQueue.waitAll();
+            // the last run is reported as the main result
+            iteration = openLoopResult.count;
+            totalDuration = openLoopResult.durationMs;
+            latency = getPercentile(openLoopResult.totalTimes, FLAGS_latency_percentile);
+            fps = batchSize * 1000.0 * iteration / totalDuration;
+        } else {
+            auto startTime = Time::now();
+            auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                inferRequest = inferRequestsQueue.getIdleRequest();
+                if (!inferRequest) {
+                    IE_THROW() << "No idle Infer Requests!";
+                }
+
+                if (FLAGS_api == "sync") {
+                    if (prepareRequest) {
+                        prepareRequest(inferRequest);
+                    }
+                    inferRequest->infer();
+                } else {
+                    // As the inference request is currently idle, the wait() adds no
+                    // additional overhead (and should return immediately). The primary
+                    // reason for calling the method is exception checking/re-throwing.
+                    // Callback, that governs the actual execution can handle errors as
+                    // well, but as it uses just error codes it has no details like ‘what()’
+                    // method of `std::exception` So, rechecking for any exceptions here.
+                    inferRequest->wait();
+                    if (prepareRequest) {
+                        prepareRequest(inferRequest);
+                    }
+                    inferRequest->startAsync();
+                }
+                iteration++;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+                if (niter > 0) {
+                    progressBar.addProgress(1);
+                } else {
+                    // calculate how many progress intervals are covered by current
+                    // iteration. depends on the current iteration time and time of each
+                    // progress interval. Previously covered progress intervals must be
+                    // skipped.
+                    auto progressIntervalTime = duration_nanoseconds / progressBarTotalCount;
+                    size_t newProgress = execTime / progressIntervalTime - progressCnt;
+                    progressBar.addProgress(newProgress);
+                    progressCnt += newProgress;
+                }
+            }
+
+            // wait the latest inference executions
+            inferRequestsQueue.waitAll();
+
+            latency = getMedianValue<double>(inferRequestsQueue.getLatencies(), FLAGS_latency_percentile);
+            totalDuration = inferRequestsQueue.getDurationInMilliseconds();
+            fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
+        }
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies(), FLAGS_latency_percentile);
-        double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps =
-            (FLAGS_api == "sync") ? batchSize * 1000.0 / latency : batchSize * 1000.0 * iteration / totalDuration;
+        std::vector<ShapeBucketStatistics> shapeBucketStatistics;
+        if (!shapeBuckets.empty()) {
+            shapeBucketStatistics = computeShapeBucketStatistics(shapeBuckets.size(),
+                                                                 inferRequestsQueue.getLatencies(),
+                                                                 inferRequestsQueue.getShapeBuckets(),
+                                                                 inferRequestsQueue.getFirstSeenShapes());
+        }
 
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -757,6 +891,42 @@ int main(int argc, char* argv[]) {
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {{"throughput", double_to_string(fps)}});
+            if (openLoop) {
+                const std::vector<std::pair<std::string, std::vector<double>>> distributions = {
+                    {"total latency", openLoopResult.totalTimes},
+                    {"queueing time", openLoopResult.queueTimes},
+                    {"inference time", openLoopResult.inferTimes}};
+                for (const auto& distribution : distributions) {
+                    const auto stats = LatencyStatistics::compute(distribution.second);
+                    statistics->addParameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {
+                            {distribution.first + " p50 (ms)", double_to_string(stats.p50)},
+                            {distribution.first + " p90 (ms)", double_to_string(stats.p90)},
+                            {distribution.first + " p99 (ms)", double_to_string(stats.p99)},
+                            {distribution.first + " p99.9 (ms)", double_to_string(stats.p999)},
+                            {distribution.first + " max (ms)", double_to_string(stats.max)},
+                        });
+                }
+                if (FLAGS_slo > 0.0) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {{"throughput at SLO", double_to_string(throughputAtSlo)}});
+                }
+            }
+            for (size_t i = 0; i < shapeBucketStatistics.size(); i++) {
+                const auto& bucket = shapeBucketStatistics[i];
+                const auto prefix = "shapes " + shapeBuckets[i].name + " ";
+                statistics->addParameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {
+                        {prefix + "count", std::to_string(bucket.count)},
+                        {prefix + "throughput", double_to_string(batchSize * 1000.0 * bucket.count / totalDuration)},
+                        {prefix + "p50 latency (ms)", double_to_string(bucket.latency.p50)},
+                        {prefix + "p99 latency (ms)", double_to_string(bucket.latency.p99)},
+                        {prefix + "first-seen latency (ms)", double_to_string(bucket.firstSeenAvg)},
+                        {prefix + "repeated latency (ms)", double_to_string(bucket.repeatedAvg)},
+                    });
+            }
         }
 
         progressBar.finish();
@@ -812,6 +982,41 @@ int main(int argc, char* argv[]) {
             std::cout << double_to_string(latency) << " ms" << std::endl;
         }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (openLoop) {
+            auto printDistribution = [&](const std::string& name, const std::vector<double>& values) {
+                const auto stats = LatencyStatistics::compute(values);
+                std::cout << "    " << std::left << std::setw(12) << name << std::right;
+                for (auto value : {stats.p50, stats.p90, stats.p99, stats.p999, stats.max}) {
+                    std::cout << std::setw(10) << double_to_string(value);
+                }
+                std::cout << std::endl;
+            };
+            std::cout << "Latency distribution (ms):" << std::endl;
+            std::cout << "                       p50       p90       p99     p99.9       max" << std::endl;
+            printDistribution("total", openLoopResult.totalTimes);
+            printDistribution("queueing", openLoopResult.queueTimes);
+            printDistribution("inference", openLoopResult.inferTimes);
+            for (const auto& line : rateSweepReport) {
+                std::cout << line << std::endl;
+            }
+            if (FLAGS_slo > 0.0) {
+                std::cout << "Throughput at SLO (p99 <= " << double_to_string(FLAGS_slo)
+                          << " ms): " << double_to_string(throughputAtSlo) << " FPS" << std::endl;
+            }
+        }
+        if (!shapeBucketStatistics.empty()) {
+            // the first execution of a shape on a request includes the shape-dependent preparations of the device
+            std::cout << "Statistics per shape bucket (inference latency, ms):" << std::endl;
+            for (size_t i = 0; i < shapeBucketStatistics.size(); i++) {
+                const auto& bucket = shapeBucketStatistics[i];
+                std::cout << "    " << shapeBuckets[i].name << ": count " << bucket.count << ", throughput "
+                          << double_to_string(batchSize * 1000.0 * bucket.count / totalDuration) << " FPS, p50 "
+                          << double_to_string(bucket.latency.p50) << ", p99 " << double_to_string(bucket.latency.p99)
+                          << ", max " << double_to_string(bucket.latency.max) << ", first-seen avg "
+                          << double_to_string(bucket.firstSeenAvg) << " (" << bucket.firstSeenCount
+                          << " times), repeated avg " << double_to_string(bucket.repeatedAvg) << std::endl;
+            }
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_distribution.hpp"
+
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+#include "inputs_filling.hpp"
+
+using namespace InferenceEngine;
+
+std::vector<ShapeBucket> readShapeDistribution(const std::string& filePath,
+                                               const benchmark_app::InputsInfo& inputs_info) {
+    std::ifstream file(filePath);
+    if (!file.is_open())
+        throw std::logic_error("Can't open the shape distribution file " + filePath);
+
+    std::vector<ShapeBucket> buckets;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        ShapeBucket bucket;
+        if (!(ss >> bucket.name) || bucket.name[0] == '#')
+            continue;
+        if (!(ss >> bucket.weight))
+            bucket.weight = 1.0;
+        if (bucket.weight < 0.0)
+            throw std::logic_error("Negative weight of the shapes " + bucket.name + " in " + filePath);
+
+        for (const auto& item : parseInputParameters(bucket.name, inputs_info)) {
+            SizeVector shape;
+            for (const auto& dim : split(item.second, ',')) {
+                shape.push_back(std::stoi(dim));
+            }
+            bucket.shapes[item.first] = shape;
+        }
+        buckets.push_back(bucket);
+    }
+    if (buckets.empty())
+        throw std::logic_error("The shape distribution file " + filePath + " has no shapes");
+    return buckets;
+}
+
+std::map<std::string, ngraph::PartialShape> getShapeDistributionPartialShapes(
+    const std::vector<ShapeBucket>& buckets,
+    const benchmark_app::InputsInfo& inputs_info) {
+    std::map<std::string, ngraph::PartialShape> partialShapes;
+    for (const auto& input : inputs_info) {
+        std::vector<ngraph::Dimension> dims;
+        bool initialized = false;
+        for (const auto& bucket : buckets) {
+            auto found = bucket.shapes.find(input.first);
+            const auto& shape = found != bucket.shapes.end() ? found->second : input.second.shape;
+            if (!initialized) {
+                dims.assign(shape.begin(), shape.end());
+                initialized = true;
+            } else if (dims.size() != shape.size()) {
+                throw std::logic_error("Shapes of the input '" + input.first +
+                                       "' in the shape distribution have different ranks");
+            }
+            for (size_t i = 0; i < shape.size(); i++) {
+                if (dims[i].is_static() && dims[i].get_length() != static_cast<int64_t>(shape[i]))
+                    dims[i] = ngraph::Dimension::dynamic();
+            }
+        }
+        partialShapes[input.first] = ngraph::PartialShape(dims);
+    }
+    return partialShapes;
+}
+
+std::vector<std::map<std::string, Blob::Ptr>> createShapeBucketBlobs(const std::vector<ShapeBucket>& buckets,
+                                                                     const benchmark_app::InputsInfo& inputs_info) {
+    std::vector<std::map<std::string, Blob::Ptr>> blobs(buckets.size());
+    for (size_t i = 0; i < buckets.size(); i++) {
+        for (const auto& input : inputs_info) {
+            auto found = buckets[i].shapes.find(input.first);
+            const auto& shape = found != buckets[i].shapes.end() ? found->second : input.second.shape;
+            // the blobs are only read by the requests, so the requests of the same bucket share them
+            blobs[i][input.first] = createRandomBlob(input.first, input.second.precision, shape);
+        }
+    }
+    return blobs;
+}
+
+ShapeSampler::ShapeSampler(const std::vector<ShapeBucket>& buckets) : _generator(0) {
+    std::vector<double> weights;
+    for (const auto& bucket : buckets) {
+        weights.push_back(bucket.weight);
+    }
+    if (std::accumulate(weights.begin(), weights.end(), 0.0) <= 0.0)
+        throw std::logic_error("Total weight of the shape distribution must be positive");
+    _distribution = std::discrete_distribution<size_t>(weights.begin(), weights.end());
+}
+
+size_t ShapeSampler::next() {
+    return _distribution(_generator);
+}
+
+std::vector<ShapeBucketStatistics> computeShapeBucketStatistics(size_t bucketsCount,
+                                                                const std::vector<double>& latencies,
+                                                                const std::vector<int>& shapeBuckets,
+                                                                const std::vector<bool>& firstSeenShapes) {
+    std::vector<std::vector<double>> bucketLatencies(bucketsCount);
+    std::vector<double> firstSeenSum(bucketsCount, 0.0), repeatedSum(bucketsCount, 0.0);
+    std::vector<ShapeBucketStatistics> statistics(bucketsCount);
+    for (size_t i = 0; i < latencies.size(); i++) {
+        if (shapeBuckets[i] < 0 || static_cast<size_t>(shapeBuckets[i]) >= bucketsCount)
+            continue;
+        const auto bucket = static_cast<size_t>(shapeBuckets[i]);
+        bucketLatencies[bucket].push_back(latencies[i]);
+        if (firstSeenShapes[i]) {
+            statistics[bucket].firstSeenCount++;
+            firstSeenSum[bucket] += latencies[i];
+        } else {
+            repeatedSum[bucket] += latencies[i];
+        }
+    }
+    for (size_t bucket = 0; bucket < bucketsCount; bucket++) {
+        auto& bucketStatistics = statistics[bucket];
+        bucketStatistics.count = bucketLatencies[bucket].size();
+        bucketStatistics.latency = LatencyStatistics::compute(bucketLatencies[bucket]);
+        const auto repeatedCount = bucketStatistics.count - bucketStatistics.firstSeenCount;
+        if (bucketStatistics.firstSeenCount != 0)
+            bucketStatistics.firstSeenAvg = firstSeenSum[bucket] / bucketStatistics.firstSeenCount;
+        if (repeatedCount != 0)
+            bucketStatistics.repeatedAvg = repeatedSum[bucket] / repeatedCount;
+    }
+    return statistics;
+}
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <inference_engine.hpp>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "load_generator.hpp"
+#include "utils.hpp"
+
+/// @brief Input shapes of the requests sampled with the given weight
+struct ShapeBucket {
+    std::string name;
+    std::map<std::string, InferenceEngine::SizeVector> shapes;
+    double weight = 1.0;
+};
+
+/**
+ * @brief Reads the shape distribution file. Each line is "<shapes> [<weight>]" where the shapes are given in the
+ * -shape option format, e.g. "input_ids[1,128],attention_mask[1,128] 35". The weight is 1 if not set, lines
+ * starting with '#' are skipped. The inputs not listed in a bucket keep their shapes.
+ */
+std::vector<ShapeBucket> readShapeDistribution(const std::string& filePath,
+                                               const benchmark_app::InputsInfo& inputs_info);
+
+/// @brief Returns the input shapes covering all the buckets: the dimensions which differ between the buckets are
+/// dynamic
+std::map<std::string, ngraph::PartialShape> getShapeDistributionPartialShapes(
+    const std::vector<ShapeBucket>& buckets,
+    const benchmark_app::InputsInfo& inputs_info);
+
+/// @brief Creates the input blobs filled with random values for each bucket
+std::vector<std::map<std::string, InferenceEngine::Blob::Ptr>> createShapeBucketBlobs(
+    const std::vector<ShapeBucket>& buckets,
+    const benchmark_app::InputsInfo& inputs_info);
+
+/// @brief Samples the shape buckets according to their weights, the sequence is reproducible
+class ShapeSampler {
+public:
+    explicit ShapeSampler(const std::vector<ShapeBucket>& buckets);
+
+    size_t next();
+
+private:
+    std::mt19937 _generator;
+    std::discrete_distribution<size_t> _distribution;
+};
+
+/// @brief Execution statistics of the requests of one shape bucket
+struct ShapeBucketStatistics {
+    size_t count = 0;
+    LatencyStatistics latency;
+    // first execution of the bucket on an infer request vs. the executions with the already seen shapes
+    size_t firstSeenCount = 0;
+    double firstSeenAvg = 0.0;
+    double repeatedAvg = 0.0;
+};
+
+std::vector<ShapeBucketStatistics> computeShapeBucketStatistics(size_t bucketsCount,
+                                                                const std::vector<double>& latencies,
+                                                                const std::vector<int>& shapeBuckets,
+                                                                const std::vector<bool>& firstSeenShapes);
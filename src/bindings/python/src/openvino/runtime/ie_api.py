@@ -55,12 +55,16 @@ def get_input_types(obj: Union[InferRequestBase, ExecutableNetworkBase]) -> dict
 class InferRequest(InferRequestBase):
     """InferRequest wrapper."""
 
-    def infer(self, inputs: dict = None) -> dict:
-        """Infer wrapper for InferRequest."""
+    def infer(self, inputs: dict = None, shared_memory: bool = False) -> dict:
+        """Infer wrapper for InferRequest.
+
+        If shared_memory is True, the returned arrays are views of the output tensors of the request,
+        which are overwritten by the next inference.
+        """
         inputs = (
             {} if inputs is None else normalize_inputs(inputs, get_input_types(self))
         )
-        return super().infer(inputs)
+        return super().infer(inputs, shared_memory)
 
     def start_async(self, inputs: dict = None, userdata: Any = None) -> None:
         """Asynchronous infer wrapper for InferRequest."""
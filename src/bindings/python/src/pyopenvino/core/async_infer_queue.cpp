@@ -7,11 +7,15 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "pyopenvino/core/common.hpp"
@@ -19,101 +23,313 @@
 
 namespace py = pybind11;
 
+// Bounded lock-free MPMC queue of the request handles (D. Vyukov's algorithm).
+// Each handle is enqueued at most once at a time, so the number of requests is enough for the capacity.
+class HandlesQueue {
+public:
+    explicit HandlesQueue(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _cells.reset(new Cell[size]);
+        _mask = size - 1;
+        for (size_t i = 0; i < size; i++) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(size_t handle) {
+        size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = _cells[pos & _mask];
+            auto diff = static_cast<std::ptrdiff_t>(cell.sequence.load(std::memory_order_acquire)) -
+                        static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.handle = handle;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    _size.fetch_add(1);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(size_t& handle) {
+        size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = _cells[pos & _mask];
+            auto diff = static_cast<std::ptrdiff_t>(cell.sequence.load(std::memory_order_acquire)) -
+                        static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    handle = cell.handle;
+                    cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+                    _size.fetch_sub(1);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // The size is updated after the handle is published, so it may be behind the queue for a moment
+    bool empty() const {
+        return _size.load() <= 0;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        size_t handle;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask = 0;
+    std::atomic<size_t> _enqueue_pos{0};
+    std::atomic<size_t> _dequeue_pos{0};
+    std::atomic<std::ptrdiff_t> _size{0};
+};
+
 class AsyncInferQueue {
 public:
-    AsyncInferQueue(std::vector<InferRequestWrapper> requests,
-                    std::queue<size_t> idle_handles,
-                    std::vector<py::object> user_ids)
+    AsyncInferQueue(std::vector<InferRequestWrapper> requests, std::vector<py::object> user_ids)
         : _requests(requests),
-          _idle_handles(idle_handles),
-          _user_ids(user_ids) {
+          _user_ids(user_ids),
+          _exceptions(requests.size()),
+          _idle_handles(requests.size()),
+          _completed_handles(requests.size()),
+          _idle_count(requests.size()) {
+        for (size_t handle = 0; handle < _requests.size(); handle++) {
+            _idle_handles.push(handle);
+        }
         this->set_default_callbacks();
     }
 
     ~AsyncInferQueue() {
+        // the callbacks of the running requests use the queue, so they must be finished first
+        wait_until([this] {
+            return _idle_count.load() == _requests.size();
+        });
+        if (_dispatcher.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(_dispatch_mutex);
+                _stop_dispatching = true;
+            }
+            _dispatch_cv.notify_one();
+            // the dispatcher may wait for the GIL to run the last callbacks
+            py::gil_scoped_release release;
+            _dispatcher.join();
+        }
         _requests.clear();
     }
 
     bool _is_ready() {
-        py::gil_scoped_release release;
-        std::unique_lock<std::mutex> lock(_mutex);
-        _cv.wait(lock, [this] {
-            return !(_idle_handles.empty());
+        wait_until([this] {
+            return _idle_count.load() != 0;
         });
-        if (_errors.size() > 0)
-            throw _errors.front();
-        return !(_idle_handles.empty());
+        raise_errors();
+        return _idle_count.load() != 0;
     }
 
     size_t get_idle_request_id() {
-        // Wait for any of _idle_handles
-        py::gil_scoped_release release;
-        std::unique_lock<std::mutex> lock(_mutex);
-        _cv.wait(lock, [this] {
-            return !(_idle_handles.empty());
-        });
-        if (_errors.size() > 0)
-            throw _errors.front();
-        return _idle_handles.front();
+        // Wait for any of idle handles and reserve it for the next start_async call
+        if (!_has_reserved_handle) {
+            size_t handle = 0;
+            wait_until([this, &handle] {
+                return _idle_handles.pop(handle);
+            });
+            if (_has_reserved_handle) {
+                // reserved by another Python thread while the GIL was released
+                _idle_handles.push(handle);
+            } else {
+                _reserved_handle = handle;
+                _has_reserved_handle = true;
+            }
+        }
+        raise_errors();
+        return _reserved_handle;
+    }
+
+    void start_async(const py::dict& inputs, py::object userdata) {
+        // get_idle_request_id function has an intention to block InferQueue
+        // until there is at least one idle (free to use) InferRequest
+        auto handle = get_idle_request_id();
+        // Set new inputs label/id from user
+        _user_ids[handle] = userdata;
+        // Update inputs if there are any
+        Common::set_request_tensors(_requests[handle]._request, inputs);
+        _has_reserved_handle = false;
+        _idle_count.fetch_sub(1);
+        // Now GIL can be released - we are NOT working with Python objects in this block
+        {
+            py::gil_scoped_release release;
+            _requests[handle]._start_time = Time::now();
+            // Start InferRequest in asynchronus mode
+            _requests[handle]._request.start_async();
+        }
     }
 
     void wait_all() {
         // Wait for all requests to return with callback thus updating
-        // _idle_handles so it matches the size of requests
-        py::gil_scoped_release release;
-        std::unique_lock<std::mutex> lock(_mutex);
-        _cv.wait(lock, [this] {
-            return _idle_handles.size() == _requests.size();
+        // idle handles so it matches the size of requests
+        wait_until([this] {
+            return _idle_count.load() == _requests.size();
         });
-        if (_errors.size() > 0)
-            throw _errors.front();
+        raise_errors();
     }
 
     void set_default_callbacks() {
         for (size_t handle = 0; handle < _requests.size(); handle++) {
             _requests[handle]._request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
-                // Add idle handle to queue
-                _idle_handles.push(handle);
-                // Notify locks in getIdleRequestId() or waitAll() functions
-                _cv.notify_one();
+                if (exception_ptr) {
+                    // there is no GIL here, the error is converted to the Python one by raise_errors()
+                    std::lock_guard<std::mutex> lock(_failures_mutex);
+                    _failures.push(exception_ptr);
+                }
+                set_idle(handle);
             });
         }
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        _callback = f_callback;
+        if (!_dispatcher.joinable()) {
+            _dispatcher = std::thread([this] {
+                dispatch_callbacks();
+            });
+        }
         for (size_t handle = 0; handle < _requests.size(); handle++) {
-            _requests[handle]._request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
+            _requests[handle]._request.set_callback([this, handle](std::exception_ptr exception_ptr) {
                 _requests[handle]._end_time = Time::now();
-                try {
-                    if (exception_ptr) {
-                        std::rethrow_exception(exception_ptr);
-                    }
-                } catch (const std::exception& e) {
-                    throw ov::Exception(e.what());
-                }
-                // Acquire GIL, execute Python function
-                py::gil_scoped_acquire acquire;
-                try {
-                    f_callback(_requests[handle], _user_ids[handle]);
-                } catch (py::error_already_set py_error) {
-                    assert(PyErr_Occurred());
-                    _errors.push(py_error);
-                }
-                // Add idle handle to queue
-                _idle_handles.push(handle);
-                // Notify locks in getIdleRequestId() or waitAll() functions
-                _cv.notify_one();
+                _exceptions[handle] = exception_ptr;
+                _completed_handles.push(handle);
+                // the mutex is needed to not miss the dispatcher which checked the queue but has not slept yet
+                { std::lock_guard<std::mutex> lock(_dispatch_mutex); }
+                _dispatch_cv.notify_one();
             });
         }
     }
 
     std::vector<InferRequestWrapper> _requests;
-    std::queue<size_t> _idle_handles;
     std::vector<py::object> _user_ids;  // user ID can be any Python object
+
+private:
+    // Body of the dispatcher thread, which runs the Python callbacks of the completed requests. The plugin threads
+    // only enqueue the handles, so they never wait for the GIL. The GIL is taken once for a batch of the completed
+    // requests, the batch is bounded by the number of requests to let the other Python threads run in between.
+    void dispatch_callbacks() {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_dispatch_mutex);
+                _dispatch_cv.wait(lock, [this] {
+                    return _stop_dispatching || !_completed_handles.empty();
+                });
+                if (_stop_dispatching && _completed_handles.empty())
+                    return;
+            }
+            // Acquire GIL, execute Python functions
+            py::gil_scoped_acquire acquire;
+            size_t handle = 0;
+            for (size_t i = 0; i < _requests.size() && _completed_handles.pop(handle); i++) {
+                run_callback(handle);
+                set_idle(handle);
+            }
+        }
+    }
+
+    void run_callback(size_t handle) {
+        try {
+            if (_exceptions[handle]) {
+                auto exception_ptr = _exceptions[handle];
+                _exceptions[handle] = nullptr;
+                std::rethrow_exception(exception_ptr);
+            }
+            _callback(_requests[handle], _user_ids[handle]);
+        } catch (...) {
+            push_error(std::current_exception());
+        }
+    }
+
+    // Must be called with the GIL held
+    void push_error(std::exception_ptr exception_ptr) {
+        try {
+            std::rethrow_exception(exception_ptr);
+        } catch (py::error_already_set& py_error) {
+            assert(PyErr_Occurred());
+            _errors.push(py_error);
+        } catch (const std::exception& e) {
+            PyErr_SetString(PyExc_RuntimeError, ("Caught exception: " + std::string(e.what())).c_str());
+            _errors.push(py::error_already_set());
+        } catch (...) {
+            PyErr_SetString(PyExc_RuntimeError, "Caught unknown exception");
+            _errors.push(py::error_already_set());
+        }
+    }
+
+    void set_idle(size_t handle) {
+        // Add idle handle to queue
+        _idle_handles.push(handle);
+        _idle_count.fetch_add(1);
+        // Notify locks in get_idle_request_id() or wait_all() functions. The mutex is taken only if somebody
+        // waits, it is needed to not miss the waiter which checked the condition but has not slept yet.
+        if (_waiters.load() != 0) {
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _cv.notify_all();
+        }
+    }
+
+    template <typename Condition>
+    void wait_until(Condition condition) {
+        if (condition())
+            return;
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(_mutex);
+        _waiters.fetch_add(1);
+        _cv.wait(lock, condition);
+        _waiters.fetch_sub(1);
+    }
+
+    void raise_errors() {
+        {
+            std::lock_guard<std::mutex> lock(_failures_mutex);
+            while (!_failures.empty()) {
+                push_error(_failures.front());
+                _failures.pop();
+            }
+        }
+        if (_errors.size() > 0)
+            throw _errors.front();
+    }
+
+    py::function _callback;
+    std::vector<std::exception_ptr> _exceptions;
+    HandlesQueue _idle_handles;
+    HandlesQueue _completed_handles;
+    std::atomic<size_t> _idle_count;
+    // handle returned by get_idle_request_id, accessed with the GIL held
+    size_t _reserved_handle = 0;
+    bool _has_reserved_handle = false;
+    std::atomic<size_t> _waiters{0};
     std::mutex _mutex;
     std::condition_variable _cv;
     std::queue<py::error_already_set> _errors;
+    // errors of the requests without the Python callback
+    std::mutex _failures_mutex;
+    std::queue<std::exception_ptr> _failures;
+    std::thread _dispatcher;
+    std::mutex _dispatch_mutex;
+    std::condition_variable _dispatch_cv;
+    bool _stop_dispatching = false;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -125,7 +341,6 @@ void regclass_AsyncInferQueue(py::module m) {
                 }
 
                 std::vector<InferRequestWrapper> requests;
-                std::queue<size_t> idle_handles;
                 std::vector<py::object> user_ids(jobs);
 
                 for (size_t handle = 0; handle < jobs; handle++) {
@@ -135,10 +350,9 @@ void regclass_AsyncInferQueue(py::module m) {
                     request._outputs = net.outputs();
 
                     requests.push_back(request);
-                    idle_handles.push(handle);
                 }
 
-                return new AsyncInferQueue(requests, idle_handles, user_ids);
+                return new AsyncInferQueue(requests, user_ids);
             }),
             py::arg("network"),
             py::arg("jobs") = 0);
@@ -146,21 +360,7 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.def(
         "start_async",
         [](AsyncInferQueue& self, const py::dict inputs, py::object userdata) {
-            // getIdleRequestId function has an intention to block InferQueue
-            // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            self._idle_handles.pop();
-            // Set new inputs label/id from user
-            self._user_ids[handle] = userdata;
-            // Update inputs if there are any
-            Common::set_request_tensors(self._requests[handle]._request, inputs);
-            // Now GIL can be released - we are NOT working with Python objects in this block
-            {
-                py::gil_scoped_release release;
-                self._requests[handle]._start_time = Time::now();
-                // Start InferRequest in asynchronus mode
-                self._requests[handle]._request.start_async();
-            }
+            self.start_async(inputs, userdata);
         },
         py::arg("inputs"),
         py::arg("userdata"));
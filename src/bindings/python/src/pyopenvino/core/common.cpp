@@ -315,11 +315,23 @@ uint32_t get_optimal_number_of_requests(const ov::runtime::ExecutableNetwork& ac
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::runtime::InferRequest& request) {
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::runtime::InferRequest& request,
+                         bool shared_memory) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::runtime::Tensor t{request.get_tensor(out)};
-        std::cout << t.get_element_type() << " !\n";
+        // numpy has no bfloat16 type, so such outputs are copied like in the default mode
+        if (shared_memory && t.get_element_type() != ov::element::bf16) {
+            // The array is a view of the output tensor. The tensor owns the memory of the request output,
+            // so the view stays valid after the request is destroyed, but the next inference overwrites it.
+            res[py::cast(out)] = py::array(ov_type_to_dtype().at(t.get_element_type()),
+                                           t.get_shape(),
+                                           t.get_strides(),
+                                           t.data(),
+                                           py::cast(t));
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             py::array arr(t.get_shape(), t.data<int8_t>());
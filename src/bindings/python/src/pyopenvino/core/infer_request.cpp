@@ -58,7 +58,7 @@ void regclass_InferRequest(py::module m) {
 
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool shared_memory) {
             // Update inputs if there are any
             Common::set_request_tensors(self._request, inputs);
             // Call Infer function
@@ -66,9 +66,10 @@ void regclass_InferRequest(py::module m) {
             self._request.infer();
             self._end_time = Time::now();
 
-            return Common::outputs_to_dict(self._outputs, self._request);
+            return Common::outputs_to_dict(self._outputs, self._request, shared_memory);
         },
-        py::arg("inputs"));
+        py::arg("inputs"),
+        py::arg("shared_memory") = false);
 
     cls.def(
         "start_async",
@@ -272,4 +273,11 @@ void regclass_InferRequest(py::module m) {
     cls.def_property_readonly("results", [](InferRequestWrapper& self) {
         return Common::outputs_to_dict(self._outputs, self._request);
     });
+
+    cls.def(
+        "get_results",
+        [](InferRequestWrapper& self, bool shared_memory) {
+            return Common::outputs_to_dict(self._outputs, self._request, shared_memory);
+        },
+        py::arg("shared_memory") = false);
 }
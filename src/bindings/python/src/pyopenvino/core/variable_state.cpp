@@ -15,6 +15,8 @@ void regclass_VariableState(py::module m) {
 
     variable_st.def("reset", &ov::runtime::VariableState::reset);
 
+    variable_st.def("trim", &ov::runtime::VariableState::trim, py::arg("length"));
+
     variable_st.def_property_readonly("name", &ov::runtime::VariableState::get_name);
 
     variable_st.def_property("state", &ov::runtime::VariableState::get_state, &ov::runtime::VariableState::set_state);
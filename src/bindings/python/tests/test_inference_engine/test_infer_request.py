@@ -315,6 +315,37 @@ def test_query_state_write_buffer(device, input_shape, data_type, mode):
             "Expected values: {} \n Actual values: {} \n".format(expected_res, res)
 
 
+@pytest.mark.skipif(os.environ.get("TEST_DEVICE", "CPU") != "CPU",
+                    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, "
+                           "Dynamic memory states are supported only on CPU")
+def test_query_state_trim(device):
+    core = Core()
+    hidden = 4
+    input_data = ops.parameter([1, -1, hidden], name="input_data", dtype=np.float32)
+    rv = ops.read_value(ops.multiply(input_data, np.float32(0)), "cache")
+    concat = ops.concat([rv, input_data], 1)
+    node = ops.assign(concat, "cache")
+    res = ops.result(concat, "res")
+    func = Model(results=[res], sinks=[node], parameters=[input_data], name="cache")
+    request = core.compile_model(func, device).create_infer_request()
+    mem_state = request.query_state()[0]
+
+    for i in range(1, 6):
+        request.infer({0: np.full([1, 1, hidden], i, dtype=np.float32)})
+    assert list(mem_state.state.shape) == [1, 5, hidden]
+
+    # restart from the first two tokens
+    mem_state.trim(2)
+    assert list(mem_state.state.shape) == [1, 2, hidden]
+    res = request.infer({0: np.full([1, 1, hidden], 7, dtype=np.float32)})
+    expected_res = np.array([1, 2, 7], dtype=np.float32).reshape([1, 3, 1]).repeat(hidden, axis=2)
+    assert np.array_equal(res[list(res)[0]], expected_res)
+
+    # the state can't be made longer
+    with pytest.raises(RuntimeError):
+        mem_state.trim(4)
+
+
 def test_get_results(device):
     core = Core()
     func = core.read_model(test_net_xml, test_net_bin)
@@ -326,6 +357,65 @@ def test_get_results(device):
     assert np.allclose(list(outputs.values()), list(request.results.values()))
 
 
+def test_get_results_shared_memory(device):
+    core = Core()
+    func = core.read_model(test_net_xml, test_net_bin)
+    exec_net = core.compile_model(func, device)
+    img = read_image()
+    request = exec_net.create_infer_request()
+    outputs = request.infer({0: img})
+    shared_outputs = request.infer({0: img}, shared_memory=True)
+    assert np.allclose(list(outputs.values()), list(shared_outputs.values()))
+    for shared_output, tensor in zip(shared_outputs.values(), request.output_tensors):
+        assert not shared_output.flags["OWNDATA"]
+        assert np.shares_memory(shared_output, tensor.data)
+    shared_results = request.get_results(shared_memory=True)
+    assert np.allclose(list(outputs.values()), list(shared_results.values()))
+    # the views keep the memory of the outputs alive
+    del request
+    assert np.allclose(list(outputs.values()), list(shared_outputs.values()))
+
+
+def test_get_results_shared_memory_bf16(device):
+    input_data = ops.parameter([2, 8], name="data", dtype=np.float32)
+    convert = ops.convert(input_data, "bf16")
+    func = Model([ops.result(convert, "res")], [input_data], "bf16_output")
+    core = Core()
+    exec_net = core.compile_model(func, device)
+    request = exec_net.create_infer_request()
+    data = np.arange(16, dtype=np.float32).reshape([2, 8])
+    outputs = request.infer({0: data})
+    # numpy has no bfloat16 type, so the shared memory mode copies the output too
+    shared_outputs = request.infer({0: data}, shared_memory=True)
+    for output, shared_output in zip(outputs.values(), shared_outputs.values()):
+        assert shared_output.dtype == output.dtype
+        assert np.array_equal(output, shared_output)
+
+
+def test_infer_queue_many_jobs(device):
+    jobs = 64
+    num_request = 4
+    core = Core()
+    func = core.read_model(test_net_xml, test_net_bin)
+    exec_net = core.compile_model(func, device)
+    infer_queue = AsyncInferQueue(exec_net, num_request)
+    jobs_done = [0] * jobs
+
+    def callback(request, job_id):
+        jobs_done[job_id] += 1
+
+    img = read_image()
+    infer_queue.set_callback(callback)
+    for i in range(jobs):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    assert all(done == 1 for done in jobs_done)
+    for i in range(jobs):
+        infer_queue.start_async({"data": img}, i)
+    infer_queue.wait_all()
+    assert all(done == 2 for done in jobs_done)
+
+
 def test_results_async_infer(device):
     jobs = 8
     num_request = 4
@@ -11,6 +11,7 @@
 #include <ie_input_info.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -68,7 +69,16 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
         _preproc.reset(new PreprocEngine);
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    if (PreprocEngine::isBatchOfImages(_userBlob)) {
+        auto images = as<CompoundBlob>(_userBlob);
+        std::vector<Blob::Ptr> blobs(images->size());
+        for (size_t i = 0; i < images->size(); ++i) {
+            blobs[i] = images->getBlob(i);
+        }
+        _preproc->preprocessBatchWithGAPI(blobs, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    } else {
+        _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    }
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
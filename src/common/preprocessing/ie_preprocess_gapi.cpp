@@ -10,6 +10,8 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <list>
+#include <memory>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -759,9 +761,39 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     return Update::NOTHING;
 }
 
+bool PreprocEngine::isBatchOfImages(const Blob::Ptr &blob) {
+    return blob->is<CompoundBlob>() && !blob->is<NV12Blob>() && !blob->is<I420Blob>();
+}
+
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
+    // every image of the batch is checked against a single batch item of the network's input
+    if (isBatchOfImages(src)) {
+        auto images = as<CompoundBlob>(src);
+        if (images->size() == 0) {
+            IE_THROW() << "Preprocessing is not applicable. The batch of images is empty.";
+        }
+        if (dst->is<MemoryBlob>() && dst->getTensorDesc().getDims().size() == 4 &&
+            images->size() > dst->getTensorDesc().getDims()[0]) {
+            IE_THROW() << "Preprocessing is not applicable. The number of images " << images->size()
+                       << " exceeds the network's batch size " << dst->getTensorDesc().getDims()[0];
+        }
+        for (size_t i = 0; i < images->size(); ++i) {
+            const auto image = images->getBlob(i);
+            if (!image->is<MemoryBlob>()) {
+                IE_THROW() << "Unsupported input blob type in the batch of images: expected MemoryBlob";
+            }
+            const auto &image_dims = image->getTensorDesc().getDims();
+            if (image_dims.size() == 4 && image_dims[0] != 1) {
+                IE_THROW() << "Preprocessing is not applicable. Each image in the batch must have batch size 1, got "
+                           << image_dims[0];
+            }
+            checkApplicabilityGAPI(image, dst);
+        }
+        return;
+    }
+
     // src is either a memory blob, an NV12, or an I420 blob
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
     if (!src->is<MemoryBlob>() && !yuv420_blob) {
@@ -800,7 +832,15 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         IE_THROW() << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (isBatchOfImages(blob)) {
+        const auto images = static_cast<int>(blob->size());
+        if (batch > images) {
+            IE_THROW() << "Provided batch size " << batch << " exceeds the number of images " << images;
+        }
+        if (batch < 0) {
+            batch = images;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             IE_THROW()  << "Provided input blob batch size " << batch
@@ -977,6 +1017,126 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         omp_serial, update);
 }
 
+std::shared_ptr<PreprocEngine::CompiledGraph> PreprocEngine::getCachedGraph(
+        const CallDesc &call, size_t slots, const std::function<cv::GComputation()> &build) {
+    auto it = std::find_if(_graphCache.begin(), _graphCache.end(), [&call](const GraphCache::value_type &entry) {
+        return entry.first == call;
+    });
+    if (it != _graphCache.end()) {
+        _graphCache.splice(_graphCache.begin(), _graphCache, it);
+    } else {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+        _graphCache.emplace_front(call, std::make_shared<CompiledGraph>(CompiledGraph{build(), {}}));
+        // the graphs still used by the current call are kept alive by the caller
+        if (_graphCache.size() > _graphCacheCapacity) {
+            _graphCache.pop_back();
+        }
+    }
+
+    auto graph = _graphCache.front().second;
+    if (graph->compiled.size() < slots) {
+        graph->compiled.resize(slots);
+    }
+    return graph;
+}
+
+void PreprocEngine::preprocessBatchWithGAPI(const std::vector<Blob::Ptr> &inBlobs, Blob::Ptr &outBlob,
+        const ResizeAlgorithm &algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+    if (in_fmt == ColorFormat::NV12 || in_fmt == ColorFormat::I420) {
+        IE_THROW() << "Batched pre-processing doesn't support input color format " << in_fmt;
+    }
+    const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
+
+    auto outMemoryBlob = as<MemoryBlob>(outBlob);
+    if (!outMemoryBlob) {
+        IE_THROW()  << "Unsupported network's input blob type: expected MemoryBlob";
+    }
+    const auto& out_desc_ie = outMemoryBlob->getTensorDesc();
+    validateTensorDesc(out_desc_ie);
+    const auto out_desc = G::decompose(out_desc_ie);
+    const auto out_layout = out_desc_ie.getLayout();
+
+    if (batch_size < 0) {
+        batch_size = static_cast<int>(inBlobs.size());
+    }
+    if (batch_size > static_cast<int>(inBlobs.size()) || batch_size > out_desc.d.N) {
+        IE_THROW()  << "Provided batch size is invalid: (provided)" << batch_size << " > " << inBlobs.size()
+                    << " (images) or " << out_desc.d.N << " (expected by network)";
+    }
+
+    // each image is written to a single batch item of the network's input
+    auto out_item_dims = out_desc_ie.getDims();
+    out_item_dims[0] = 1;
+
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        0;                  // use all available threads
+    (void)(omp_serial);
+    const size_t slots = thread_num == 0 ? static_cast<size_t>(parallel_get_max_threads()) : 1;
+
+    std::vector<std::shared_ptr<CompiledGraph>> graphs(batch_size);
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        auto inMemoryBlob = as<MemoryBlob>(inBlobs[i]);
+        if (!inMemoryBlob) {
+            IE_THROW()  << "Unsupported input blob in the batch of images: expected MemoryBlob";
+        }
+        const auto& in_desc_ie = inMemoryBlob->getTensorDesc();
+        validateTensorDesc(in_desc_ie);
+        const auto in_layout = in_desc_ie.getLayout();
+        const auto in_desc = G::decompose(in_desc_ie);
+        if (in_desc.d.N != 1) {
+            IE_THROW()  << "Input blob batch size is invalid: (image " << i << ") " << in_desc.d.N << " != 1";
+        }
+
+        CallDesc call = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
+                                            in_layout,
+                                            in_desc_ie.getDims(),
+                                            in_fmt },
+                                  BlobDesc{ out_desc_ie.getPrecision(),
+                                            out_layout,
+                                            out_item_dims,
+                                            out_fmt },
+                                  algorithm };
+        if (algorithm == NO_RESIZE && std::get<0>(call) == std::get<1>(call)) {
+            IE_THROW()  << "No job to do in the PreProcessing ?";
+        }
+
+        graphs[i] = getCachedGraph(call, slots, [&]() {
+            return buildGraph(in_desc, out_desc, in_layout, out_layout, algorithm, in_fmt, out_fmt);
+        });
+        batched_input_plane_mats[i] = bind_to_blob(inBlobs[i], 1)[0];
+    }
+    auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+
+    // Unlike the single blob case, the images are not split into slices: every image is processed whole by
+    // one thread, the images are distributed among the threads of the current arena
+    parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
+        for (int i = slice_n; i < batch_size; i += total_slices) {
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
+            const auto& input_plane_mats = batched_input_plane_mats[i];
+            auto& output_plane_mats = batched_output_plane_mats[i];
+
+            auto& compiled = graphs[i]->compiled[slice_n];
+            if (!compiled) {
+                OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
+                compiled = graphs[i]->computation.compile(descrs_of(input_plane_mats),
+                                                          cv::compile_args(gapi::preprocKernels()));
+            }
+
+            cv::GRunArgs call_ins;
+            cv::GRunArgsP call_outs;
+            for (const auto & m : input_plane_mats) { call_ins.emplace_back(m);}
+            for (auto & m : output_plane_mats) { call_outs.emplace_back(&m);}
+
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_graph);
+            compiled(std::move(call_ins), std::move(call_outs));
+        }
+    });
+}
+
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
         const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
@@ -8,7 +8,11 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <functional>
+#include <list>
+#include <memory>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
@@ -33,6 +37,19 @@ class PreprocEngine {
     openvino::itt::handle_t _perf_exec_graph = openvino::itt::handle("Preproc Exec Graph");
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
+    // Graphs compiled for the whole image, used by the batched pre-processing. Each parallel slot has its own
+    // compiled object as the compiled graph keeps the intermediate buffers and can't be run concurrently.
+    struct CompiledGraph {
+        cv::GComputation computation;
+        std::vector<cv::GCompiled> compiled;
+    };
+    using GraphCache = std::list<std::pair<CallDesc, std::shared_ptr<CompiledGraph>>>;
+    static constexpr size_t _graphCacheCapacity = 64;
+    GraphCache _graphCache;  // most recently used first
+
+    std::shared_ptr<CompiledGraph> getCachedGraph(const CallDesc &call, size_t slots,
+                                                  const std::function<cv::GComputation()> &build);
+
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
 
@@ -54,6 +71,19 @@ public:
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
         ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+
+    /**
+     * @brief Returns true if the blob is a set of per-batch images (BatchedBlob or CompoundBlob of ROIs which may have
+     * different sizes), rather than a multi-plane (NV12, I420) image
+     */
+    static bool isBatchOfImages(const Blob::Ptr &blob);
+
+    /**
+     * @brief Pre-processes the images into the corresponding batch items of the output blob in a single parallel pass.
+     * The images may have different sizes, the graphs compiled for each input/output descriptor are cached.
+     */
+    void preprocessBatchWithGAPI(const std::vector<Blob::Ptr> &inBlobs, Blob::Ptr &outBlob,
+        const ResizeAlgorithm &algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
 };
 
 }  // namespace InferenceEngine
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory mapped files
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only view of a file mapped into the process address space
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+    /**
+     * @brief Returns a pointer to the beginning of the mapped file, nullptr for an empty file
+     */
+    virtual const char* data() const noexcept = 0;
+    /**
+     * @brief Returns the size of the mapped file in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into memory in read-only mode.
+ * @param path Path to the file
+ * @return Reference to the mapped memory, the file is unmapped when the last reference is released
+ * @throws std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/**
+ * @brief Maps the whole file with the wide char name specified into memory in read-only mode.
+ * @param path Path to the file
+ * @return Reference to the mapped memory, the file is unmapped when the last reference is released
+ * @throws std::runtime_error if the file cannot be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+namespace util {
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    void set(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw_error("Cannot open", path);
+        }
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1) {
+            close(fd);
+            throw_error("Cannot get size of", path);
+        }
+        m_size = static_cast<size_t>(sb.st_size);
+        if (m_size > 0) {
+            void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                throw_error("Cannot map", path);
+            }
+            m_data = static_cast<char*>(data);
+        }
+        // the mapping stays valid after the descriptor is closed
+        close(fd);
+    }
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            munmap(m_data, m_size);
+        }
+    }
+
+    const char* data() const noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    static void throw_error(const char* action, const std::string& path) {
+        std::stringstream ss;
+        ss << action << " file '" << path << "': " << std::strerror(errno);
+        throw std::runtime_error(ss.str());
+    }
+
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    return load_mmap_object(ov::util::wstring_to_string(path));
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <stdexcept>
+
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+
+#include <windows.h>
+
+namespace ov {
+namespace util {
+
+class HandleHolder {
+public:
+    explicit HandleHolder(HANDLE handle = INVALID_HANDLE_VALUE) : m_handle(handle) {}
+    HandleHolder(const HandleHolder&) = delete;
+    HandleHolder& operator=(const HandleHolder&) = delete;
+    ~HandleHolder() {
+        reset(INVALID_HANDLE_VALUE);
+    }
+    void reset(HANDLE handle) {
+        if (m_handle != INVALID_HANDLE_VALUE && m_handle != nullptr) {
+            ::CloseHandle(m_handle);
+        }
+        m_handle = handle;
+    }
+    HANDLE get() const noexcept {
+        return m_handle;
+    }
+
+private:
+    HANDLE m_handle;
+};
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    void set(const std::string& path) {
+        m_handle.reset(::CreateFileA(path.c_str(),
+                                     GENERIC_READ,
+                                     FILE_SHARE_READ,
+                                     nullptr,
+                                     OPEN_EXISTING,
+                                     FILE_ATTRIBUTE_NORMAL,
+                                     nullptr));
+        map(path);
+    }
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+    void set(const std::wstring& path) {
+        m_handle.reset(::CreateFileW(path.c_str(),
+                                     GENERIC_READ,
+                                     FILE_SHARE_READ,
+                                     nullptr,
+                                     OPEN_EXISTING,
+                                     FILE_ATTRIBUTE_NORMAL,
+                                     nullptr));
+        map(ov::util::wstring_to_string(path));
+    }
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+    ~MapHolder() override {
+        if (m_data != nullptr) {
+            ::UnmapViewOfFile(m_data);
+        }
+    }
+
+    const char* data() const noexcept override {
+        return m_data;
+    }
+
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    void map(const std::string& path) {
+        if (m_handle.get() == INVALID_HANDLE_VALUE) {
+            throw_error("Cannot open", path);
+        }
+        LARGE_INTEGER file_size = {};
+        if (!::GetFileSizeEx(m_handle.get(), &file_size)) {
+            throw_error("Cannot get size of", path);
+        }
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        if (m_size > 0) {
+            m_mapping.reset(::CreateFileMapping(m_handle.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+            if (m_mapping.get() == nullptr) {
+                throw_error("Cannot create mapping of", path);
+            }
+            m_data = static_cast<char*>(::MapViewOfFile(m_mapping.get(), FILE_MAP_READ, 0, 0, 0));
+            if (m_data == nullptr) {
+                throw_error("Cannot map", path);
+            }
+        }
+    }
+
+    static void throw_error(const char* action, const std::string& path) {
+        std::stringstream ss;
+        ss << action << " file '" << path << "': " << ::GetLastError();
+        throw std::runtime_error(ss.str());
+    }
+
+    char* m_data = nullptr;
+    size_t m_size = 0;
+    HandleHolder m_handle;
+    HandleHolder m_mapping;
+};
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path);
+    return holder;
+}
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,75 @@
+#
+# weights file layouts paddle model generator
+#
+import numpy as np
+import os
+import struct
+from save_model import saveModel
+import sys
+
+# version (u32), LoD level (u64), tensor version (u32), size of TensorDesc (u32)
+header_size = 20
+
+
+# returns the offsets of the tensor data in the weights file, the tensors are stored in the order of their names
+def data_offsets(path, params):
+    offsets = []
+    with open(path, "rb") as f:
+        content = f.read()
+    offset = 0
+    for name in sorted(params):
+        desc_size = struct.unpack_from("<I", content, offset + header_size - 4)[0]
+        offset += header_size + desc_size
+        offsets.append(offset)
+        offset += params[name].nbytes
+    assert offset == len(content), "unexpected size of {}".format(path)
+    return offsets
+
+
+def pdpd_conv2d(name, x):
+    import paddle as pdpd
+
+    pdpd.enable_static()
+    with pdpd.static.program_guard(pdpd.static.Program(), pdpd.static.Program()):
+        node_x = pdpd.static.data(name='x', shape=x.shape, dtype=x.dtype)
+        # the names define the order of the tensors in the combined weights file
+        conv = pdpd.static.nn.conv2d(input=node_x, num_filters=4, filter_size=(1, 1),
+                                     param_attr=pdpd.ParamAttr(name="b_filter"),
+                                     bias_attr=pdpd.ParamAttr(name="a_bias"))
+
+        cpu = pdpd.static.cpu_places(1)
+        exe = pdpd.static.Executor(cpu[0])
+        # startup program will call initializer to initialize the parameters.
+        exe.run(pdpd.static.default_startup_program())
+        params = {param: np.array(pdpd.static.global_scope().find_var(param).get_tensor())
+                  for param in ["a_bias", "b_filter"]}
+
+        outs = exe.run(
+            feed={'x': x},
+            fetch_list=[conv])
+        saveModel(name, exe, feedkeys=['x'], fetchlist=[conv], inputs=[x], outputs=[outs[0]], target_dir=sys.argv[1])
+
+    return params
+
+
+if __name__ == "__main__":
+    data = np.random.randn(1, 3, 4, 4).astype(np.float32)
+    model_dir = os.path.join(sys.argv[1], "weights")
+
+    # the data of the bias is aligned in the weights files and is shared with the constant,
+    # the data of the 4D filter follows the longer TensorDesc, it is misaligned and copied
+    params = pdpd_conv2d("weights", data)
+    for path in [os.path.join(model_dir, "weights.pdiparams"), os.path.join(model_dir, "b_filter")]:
+        misaligned = [offset % 4 != 0 for offset in data_offsets(path, params if path.endswith(".pdiparams")
+                                                                 else {"b_filter": params["b_filter"]})]
+        assert any(misaligned), "no misaligned tensors in {}".format(path)
+    assert all(offset % 4 == 0 for offset in data_offsets(os.path.join(model_dir, "a_bias"),
+                                                          {"a_bias": params["a_bias"]}))
+
+    # the combined weights file ends in the middle of the last tensor data,
+    # the file of the filter in the middle of the tensor header
+    pdpd_conv2d("weights_truncated", data)
+    truncated_dir = os.path.join(sys.argv[1], "weights_truncated")
+    combined = os.path.join(truncated_dir, "weights_truncated.pdiparams")
+    os.truncate(combined, os.path.getsize(combined) - 4)
+    os.truncate(os.path.join(truncated_dir, "b_filter"), 10)
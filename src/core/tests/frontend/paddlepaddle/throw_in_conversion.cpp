@@ -37,3 +37,29 @@ TEST(FrontEndConvertModelTest, unsupported_version) {
 
     ASSERT_THROW(inputModel = frontEnd->load(model_filename), GeneralFailure);
 }
+
+TEST(FrontEndConvertModelTest, truncated_weights_file) {
+    FrontEndManager fem;
+    FrontEnd::Ptr frontEnd;
+    InputModel::Ptr inputModel;
+    ASSERT_NO_THROW(frontEnd = fem.load_by_framework(PADDLE_FE));
+    ASSERT_NE(frontEnd, nullptr);
+    auto model_filename = FrontEndTestUtils::make_model_path(
+        std::string(TEST_PADDLE_MODELS_DIRNAME) + std::string("weights_truncated/weights_truncated.pdmodel"));
+
+    // the combined weights file ends in the middle of the last tensor data
+    ASSERT_THROW(inputModel = frontEnd->load(model_filename), GeneralFailure);
+}
+
+TEST(FrontEndConvertModelTest, truncated_weights_folder) {
+    FrontEndManager fem;
+    FrontEnd::Ptr frontEnd;
+    InputModel::Ptr inputModel;
+    ASSERT_NO_THROW(frontEnd = fem.load_by_framework(PADDLE_FE));
+    ASSERT_NE(frontEnd, nullptr);
+    auto model_path =
+        FrontEndTestUtils::make_model_path(std::string(TEST_PADDLE_MODELS_DIRNAME) + std::string("weights_truncated"));
+
+    // the file of one tensor ends in the middle of its header
+    ASSERT_THROW(inputModel = frontEnd->load(model_path), GeneralFailure);
+}
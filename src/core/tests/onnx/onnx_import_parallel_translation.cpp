@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/file_util.hpp"
+#include "onnx_import/onnx.hpp"
+#include "util/graph_comparator.hpp"
+#include "util/test_control.hpp"
+
+NGRAPH_SUPPRESS_DEPRECATED_START
+
+using namespace ngraph;
+
+static std::string s_manifest = "${MANIFEST}";
+
+namespace {
+std::shared_ptr<Function> import_model(const std::string& model_path, bool parallel_translation) {
+    set_environment("OV_ONNX_PARALLEL_TRANSLATION", parallel_translation ? "1" : "0", 1);
+    const auto function = onnx_import::import_onnx_model(model_path);
+    unset_environment("OV_ONNX_PARALLEL_TRANSLATION");
+    return function;
+}
+}  // namespace
+
+// The model and its Loop body have levels of 16 independent nodes, the Reshapes read a shape computed by the model,
+// so their output shapes are known only after the placeholders of their inputs are replaced
+NGRAPH_TEST(onnx_import_parallel_translation, result_matches_sequential) {
+    const auto model_path = file_util::path_join(SERIALIZED_ZOO, "onnx/parallel_translation.onnx");
+    const auto sequential = import_model(model_path, false);
+    const auto parallel = import_model(model_path, true);
+
+    EXPECT_EQ(parallel->get_output_partial_shape(0), sequential->get_output_partial_shape(0));
+    EXPECT_EQ(parallel->get_output_partial_shape(0), (PartialShape{Dimension::dynamic(), 3}));
+
+    const auto comparator = FunctionsComparator::with_default()
+                                .enable(FunctionsComparator::CONST_VALUES)
+                                .enable(FunctionsComparator::NAMES)
+                                .enable(FunctionsComparator::ATTRIBUTES);
+    const auto res = comparator.compare(parallel, sequential);
+    EXPECT_TRUE(res.valid) << res.message;
+}
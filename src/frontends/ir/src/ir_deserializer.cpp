@@ -7,6 +7,7 @@
 #include <pugixml.hpp>
 
 #include "ie_ngraph_utils.hpp"
+#include "ie_parallel.hpp"
 #include "ir_frontend/model.hpp"
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
@@ -17,6 +18,26 @@
 
 using namespace ov;
 
+namespace {
+/// \brief Runs func(i) for i in [0, count) on the IE threading runtime and rethrows the first
+/// exception raised by any of the iterations in the calling thread
+template <typename F>
+void run_parallel(size_t count, const F& func) {
+    std::vector<std::exception_ptr> errors(count);
+    InferenceEngine::parallel_for(count, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node, const pugi::xml_node& body_node) {
     if (body_node.empty()) {
         IE_THROW() << "Missing body part.";
@@ -422,28 +443,46 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t /*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
 
-    // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+    // Parse all layers in parallel: the DOM is only read here, so every layer can be handled independently
+    std::vector<pugi::xml_node> xml_layers;
+    FOREACH_CHILD (node, root.child("layers"), "layer") { xml_layers.emplace_back(node); }
+
+    std::vector<GenericLayerParams> layer_params(xml_layers.size());
+    run_parallel(xml_layers.size(), [&](size_t i) {
+        layer_params[i] = parseGenericParams(xml_layers[i]);
+    });
+
+    // Store layer parameters in params map keeping the document order for name checks
+    for (size_t i = 0; i < xml_layers.size(); ++i) {
+        auto& node_param = layer_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        const auto layer_id = node_param.layerId;
+        params[layer_id] = {xml_layers[i], std::move(node_param)};
     }
 
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
     std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
 
-    // Read all edges and store them for further usage
-    FOREACH_CHILD (_ec, root.child("edges"), "edge") {
+    // Read all edges in parallel and store them for further usage
+    std::vector<pugi::xml_node> xml_edges;
+    FOREACH_CHILD (_ec, root.child("edges"), "edge") { xml_edges.emplace_back(_ec); }
+
+    std::vector<std::pair<size_t /*to-layer-id*/, edge>> parsed_edges(xml_edges.size());
+    run_parallel(xml_edges.size(), [&](size_t i) {
+        const auto& _ec = xml_edges[i];
         size_t fromLayer = XMLParseUtils::GetUIntAttr(_ec, "from-layer");
         size_t fromPort = XMLParseUtils::GetUIntAttr(_ec, "from-port");
         size_t toLayer = XMLParseUtils::GetUIntAttr(_ec, "to-layer");
         size_t toPort = XMLParseUtils::GetUIntAttr(_ec, "to-port");
-        edges[toLayer].push_back({fromLayer, fromPort, toPort});
+        parsed_edges[i] = {toLayer, {fromLayer, fromPort, toPort}};
+    });
+    for (const auto& e : parsed_edges) {
+        edges[e.first].push_back(e.second);
     }
 
     // Run DFS starting from outputs to get nodes topological order
@@ -466,6 +505,24 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
 
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    // Source layers (constants and parameters) have no inputs and do not touch shared deserializer state,
+    // so they are created from multiple threads and connected to their consumers in the loop below.
+    // Constants keep sharing the weights buffer, their data is not touched until the first access.
+    std::vector<size_t> source_layers;
+    for (const auto& layer_id : order) {
+        const auto& type = params[layer_id].params.type;
+        if (edges[layer_id].empty() && (type == "Const" || type == "Parameter"))
+            source_layers.push_back(layer_id);
+    }
+    std::vector<std::shared_ptr<ngraph::Node>> source_nodes(source_layers.size());
+    run_parallel(source_layers.size(), [&](size_t i) {
+        const auto& p = params.at(source_layers[i]);
+        source_nodes[i] = createNode({}, p.xml, weights, p.params);
+    });
+    for (size_t i = 0; i < source_layers.size(); ++i) {
+        id_to_node[source_layers[i]] = source_nodes[i];
+    }
+
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
@@ -486,8 +543,9 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
+        auto& node = id_to_node[layer_id];
+        if (!node)
+            node = createNode(inputs, p.xml, weights, p.params);
 
         // Check that output shape after nGraph node validation the same as in IR
         // because IR always right!
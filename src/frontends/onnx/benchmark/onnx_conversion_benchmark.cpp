@@ -0,0 +1,199 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Measures the time of the ONNX model conversion for large synthetic graphs.
+//
+// The model is built from `layers` levels, each level has `branches` independent Add + Relu chains reading
+// the output of the previous level and a Sum merging them:
+//
+//     X -> [Add(B_0_0) -> Relu, ..., Add(B_0_n) -> Relu] -> Sum -> [...] -> ... -> Sum -> Y
+//
+// Every Add has its own [width] initializer, so the model has layers * (2 * branches + 1) nodes and
+// layers * branches initializers.
+//
+// The Adds and the Relus of a level are independent, with -p they are translated in parallel
+// (OV_ONNX_PARALLEL_TRANSLATION=1), the levels narrower than 16 nodes are translated serially anyway.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "onnx_import/onnx.hpp"
+
+namespace {
+struct Options {
+    size_t layers = 1000;
+    size_t branches = 32;
+    size_t width = 64;
+    size_t iterations = 5;
+    bool parallel_translation = false;
+};
+
+// Minimal protobuf wire format encoder, the benchmark doesn't depend on the ONNX protobuf library
+class Message {
+public:
+    Message& varint(uint32_t field, uint64_t value) {
+        key(field, 0);
+        write_varint(value);
+        return *this;
+    }
+
+    Message& bytes(uint32_t field, const std::string& value) {
+        key(field, 2);
+        write_varint(value.size());
+        m_buffer += value;
+        return *this;
+    }
+
+    Message& message(uint32_t field, const Message& value) {
+        return bytes(field, value.m_buffer);
+    }
+
+    const std::string& str() const {
+        return m_buffer;
+    }
+
+private:
+    void key(uint32_t field, uint32_t wire_type) {
+        write_varint((static_cast<uint64_t>(field) << 3) | wire_type);
+    }
+
+    void write_varint(uint64_t value) {
+        while (value >= 0x80) {
+            m_buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        m_buffer.push_back(static_cast<char>(value));
+    }
+
+    std::string m_buffer;
+};
+
+// field numbers and constants of onnx.proto
+constexpr uint32_t FLOAT_TYPE = 1;
+
+Message node(const std::string& op_type, const std::vector<std::string>& inputs, const std::string& output) {
+    Message node;
+    for (const auto& input : inputs) {
+        node.bytes(1, input);
+    }
+    node.bytes(2, output).bytes(3, output).bytes(4, op_type);
+    return node;
+}
+
+Message initializer(const std::string& name, size_t width, float value) {
+    const std::vector<float> data(width, value);
+    return Message()
+        .varint(1, width)
+        .varint(2, FLOAT_TYPE)
+        .bytes(8, name)
+        .bytes(9, std::string(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float)));
+}
+
+Message value_info(const std::string& name, size_t width) {
+    const auto shape = Message().message(1, Message().varint(1, 1)).message(1, Message().varint(1, width));
+    const auto tensor_type = Message().varint(1, FLOAT_TYPE).message(2, shape);
+    return Message().bytes(1, name).message(2, Message().message(1, tensor_type));
+}
+
+std::string make_model(const Options& options) {
+    Message graph;
+    std::string previous = "X";
+    for (size_t layer = 0; layer < options.layers; ++layer) {
+        std::vector<std::string> branch_outputs;
+        for (size_t branch = 0; branch < options.branches; ++branch) {
+            const auto suffix = "_" + std::to_string(layer) + "_" + std::to_string(branch);
+            graph.message(5, initializer("B" + suffix, options.width, 1.f / (branch + 1)));
+            graph.message(1, node("Add", {previous, "B" + suffix}, "Add" + suffix));
+            graph.message(1, node("Relu", {"Add" + suffix}, "Relu" + suffix));
+            branch_outputs.push_back("Relu" + suffix);
+        }
+        previous = "Sum_" + std::to_string(layer);
+        graph.message(1, node("Sum", branch_outputs, previous));
+    }
+    graph.message(1, node("Identity", {previous}, "Y"));
+    graph.bytes(2, "synthetic_graph");
+    graph.message(11, value_info("X", options.width));
+    graph.message(12, value_info("Y", options.width));
+
+    const auto opset = Message().bytes(1, "").varint(2, 13);
+    return Message().varint(1, 7).message(7, graph).message(8, opset).str();
+}
+
+void print_usage(const char* name) {
+    std::cout << "Usage: " << name << " [-l layers] [-b branches] [-w width] [-n iterations] [-p]" << std::endl;
+}
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-p") {
+            options.parallel_translation = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            return false;
+        }
+        const auto value = static_cast<size_t>(std::strtoull(argv[++i], nullptr, 10));
+        if (arg == "-l") {
+            options.layers = value;
+        } else if (arg == "-b") {
+            options.branches = value;
+        } else if (arg == "-w") {
+            options.width = value;
+        } else if (arg == "-n") {
+            options.iterations = value;
+        } else {
+            return false;
+        }
+    }
+    return options.layers > 0 && options.branches > 0 && options.width > 0 && options.iterations > 0;
+}
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (options.parallel_translation) {
+#ifdef _WIN32
+        _putenv_s("OV_ONNX_PARALLEL_TRANSLATION", "1");
+#else
+        setenv("OV_ONNX_PARALLEL_TRANSLATION", "1", 1);
+#endif
+    }
+
+    const auto model = make_model(options);
+    std::cout << "Nodes: " << options.layers * (2 * options.branches + 1) + 1
+              << ", initializers: " << options.layers * options.branches << ", model size: " << model.size()
+              << " bytes, parallel translation: " << (options.parallel_translation ? "on" : "off") << std::endl;
+
+    try {
+        std::vector<double> times;
+        for (size_t i = 0; i < options.iterations; ++i) {
+            std::istringstream stream(model);
+            const auto start = std::chrono::steady_clock::now();
+            const auto function = ngraph::onnx_import::import_onnx_model(stream);
+            const auto end = std::chrono::steady_clock::now();
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+            std::cout << "Iteration " << i << ": " << times.back() << " ms, " << function->get_ops().size()
+                      << " operations" << std::endl;
+        }
+        std::sort(times.begin(), times.end());
+        std::cout << "Conversion time: min " << times.front() << " ms, median " << times[times.size() / 2]
+                  << " ms, max " << times.back() << " ms" << std::endl;
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -4,10 +4,11 @@
 
 #include "core/graph.hpp"
 
-#include <exception>
+#include <algorithm>
 #include <functional>
 #include <numeric>
 #include <sstream>
+#include <unordered_set>
 
 #include "core/value_info.hpp"
 #include "default_opset.hpp"
@@ -17,6 +18,7 @@
 #include "onnx_framework_node.hpp"
 #include "onnx_import/core/node.hpp"
 #include "onnx_import/core/null_node.hpp"
+#include "openvino/util/env_util.hpp"
 #include "utils/common.hpp"
 
 namespace ngraph {
@@ -55,43 +57,148 @@ bool common_node_for_all_outputs(const OutputVector& outputs) {
                            });
     return ret;
 };
+
+const std::unordered_map<std::string, Output<ngraph::Node>>*& isolated_inputs() {
+    static thread_local const std::unordered_map<std::string, Output<ngraph::Node>>* inputs = nullptr;
+    return inputs;
+}
+
+static bool has_subgraphs(const ONNX_NAMESPACE::NodeProto& node_proto) {
+    const auto& attributes = node_proto.attribute();
+    return std::any_of(std::begin(attributes),
+                       std::end(attributes),
+                       [](const ONNX_NAMESPACE::AttributeProto& attribute) {
+                           return attribute.type() == ONNX_NAMESPACE::AttributeProto_AttributeType_GRAPH ||
+                                  attribute.type() == ONNX_NAMESPACE::AttributeProto_AttributeType_GRAPHS;
+                       });
+}
+
+/// \brief      Creates the input a node translated in isolation reads instead of a graph output.
+///
+/// \note       The constants are copied without their data, so the translators still see the values of the
+///             initializers. The other inputs are replaced by parameters of the same type and shape.
+static Output<ngraph::Node> make_placeholder(const Output<ngraph::Node>& graph_output) {
+    if (ngraph::op::is_null(graph_output)) {
+        return std::make_shared<NullNode>()->output(0);
+    }
+    if (const auto constant = ov::as_type_ptr<default_opset::Constant>(graph_output.get_node_shared_ptr())) {
+        return std::make_shared<default_opset::Constant>(*constant)->output(0);
+    }
+    return std::make_shared<default_opset::Parameter>(graph_output.get_element_type(),
+                                                      graph_output.get_partial_shape())
+        ->output(0);
+}
+
+/// \brief      The result of the translation of a node in isolation.
+struct IsolatedNode {
+    std::unique_ptr<Node> onnx_node;
+    std::unordered_map<std::string, Output<ngraph::Node>> inputs;
+    // the graph outputs the placeholders stand for
+    std::unordered_map<ngraph::Node*, Output<ngraph::Node>> placeholders;
+    OutputVector outputs;
+    // the new nodes in topological order
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    bool failed = false;
+};
+
+static std::vector<std::shared_ptr<ngraph::Node>> collect_new_nodes(const IsolatedNode& isolated) {
+    std::vector<std::shared_ptr<ngraph::Node>> nodes;
+    std::unordered_set<const ngraph::Node*> visited;
+    std::vector<std::pair<std::shared_ptr<ngraph::Node>, bool>> stack;
+    for (const auto& output : isolated.outputs) {
+        stack.emplace_back(output.get_node_shared_ptr(), false);
+    }
+    while (!stack.empty()) {
+        auto node = stack.back().first;
+        const auto inputs_visited = stack.back().second;
+        stack.pop_back();
+        if (inputs_visited) {
+            nodes.push_back(std::move(node));
+            continue;
+        }
+        if (isolated.placeholders.count(node.get()) || !visited.insert(node.get()).second) {
+            continue;
+        }
+        stack.emplace_back(node, true);
+        for (const auto& input : node->input_values()) {
+            stack.emplace_back(input.get_node_shared_ptr(), false);
+        }
+    }
+    return nodes;
+}
+
 }  // namespace detail
 
 Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
              const std::shared_ptr<ov::frontend::TelemetryExtension>& telemetry)
-    : Graph(model_proto, common::make_unique<GraphCache>(), telemetry) {}
+    : Graph(model_proto, common::make_unique<GraphCache>(), telemetry, std::make_shared<WorkerPool>()) {}
 
 Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
              std::unique_ptr<GraphCache>&& cache,
-             const std::shared_ptr<ov::frontend::TelemetryExtension>& telemetry)
+             const std::shared_ptr<ov::frontend::TelemetryExtension>& telemetry,
+             const std::shared_ptr<WorkerPool>& workers)
     : m_model{common::make_unique<Model>(model_proto)},
       m_cache{std::move(cache)},
+      m_workers{workers},
       m_telemetry(telemetry) {
-    std::map<std::string, Tensor> initializers;
-    // Process all initializers in the graph
-    for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
+    const auto& graph_proto = m_model->get_graph();
+    // Every initializer, input and node output is stored in the cache, so it never rehashes
+    std::size_t cache_size = graph_proto.initializer_size() + graph_proto.input_size();
+    for (const auto& node_proto : graph_proto.node()) {
+        cache_size += node_proto.output_size();
+    }
+    m_cache->reserve(cache_size);
+
+    std::vector<const ONNX_NAMESPACE::TensorProto*> initializer_tensors;
+    for (const auto& initializer_tensor : graph_proto.initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
-            try {
-                ng_constant = tensor.get_ng_constant();
-            } catch (const error::invalid_external_data&) {
-                // invalid external data makes initializers creation impossible
-                throw;
-            } catch (const ngraph::ngraph_error& exc) {
-                NGRAPH_WARN << "\nCould not create an nGraph Constant for initializer '" << initializer_tensor.name()
-                            << "'. Constant with a 0 value was created, make sure connected input is optional.\n"
-                            << "Otherwise verify if the initializer contains a correct number of "
-                               "elements matching the initializer's shape. \nDetailed error:\n"
-                            << exc.what();
-                ng_constant = default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
-            }
+            initializer_tensors.push_back(&initializer_tensor);
+        }
+    }
+
+    // The external data files are mapped once and shared by all the initializers stored in them
+    const auto mmap_cache = std::make_shared<detail::MappedMemoryCache>();
+    // For each initializer create a Constant node, the initializers are independent so they are converted
+    // concurrently. The conversion errors are logged afterwards from the calling thread.
+    std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(initializer_tensors.size());
+    std::vector<std::string> conversion_errors(initializer_tensors.size());
+    const auto convert_initializer = [&](std::size_t i) {
+        const auto& initializer_tensor = *initializer_tensors[i];
+        const Tensor tensor{initializer_tensor, mmap_cache};
+        std::shared_ptr<default_opset::Constant> ng_constant;
+        try {
+            ng_constant = tensor.get_ng_constant();
+        } catch (const error::invalid_external_data&) {
+            // invalid external data makes initializers creation impossible
+            throw;
+        } catch (const ngraph::ngraph_error& exc) {
+            conversion_errors[i] = exc.what();
+            ng_constant = default_opset::Constant::create(tensor.get_ng_type(), Shape{}, {0});
+        }
+        ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
+        ng_constants[i] = std::move(ng_constant);
+    };
+    if (m_workers) {
+        m_workers->parallel_for(initializer_tensors.size(), convert_initializer);
+    } else {
+        for (std::size_t i = 0; i < initializer_tensors.size(); ++i) {
+            convert_initializer(i);
+        }
+    }
 
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
+    // Store the initializers in the cache in the order of the model
+    std::map<std::string, Tensor> initializers;
+    for (std::size_t i = 0; i < initializer_tensors.size(); ++i) {
+        const auto& initializer_tensor = *initializer_tensors[i];
+        if (!conversion_errors[i].empty()) {
+            NGRAPH_WARN << "\nCould not create an nGraph Constant for initializer '" << initializer_tensor.name()
+                        << "'. Constant with a 0 value was created, make sure connected input is optional.\n"
+                        << "Otherwise verify if the initializer contains a correct number of "
+                           "elements matching the initializer's shape. \nDetailed error:\n"
+                        << conversion_errors[i];
         }
+        initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor, mmap_cache});
+        m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constants[i]));
     }
 
     // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
@@ -143,17 +250,134 @@ Graph::Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto,
 }
 
 void Graph::convert_to_ngraph_nodes() {
+    if (m_workers && ov::util::getenv_bool("OV_ONNX_PARALLEL_TRANSLATION")) {
+        convert_to_ngraph_nodes_in_parallel();
+        return;
+    }
     // Process ONNX graph nodes, convert to nGraph nodes
     for (const auto& node_proto : m_model->get_graph().node()) {
-        const Node node{node_proto, *this};
-        if (node.has_subgraphs()) {
-            const auto& subgraphs = node.get_subgraphs();
-            for (auto& kv : subgraphs) {
-                auto& subgraph = kv.second;
-                subgraph->convert();
+        convert_node(Node{node_proto, *this});
+    }
+}
+
+void Graph::convert_node(const Node& node) {
+    if (node.has_subgraphs()) {
+        const auto& subgraphs = node.get_subgraphs();
+        for (auto& kv : subgraphs) {
+            auto& subgraph = kv.second;
+            subgraph->convert();
+        }
+    }
+    OutputVector ng_nodes{make_ng_nodes(node)};
+}
+
+void Graph::convert_to_ngraph_nodes_in_parallel() {
+    const auto& node_protos = m_model->get_graph().node();
+
+    // The level of a node is the next one after the levels of the nodes producing its inputs. The bodies of the
+    // nodes with subgraphs may read any value of the outer scope, so these nodes go after all the previous ones.
+    std::vector<std::vector<int>> levels;
+    std::unordered_map<std::string, std::size_t> output_levels;
+    for (int i = 0; i < node_protos.size(); ++i) {
+        const auto& node_proto = node_protos.Get(i);
+        std::size_t level = 0;
+        if (detail::has_subgraphs(node_proto)) {
+            level = levels.size();
+        } else {
+            for (const auto& name : node_proto.input()) {
+                const auto it = output_levels.find(name);
+                if (it != std::end(output_levels)) {
+                    level = std::max(level, it->second + 1);
+                }
+            }
+        }
+        if (level == levels.size()) {
+            levels.emplace_back();
+        }
+        levels[level].push_back(i);
+        for (const auto& name : node_proto.output()) {
+            output_levels[name] = level;
+        }
+    }
+
+    for (const auto& level : levels) {
+        std::vector<int> isolated_indices;
+        std::vector<int> serial_indices;
+        for (const auto i : level) {
+            (detail::has_subgraphs(node_protos.Get(i)) ? serial_indices : isolated_indices).push_back(i);
+        }
+        if (!WorkerPool::is_split(isolated_indices.size())) {
+            // the small levels are converted by the calling thread, so their nodes read the graph directly
+            serial_indices.insert(std::begin(serial_indices), std::begin(isolated_indices), std::end(isolated_indices));
+            isolated_indices.clear();
+        }
+
+        std::vector<detail::IsolatedNode> isolated_nodes(isolated_indices.size());
+        m_workers->parallel_for(isolated_indices.size(), [&](std::size_t n) {
+            auto& isolated = isolated_nodes[n];
+            try {
+                const auto& node_proto = node_protos.Get(isolated_indices[n]);
+                for (const auto& name : node_proto.input()) {
+                    if (!name.empty() && !isolated.inputs.count(name)) {
+                        const auto graph_output = get_ng_node_from_cache(name);
+                        const auto placeholder = detail::make_placeholder(graph_output);
+                        isolated.inputs.emplace(name, placeholder);
+                        if (!ngraph::op::is_null(placeholder)) {
+                            isolated.placeholders.emplace(placeholder.get_node(), graph_output);
+                        }
+                    }
+                }
+                isolated.onnx_node = common::make_unique<Node>(node_proto, *this);
+                detail::isolated_inputs() = &isolated.inputs;
+                const auto& ng_node_factory = m_model->get_operator(node_proto.op_type(), get_node_domain(node_proto));
+                isolated.outputs = ng_node_factory(*isolated.onnx_node);
+                detail::isolated_inputs() = nullptr;
+                isolated.nodes = detail::collect_new_nodes(isolated);
+            } catch (...) {
+                // the node is converted again serially, so the error is reported with the ONNX node information
+                detail::isolated_inputs() = nullptr;
+                isolated.failed = true;
+            }
+        });
+
+        for (std::size_t n = 0; n < isolated_nodes.size(); ++n) {
+            auto& isolated = isolated_nodes[n];
+            if (isolated.failed) {
+                convert_node(Node{node_protos.Get(isolated_indices[n]), *this});
+                continue;
+            }
+            // connect the new nodes to the graph
+            for (const auto& placeholder : isolated.placeholders) {
+                for (auto& input : placeholder.first->output(0).get_target_inputs()) {
+                    input.replace_source_output(placeholder.second);
+                }
+            }
+            for (auto& output : isolated.outputs) {
+                const auto it = isolated.placeholders.find(output.get_node());
+                if (it != std::end(isolated.placeholders)) {
+                    output = it->second;
+                }
+            }
+            // the placeholders hide the values of the inputs, so the shapes depending on them are inferred again
+            try {
+                for (const auto& node : isolated.nodes) {
+                    const auto outputs = node->outputs();
+                    if (std::any_of(std::begin(outputs), std::end(outputs), [](const Output<ngraph::Node>& output) {
+                            return output.get_partial_shape().is_dynamic();
+                        })) {
+                        node->revalidate_and_infer_types();
+                    }
+                }
+            } catch (const std::exception& exc) {
+                std::string msg_prefix = error::detail::get_error_msg_prefix(*isolated.onnx_node);
+                throw ngraph_error(msg_prefix + ":\n" + std::string(exc.what()));
             }
+            cache_ng_nodes(*isolated.onnx_node, isolated.outputs);
+        }
+
+        for (const auto i : serial_indices) {
+            convert_node(Node{node_protos.Get(i), *this});
         }
-        OutputVector ng_nodes{make_ng_nodes(node)};
     }
 }
 
@@ -187,6 +411,7 @@ void Graph::remove_dangling_parameters() {
 
 std::shared_ptr<Function> Graph::convert() {
     convert_to_ngraph_nodes();
+    m_workers.reset();
     remove_dangling_parameters();
     return create_function();
 }
@@ -240,6 +465,7 @@ std::shared_ptr<Function> Graph::create_function() {
 
 std::shared_ptr<Function> Graph::decode() {
     decode_to_framework_nodes();
+    m_workers.reset();
     return create_function();
 }
 
@@ -283,14 +509,17 @@ OutputVector Graph::make_ng_nodes(const Node& onnx_node) const {
         std::rethrow_exception(std::current_exception());
     }
 
+    cache_ng_nodes(onnx_node, ng_subgraph_outputs);
+    return ng_subgraph_outputs;
+}
+
+void Graph::cache_ng_nodes(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const {
     set_friendly_names(onnx_node, ng_subgraph_outputs);
 
     for (std::size_t i{0}; i < onnx_node.get_outputs_size(); ++i) {
         auto ng_node_output = ng_subgraph_outputs.at(i);
         m_cache->emplace_node(onnx_node.output(i), std::move(ng_node_output));
     }
-
-    return ng_subgraph_outputs;
 }
 
 void Graph::set_friendly_names(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const {
@@ -341,7 +570,7 @@ const OpsetImports& Graph::get_opset_imports() const {
 }
 
 Subgraph::Subgraph(std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto, const Graph* parent_graph)
-    : Graph(model_proto, common::make_unique<GraphCache>(), parent_graph->get_telemetry()),
+    : Graph(model_proto, common::make_unique<GraphCache>(), parent_graph->get_telemetry(), parent_graph->get_workers()),
       m_parent_graph(parent_graph) {}
 
 bool Subgraph::is_ng_node_in_cache(const std::string& name) const {
@@ -422,6 +651,7 @@ void Subgraph::find_inputs_from_parent() {
 
 std::shared_ptr<Function> Subgraph::convert() {
     convert_to_ngraph_nodes();
+    m_workers.reset();
     find_inputs_from_parent();
     return create_function();
 }
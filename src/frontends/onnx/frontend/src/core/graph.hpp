@@ -8,17 +8,27 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/telemetry_extension.hpp"
 #include "core/graph_cache.hpp"
 #include "core/model.hpp"
+#include "core/worker_pool.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "onnx_import/core/operator_set.hpp"
 
 namespace ngraph {
 namespace onnx_import {
+namespace detail {
+/// \brief      Return the inputs of the node translated in isolation by the current thread.
+///
+/// \note       The nodes translated in parallel read placeholders of their inputs instead of the graph
+///             outputs, see Graph::convert_to_ngraph_nodes_in_parallel. nullptr if the node reads the graph.
+const std::unordered_map<std::string, Output<ngraph::Node>>*& isolated_inputs();
+}  // namespace detail
+
 class Graph : public std::enable_shared_from_this<Graph> {
 public:
     Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model_proto2,
@@ -49,10 +59,17 @@ public:
         return m_telemetry;
     }
 
+    /// \brief      Return the threads shared by the graph and its subgraphs while the model is imported.
+    /// \return     The worker pool, nullptr after the graph was converted or decoded.
+    const std::shared_ptr<WorkerPool>& get_workers() const {
+        return m_workers;
+    }
+
 protected:
     Graph(const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model,
           std::unique_ptr<GraphCache>&& cache,
-          const std::shared_ptr<ov::frontend::TelemetryExtension>& telemetry = {});
+          const std::shared_ptr<ov::frontend::TelemetryExtension>& telemetry = {},
+          const std::shared_ptr<WorkerPool>& workers = {});
 
     void set_friendly_names(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const;
 
@@ -65,8 +82,22 @@ protected:
     ParameterVector m_parameters;
     std::unique_ptr<Model> m_model;
     std::unique_ptr<GraphCache> m_cache;
+    // released when the graph is converted or decoded, so the threads don't outlive the import
+    std::shared_ptr<WorkerPool> m_workers;
 
 private:
+    /// \brief      Converts the nodes level by level, the nodes of a level don't depend on each other.
+    ///
+    /// \note       Enabled by OV_ONNX_PARALLEL_TRANSLATION=1. The nodes of a level are translated concurrently,
+    ///             each one reads placeholders of its inputs: the constants keep their values, the other
+    ///             inputs keep their type and shape only, so the translators don't see the values propagated
+    ///             through them. The placeholders are replaced by the graph outputs, the new nodes are
+    ///             revalidated and cached serially. The nodes with subgraphs (Loop, If, Scan) are converted
+    ///             serially after the rest of their level, their bodies are converted the same way.
+    void convert_to_ngraph_nodes_in_parallel();
+    void convert_node(const Node& node);
+    void cache_ng_nodes(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const;
+
     std::vector<Node> m_nodes;
     std::shared_ptr<ov::frontend::TelemetryExtension> m_telemetry;
 };
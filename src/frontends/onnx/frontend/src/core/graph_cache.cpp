@@ -19,15 +19,19 @@ void GraphCache::remove_node(const std::string& name) {
 }
 
 Output<ngraph::Node> GraphCache::get_node(const std::string& name) const {
-    try {
-        return m_graph_cache_map.at(name);
-    } catch (const std::out_of_range&) {
+    const auto it = m_graph_cache_map.find(name);
+    if (it == m_graph_cache_map.end()) {
         throw ngraph_error(name + " node not found in graph cache");
     }
+    return it->second;
 }
 
 bool GraphCache::contains(const std::string& name) const {
     return (m_graph_cache_map.count(name) > 0);
 }
+
+void GraphCache::reserve(std::size_t nodes_count) {
+    m_graph_cache_map.reserve(nodes_count);
+}
 }  // namespace onnx_import
 }  // namespace ngraph
@@ -4,9 +4,9 @@
 
 #pragma once
 
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "ngraph/node.hpp"
 
@@ -44,10 +44,15 @@ public:
     /// \return     true if the node named `name` exist in the cache, false otherwise.
     virtual bool contains(const std::string& name) const;
 
+    /// \brief      Reserve the space for the nodes to avoid rehashing while the graph is converted.
+    ///
+    /// \param[in]  nodes_count  The expected number of nodes in the cache.
+    void reserve(std::size_t nodes_count);
+
     virtual ~GraphCache() = default;
 
 private:
-    std::map<std::string, Output<ngraph::Node>> m_graph_cache_map;
+    std::unordered_map<std::string, Output<ngraph::Node>> m_graph_cache_map;
 };
 }  // namespace onnx_import
 }  // namespace ngraph
@@ -164,9 +164,10 @@ Subgraph Node::Impl::get_attribute_value(const std::string& name) const {
 
 OutputVector Node::Impl::get_ng_inputs() const {
     OutputVector result;
+    const auto isolated_inputs = detail::isolated_inputs();
     for (const auto& name : m_node_proto->input()) {
         if (!name.empty()) {
-            result.push_back(m_graph->get_ng_node_from_cache(name));
+            result.push_back(isolated_inputs ? isolated_inputs->at(name) : m_graph->get_ng_node_from_cache(name));
         } else {
             result.push_back(std::make_shared<NullNode>()->output(0));
         }
@@ -7,6 +7,7 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -70,18 +71,23 @@ inline std::vector<T> __get_data(const Container& container) {
 #endif
 }
 
+template <typename T>
+inline std::vector<T> __get_raw_data(const char* raw_data, size_t raw_data_size, int onnx_data_type) {
+    auto it = reinterpret_cast<const T*>(raw_data);
+    return std::vector<T>(it, it + (raw_data_size / onnx_common::get_onnx_data_size(onnx_data_type)));
+}
+
 template <typename T>
 inline std::vector<T> __get_raw_data(const std::string& raw_data, int onnx_data_type) {
-    auto it = reinterpret_cast<const T*>(raw_data.data());
-    return std::vector<T>(it, it + (raw_data.size() / onnx_common::get_onnx_data_size(onnx_data_type)));
+    return __get_raw_data<T>(raw_data.data(), raw_data.size(), onnx_data_type);
 }
 
 template <typename T>
 inline std::vector<T> get_external_data(const ONNX_NAMESPACE::TensorProto& tensor) {
     const auto tensor_external_data = TensorExternalData(tensor);
-    const auto raw_data = tensor_external_data.load_external_data();
+    const auto buffer = tensor_external_data.load_external_mmap_data();
 
-    return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+    return detail::__get_raw_data<T>(buffer->get_ptr<char>(), buffer->size(), tensor.data_type());
 }
 
 bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor) {
@@ -340,9 +346,10 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const detail::MappedMemoryHandles& mmap_cache = {})
         : m_tensor_proto{&tensor},
-          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
+          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
+          m_mmap_cache{mmap_cache} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -459,7 +466,32 @@ public:
 private:
     template <typename T>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        auto constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        if (m_tensor_proto->has_segment()) {
+            throw error::tensor::segments_unsupported{};
+        }
+        std::shared_ptr<ngraph::op::Constant> constant;
+        const auto data_size = shape_size(m_shape) * type.size();
+        if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto)) {
+            // the constant shares the mapped file, the data is read from the disk on demand
+            const auto buffer = detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data(m_mmap_cache);
+            const auto aligned = reinterpret_cast<uintptr_t>(buffer->get_ptr()) % type.size() == 0;
+            if (buffer->size() == data_size && aligned) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+            } else {
+                constant = std::make_shared<ngraph::op::Constant>(
+                    type,
+                    m_shape,
+                    detail::tensor::detail::__get_raw_data<T>(buffer->get_ptr<char>(),
+                                                              buffer->size(),
+                                                              m_tensor_proto->data_type()));
+            }
+        } else if (m_tensor_proto->has_raw_data() && m_tensor_proto->raw_data().size() == data_size) {
+            // the raw data is copied directly to the constant
+            const void* raw_data = m_tensor_proto->raw_data().data();
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, raw_data);
+        } else {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+        }
         if (m_tensor_proto->has_name()) {
             constant->set_friendly_name(get_name());
         }
@@ -468,6 +500,7 @@ private:
 
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "core/worker_pool.hpp"
+
+#include <algorithm>
+#include <system_error>
+
+namespace ngraph {
+namespace onnx_import {
+namespace {
+// a thread handles a few iterations at least, so the small loops are run by the calling thread only
+constexpr std::size_t min_iterations_per_thread = 8;
+
+std::size_t get_threads_num(std::size_t count) {
+    return std::min<std::size_t>((count + min_iterations_per_thread - 1) / min_iterations_per_thread,
+                                 std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+}
+}  // namespace
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::run_iterations() {
+    for (std::size_t i = m_next++; i < m_count; i = m_next++) {
+        try {
+            (*m_func)(i);
+        } catch (...) {
+            m_errors[i] = std::current_exception();
+        }
+    }
+}
+
+void WorkerPool::work() {
+    std::size_t generation = 0;
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (true) {
+        m_start.wait(lock, [&] {
+            return m_stop || m_generation != generation;
+        });
+        if (m_stop) {
+            return;
+        }
+        generation = m_generation;
+        lock.unlock();
+        run_iterations();
+        lock.lock();
+        ++m_finished;
+        m_finish.notify_one();
+    }
+}
+
+bool WorkerPool::is_split(std::size_t count) {
+    return get_threads_num(count) > 1;
+}
+
+void WorkerPool::parallel_for(std::size_t count, const std::function<void(std::size_t)>& func) {
+    std::lock_guard<std::mutex> loop_lock{m_loop_mutex};
+    const std::size_t threads_num = get_threads_num(count);
+    const bool parallel = threads_num > 1;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_func = &func;
+        m_count = count;
+        m_next = 0;
+        m_errors.assign(count, nullptr);
+        m_finished = 0;
+        if (parallel) {
+            ++m_generation;
+        }
+    }
+    if (parallel) {
+        try {
+            while (m_threads.size() + 1 < threads_num) {
+                m_threads.emplace_back(&WorkerPool::work, this);
+            }
+        } catch (const std::system_error&) {
+            // the loop is run by the threads created so far
+        }
+        m_start.notify_all();
+    }
+    run_iterations();
+    if (parallel) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_finish.wait(lock, [&] {
+            return m_finished == m_threads.size();
+        });
+    }
+    m_func = nullptr;
+    for (const auto& error : m_errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+}  // namespace onnx_import
+}  // namespace ngraph
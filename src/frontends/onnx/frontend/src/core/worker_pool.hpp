@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph {
+namespace onnx_import {
+/// \brief      WorkerPool runs the parallel loops of one model import, including the loops of its subgraphs.
+///
+/// \note       The threads are created by the first loop large enough to be split and are reused by the
+///             next loops. They are joined when the pool is destroyed.
+class WorkerPool {
+public:
+    WorkerPool() = default;
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    ~WorkerPool();
+
+    /// \brief      Runs func(i) for i in [0, count) on the pool threads and the calling thread.
+    ///
+    /// \note       The exception of the first failed iteration is rethrown in the calling thread.
+    ///
+    /// \param[in]  count  The number of iterations.
+    /// \param[in]  func   The function called for every iteration.
+    void parallel_for(std::size_t count, const std::function<void(std::size_t)>& func);
+
+    /// \brief      Checks if a loop is split between threads, the smaller loops are run by the calling thread.
+    ///
+    /// \param[in]  count  The number of iterations.
+    static bool is_split(std::size_t count);
+
+private:
+    void run_iterations();
+    void work();
+
+    std::mutex m_loop_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_finish;
+    std::vector<std::thread> m_threads;
+    const std::function<void(std::size_t)>* m_func = nullptr;
+    std::vector<std::exception_ptr> m_errors;
+    std::size_t m_count = 0;
+    std::atomic<std::size_t> m_next{0};
+    std::size_t m_generation = 0;
+    std::size_t m_finished = 0;
+    bool m_stop = false;
+};
+}  // namespace onnx_import
+}  // namespace ngraph
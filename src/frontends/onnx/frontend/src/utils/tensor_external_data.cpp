@@ -4,7 +4,6 @@
 
 #include "utils/tensor_external_data.hpp"
 
-#include <fstream>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -20,51 +19,58 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
         if (entry.key() == "location")
             m_data_location = entry.value();
         if (entry.key() == "offset")
-            m_offset = std::stoi(entry.value());
+            m_offset = std::stoull(entry.value());
         if (entry.key() == "length")
-            m_data_length = std::stoi(entry.value());
+            m_data_length = std::stoull(entry.value());
         if (entry.key() == "checksum")
             m_sha1_digest = std::stoi(entry.value());
     }
 }
 
-std::string TensorExternalData::load_external_data() const {
-    NGRAPH_SUPPRESS_DEPRECATED_START
+std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>
+TensorExternalData::load_external_mmap_data(const MappedMemoryHandles& cache) const {
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    std::unique_lock<std::mutex> lock;
+    if (cache) {
+        lock = std::unique_lock<std::mutex>(cache->mutex);
+        const auto it = cache->files.find(m_data_location);
+        if (it != cache->files.end())
+            mapped_memory = it->second;
+    }
+    if (!mapped_memory) {
+        try {
+            NGRAPH_SUPPRESS_DEPRECATED_START
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    std::wstring path = ov::util::string_to_wstring(m_data_location);
+            mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(m_data_location));
 #else
-    std::string path = m_data_location;
+            mapped_memory = ov::util::load_mmap_object(m_data_location);
 #endif
-    NGRAPH_SUPPRESS_DEPRECATED_END
-    std::ifstream external_data_stream(path, std::ios::binary | std::ios::in | std::ios::ate);
-    if (external_data_stream.fail())
-        throw error::invalid_external_data{*this};
-
-    std::streamsize read_data_length;
-    if (m_data_length == 0)  // read entire file
-        read_data_length = external_data_stream.tellg();
-    else
-        read_data_length = m_data_length;
-
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
+            NGRAPH_SUPPRESS_DEPRECATED_END
+        } catch (const std::runtime_error&) {
+            throw error::invalid_external_data{*this};
+        }
+        if (cache)
+            cache->files.emplace(m_data_location, mapped_memory);
     }
-    // default value of m_offset is 0
-    external_data_stream.seekg(m_offset, std::ios::beg);
+    if (lock.owns_lock())
+        lock.unlock();
+
+    if (m_offset > mapped_memory->size())
+        throw error::invalid_external_data{*this};
+    // default value of m_data_length is 0, the data lasts till the end of the file in this case
+    const uint64_t data_length = m_data_length == 0 ? mapped_memory->size() - m_offset : m_data_length;
+    if (data_length > mapped_memory->size() - m_offset)
+        throw error::invalid_external_data{*this};
 
     if (m_sha1_digest != 0) {
         NGRAPH_WARN << "SHA1 checksum is not supported";
     }
 
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
-    external_data_stream.close();
-
-    return read_data;
+    // the mapped pages are read-only, the constants never write to their buffers
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        const_cast<char*>(mapped_memory->data()) + m_offset,
+        static_cast<size_t>(data_length),
+        mapped_memory);
 }
 
 std::string TensorExternalData::to_string() const {
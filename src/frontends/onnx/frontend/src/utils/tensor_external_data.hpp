@@ -6,22 +6,41 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  External data files mapped into memory, shared by the tensors stored in the same file.
+///         The initializers are loaded concurrently, so the access is synchronized.
+struct MappedMemoryCache {
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<ov::util::MappedMemory>> files;
+};
+using MappedMemoryHandles = std::shared_ptr<MappedMemoryCache>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
     TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
-    /// \brief      Load external data from tensor passed to constructor
+    /// \brief      Map external data from tensor passed to constructor into memory
     ///
-    /// \note       If read data from external file fails,
-    /// \note       If reading data from external files fails,
+    /// \note       If the external file cannot be mapped or the data doesn't fit into it,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into a std::string
-    std::string load_external_data() const;
+    /// \param      cache  Files already mapped by the other tensors, the file mapped
+    ///                    by this call is added to it (optional)
+    ///
+    /// \return     Buffer pointing to the mapped data, the file stays mapped while it's alive
+    std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>> load_external_mmap_data(
+        const MappedMemoryHandles& cache = {}) const;
 
     /// \brief      Represets parameter of external data as string
     ///
@@ -30,8 +49,8 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
+    uint64_t m_offset = 0;
+    uint64_t m_data_length = 0;
     int m_sha1_digest = 0;
 };
 }  // namespace detail
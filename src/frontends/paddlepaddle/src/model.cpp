@@ -4,13 +4,19 @@
 
 #include "paddlepaddle_frontend/model.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
 #include <queue>
+#include <thread>
 
 #include "decoder.hpp"
 #include "framework.pb.h"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddlepaddle_frontend/exceptions.hpp"
 #include "paddlepaddle_frontend/place.hpp"
 #include "pdpd_utils.hpp"
@@ -54,9 +60,24 @@ public:
     };
 
 private:
+    struct ConstDesc {
+        std::string name;
+        Shape shape;
+        element::Type type;
+    };
+    struct MappedConst {
+        std::shared_ptr<ov::util::MappedMemory> weights;
+        size_t offset;
+    };
+
     void loadPlaces();
+    std::vector<ConstDesc> getConstDescs() const;
+    void loadConsts(std::istream& weight_stream);
     template <typename T>
-    void loadConsts(const std::basic_string<T>& folder_with_weights, std::istream* weight_stream);
+    void loadConsts(const std::basic_string<T>& folder_with_weights);
+    template <typename T>
+    void loadCombinedConsts(const std::basic_string<T>& weights_path);
+    void createConsts(const std::vector<ConstDesc>& descs, const std::vector<MappedConst>& mapped_consts);
     std::vector<std::shared_ptr<OpPlacePDPD>> determine_cut_nodes() const;
 
     std::vector<std::shared_ptr<OpPlacePDPD>> m_op_places;
@@ -148,9 +169,13 @@ void InputModelPDPD::InputModelPDPDImpl::loadPlaces() {
 }
 
 namespace {
+// A tensor is stored as: version (u32), LoD level (u64), tensor version (u32), size of TensorDesc (u32),
+// TensorDesc and the data
+constexpr size_t tensor_header_size = 16;
+
 bool read_tensor(std::istream& is, char* data, size_t len) {
-    std::vector<char> header(16);
-    is.read(&header[0], 16);
+    std::vector<char> header(tensor_header_size);
+    is.read(&header[0], tensor_header_size);
     uint32_t dims_len = 0;
     is.read(reinterpret_cast<char*>(&dims_len), 4);
     std::vector<char> dims_struct(dims_len);
@@ -161,6 +186,59 @@ bool read_tensor(std::istream& is, char* data, size_t len) {
     return true;
 }
 
+// Returns the offset of the data of the tensor which starts at the offset in the mapped weights
+size_t get_tensor_data_offset(const ov::util::MappedMemory& weights,
+                              size_t offset,
+                              size_t data_length,
+                              const std::string& name) {
+    uint32_t dims_len = 0;
+    const auto size = weights.size();
+    FRONT_END_GENERAL_CHECK(offset <= size && size - offset >= tensor_header_size + sizeof(dims_len),
+                            "File containing constant with name ",
+                            name,
+                            " wasn't successfully read.");
+    std::memcpy(&dims_len, weights.data() + offset + tensor_header_size, sizeof(dims_len));
+    const auto data_offset = offset + tensor_header_size + sizeof(dims_len) + dims_len;
+    FRONT_END_GENERAL_CHECK(data_offset <= size && size - data_offset >= data_length,
+                            "File containing constant with name ",
+                            name,
+                            " wasn't successfully read.");
+    return data_offset;
+}
+
+template <typename T>
+std::shared_ptr<ov::util::MappedMemory> map_weights(const std::basic_string<T>& path) {
+    std::shared_ptr<ov::util::MappedMemory> weights;
+    try {
+        weights = ov::util::load_mmap_object(path);
+    } catch (const std::runtime_error& ex) {
+        FRONT_END_THROW(std::string("Cannot open file for constant value: ") + ex.what());
+    }
+    return weights;
+}
+
+using DataCopy = std::pair<const char*, std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+
+// Copies the data to the buffers, the independent tensors are copied by the different threads
+void copy_in_parallel(const std::vector<DataCopy>& copies) {
+    std::atomic<size_t> next{0};
+    auto copy = [&]() {
+        for (size_t i = next++; i < copies.size(); i = next++) {
+            std::memcpy(copies[i].second->get_ptr(), copies[i].first, copies[i].second->size());
+        }
+    };
+    const size_t threads_num =
+        std::min<size_t>(copies.size(), std::max<size_t>(std::thread::hardware_concurrency(), 1));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threads_num; i++) {
+        threads.emplace_back(copy);
+    }
+    copy();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
 template <typename T>
 std::basic_string<T> get_const_path(const std::basic_string<T>& folder_with_weights, const std::string& name) {
     return folder_with_weights + pdpd::get_path_sep<T>() + name;
@@ -176,16 +254,13 @@ std::basic_string<wchar_t> get_const_path(const std::basic_string<wchar_t>& fold
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_path) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (pdpd::endsWith(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_path = path;
+        weights_path->replace(weights_path->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += pdpd::get_path_sep<T>() + "__model__";
     }
@@ -194,16 +269,14 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path,
+                                          std::basic_string<wchar_t>* weights_path) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (pdpd::endsWith(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_path = path;
+        weights_path->replace(weights_path->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += pdpd::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -258,9 +331,10 @@ std::vector<std::shared_ptr<OpPlacePDPD>> InputModelPDPD::InputModelPDPDImpl::de
     return new_op_places;
 }
 
-template <typename T>
-void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::basic_string<T>& folder_with_weights,
-                                                    std::istream* weight_stream) {
+std::vector<InputModelPDPD::InputModelPDPDImpl::ConstDesc> InputModelPDPD::InputModelPDPDImpl::getConstDescs()
+    const {
+    // the persistable variables are stored in the combined weights file in the order of their names
+    std::vector<ConstDesc> descs;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -271,29 +345,93 @@ void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::basic_string<T>&
 
         FRONT_END_GENERAL_CHECK(var_desc.type().type() == paddle::framework::proto::VarType::LOD_TENSOR);
         const auto& tensor = var_desc.type().lod_tensor().tensor();
-        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
-        const auto& type = TYPE_MAP[tensor.data_type()];
-        const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
-
-        bool read_succeed = false;
-        if (weight_stream) {
-            read_succeed = read_tensor(*weight_stream, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else if (!folder_with_weights.empty()) {
-            std::ifstream is(get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
-            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else {
-            FRONT_END_GENERAL_CHECK(false, "Either folder with weights or stream must be provided.");
-        }
-        FRONT_END_GENERAL_CHECK(read_succeed,
+        descs.push_back({name, Shape(tensor.dims().cbegin(), tensor.dims().cend()), TYPE_MAP[tensor.data_type()]});
+    }
+    return descs;
+}
+
+void InputModelPDPD::InputModelPDPDImpl::loadConsts(std::istream& weight_stream) {
+    for (const auto& desc : getConstDescs()) {
+        const auto data_length = shape_size(desc.shape) * desc.type.size();
+        auto tensor_data = std::make_shared<ngraph::runtime::AlignedBuffer>(data_length);
+        FRONT_END_GENERAL_CHECK(read_tensor(weight_stream, tensor_data->get_ptr<char>(), data_length),
                                 "File containing constant with name ",
-                                name,
+                                desc.name,
                                 " wasn't successfully read.");
 
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
-        const_node->set_friendly_name(name);
-        m_tensor_values[name] = const_node;
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+            tensor_data->get_ptr<char>(),
+            data_length,
+            tensor_data);
+        auto const_node = std::make_shared<opset7::Constant>(desc.type, desc.shape, buffer);
+        const_node->set_friendly_name(desc.name);
+        m_tensor_values[desc.name] = const_node;
+    }
+}
+
+template <typename T>
+void InputModelPDPD::InputModelPDPDImpl::loadConsts(const std::basic_string<T>& folder_with_weights) {
+    const auto descs = getConstDescs();
+    std::vector<MappedConst> mapped_consts;
+    mapped_consts.reserve(descs.size());
+    for (const auto& desc : descs) {
+        auto weights = map_weights(get_const_path(folder_with_weights, desc.name));
+        const auto data_length = shape_size(desc.shape) * desc.type.size();
+        const auto offset = get_tensor_data_offset(*weights, 0, data_length, desc.name);
+        mapped_consts.push_back({weights, offset});
+    }
+    createConsts(descs, mapped_consts);
+}
+
+template <typename T>
+void InputModelPDPD::InputModelPDPDImpl::loadCombinedConsts(const std::basic_string<T>& weights_path) {
+    const auto descs = getConstDescs();
+    auto weights = map_weights(weights_path);
+    // the tensors follow each other, so all the offsets are found in one pass over the file
+    std::vector<MappedConst> mapped_consts;
+    mapped_consts.reserve(descs.size());
+    size_t offset = 0;
+    for (const auto& desc : descs) {
+        const auto data_length = shape_size(desc.shape) * desc.type.size();
+        const auto data_offset = get_tensor_data_offset(*weights, offset, data_length, desc.name);
+        mapped_consts.push_back({weights, data_offset});
+        offset = data_offset + data_length;
+    }
+    createConsts(descs, mapped_consts);
+}
+
+void InputModelPDPD::InputModelPDPDImpl::createConsts(const std::vector<ConstDesc>& descs,
+                                                      const std::vector<MappedConst>& mapped_consts) {
+    using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+    using CopiedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>;
+
+    // the constants share the mapped weights, the misaligned data is copied
+    std::vector<std::shared_ptr<ngraph::runtime::AlignedBuffer>> buffers(descs.size());
+    std::vector<DataCopy> copies;
+    for (size_t i = 0; i < descs.size(); i++) {
+        const auto& desc = descs[i];
+        const auto data_length = shape_size(desc.shape) * desc.type.size();
+        const auto data = mapped_consts[i].weights->data() + mapped_consts[i].offset;
+        if (reinterpret_cast<uintptr_t>(data) % desc.type.size() == 0) {
+            buffers[i] = std::make_shared<MappedBuffer>(const_cast<char*>(data), data_length, mapped_consts[i].weights);
+        } else {
+            buffers[i] = std::make_shared<ngraph::runtime::AlignedBuffer>(data_length);
+            copies.emplace_back(data, buffers[i]);
+        }
+    }
+    copy_in_parallel(copies);
+
+    for (size_t i = 0; i < descs.size(); i++) {
+        const auto& desc = descs[i];
+        std::shared_ptr<opset7::Constant> const_node;
+        if (auto mapped = std::dynamic_pointer_cast<MappedBuffer>(buffers[i])) {
+            const_node = std::make_shared<opset7::Constant>(desc.type, desc.shape, mapped);
+        } else {
+            auto copied = std::make_shared<CopiedBuffer>(buffers[i]->get_ptr<char>(), buffers[i]->size(), buffers[i]);
+            const_node = std::make_shared<opset7::Constant>(desc.type, desc.shape, copied);
+        }
+        const_node->set_friendly_name(desc.name);
+        m_tensor_values[desc.name] = const_node;
     }
 }
 
@@ -304,9 +442,8 @@ InputModelPDPD::InputModelPDPDImpl::InputModelPDPDImpl(const std::basic_string<T
     : m_fw_ptr{std::make_shared<ProgramDesc>()},
       m_input_model(input_model),
       m_telemetry(telemetry) {
-    std::string empty_str;
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_path;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_path), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -319,10 +456,12 @@ InputModelPDPD::InputModelPDPDImpl::InputModelPDPDImpl(const std::basic_string<T
         version >= 2000000 || version == 0,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
-    if (weights_stream && weights_stream.is_open()) {
-        loadConsts(std::basic_string<T>{}, &weights_stream);
+    // Don't throw error if the weights file doesn't exist
+    // It may mean that model don't have constants
+    if (!weights_path.empty() && std::ifstream(weights_path, std::ios::binary).is_open()) {
+        loadCombinedConsts(weights_path);
     } else {
-        loadConsts(path, nullptr);
+        loadConsts(path);
     }
 }
 
@@ -343,7 +482,7 @@ InputModelPDPD::InputModelPDPDImpl::InputModelPDPDImpl(const std::vector<std::is
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     loadPlaces();
     if (streams.size() > 1)
-        loadConsts(std::string(), streams[1]);
+        loadConsts(*streams[1]);
 }
 
 std::vector<Place::Ptr> InputModelPDPD::InputModelPDPDImpl::getInputs() const {
@@ -38,6 +38,13 @@ public:
      */
     virtual void Reset();
 
+    /**
+     * @brief Shrinks the variable state with a dynamic dimension to the given length along this dimension, e.g.
+     * drops the last tokens of the key/value cache
+     * @param length A new length, must not exceed the current one
+     */
+    virtual void Trim(size_t length);
+
     /**
      * @brief Sets the new state for the next inference
      * @param newState A new state
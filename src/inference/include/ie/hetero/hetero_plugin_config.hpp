@@ -34,5 +34,43 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of subgraphs.
+ * In this mode every subgraph stage limits the number of infer requests it runs concurrently to the
+ * optimal number of infer requests of its device and the rest are queued, so several infer requests can be
+ * processed by different stages at the same time.
+ * The intermediate blobs between the subgraphs belong to every infer request and are not double-buffered
+ * inside one infer request, so the pipeline depth is the number of infer requests the application keeps in
+ * flight, see METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS).
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINING);
+
+/**
+ * @brief The key for enabling of cost model based partitioning.
+ * Layers supported by several TARGET_FALLBACK devices are moved between them so that the estimated
+ * compute cost, the number of subgraphs and the amount of data transferred between subgraphs are minimal.
+ * Has no effect if affinities are set by user.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING);
+
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @def HETERO_METRIC_KEY(name)
+ * @brief Shortcut for defining HETERO executable network metrics
+ */
+#define HETERO_METRIC_KEY(name)              METRIC_KEY(HETERO_##name)
+#define DECLARE_HETERO_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(HETERO_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric to get summary of the partition chosen by HETERO_COST_MODEL_PARTITIONING mode.
+ * Empty if the mode is disabled.
+ */
+DECLARE_HETERO_METRIC_KEY(PARTITION_REPORT, std::string);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
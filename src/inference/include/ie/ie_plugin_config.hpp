@@ -405,6 +405,39 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key defines the maximum total size (in bytes) of the compiled network blobs kept in CACHE_DIR.
+ *
+ * When the limit is exceeded, the least recently used blobs are removed. Default value is 0, which means no limit.
+ * The key is applicable to the models cache enabled for all devices:
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}, {CONFIG_KEY(CACHE_SIZE_LIMIT), "1073741824"}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(CACHE_SIZE_LIMIT);
+
+/**
+ * @brief This key enables reading of the compiled network blobs from CACHE_DIR via memory mapping.
+ *
+ * The imported network is read directly from the mapped file instead of the file stream.
+ * Possible values: PluginConfigParams::YES or PluginConfigParams::NO (default).
+ */
+DECLARE_CONFIG_KEY(CACHE_MMAP);
+
+/**
+ * @brief This key enables warm start of the network compilation.
+ *
+ * If the network for the device is not found in CACHE_DIR, LoadNetwork returns the network compiled for CPU,
+ * while the network for the requested device is compiled in background and replaces the CPU one once it is ready.
+ * The CPU network is cached as well, so the next warm start is served from the cache.
+ * The key has no effect if CACHE_DIR is not set.
+ * The configuration keys and the metrics of the returned network belong to the requested device, so
+ * querying or changing them waits for the background compilation.
+ * Possible values: PluginConfigParams::YES or PluginConfigParams::NO (default).
+ */
+DECLARE_CONFIG_KEY(CACHE_WARM_START);
+
 }  // namespace PluginConfigParams
 
 /**
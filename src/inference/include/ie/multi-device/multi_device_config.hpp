@@ -34,5 +34,16 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief The policy used to distribute the infer requests among the devices, possible values:
+ *  - MULTI_DEVICE_PRIORITY (default): the first device (in the DEVICE_PRIORITIES order) with an idle request is used
+ *  - MULTI_MIN_COMPLETION_TIME: the device with the smallest expected completion time is used, the estimation is based
+ *    on the moving average of the latency measured for each device. A request may wait for a faster busy device
+ *    rather than being started on a slower idle one.
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(DEVICE_PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
@@ -55,6 +55,13 @@ public:
      */
     void reset();
 
+    /**
+     * @brief Shrinks the state with a dynamic dimension to the given length along this dimension,
+     * e.g. to restart the beam search from a shorter prefix
+     * @param length A new length, must not exceed the current one
+     */
+    void trim(size_t length);
+
     /**
      * @brief Gets name of current variable state, if length of array is not enough name is truncated by len, null
      * terminator is inserted as well. As variable state name `variable_id` from according `ReadValue` used.
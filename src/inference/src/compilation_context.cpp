@@ -12,15 +12,25 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
-#include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -41,6 +51,342 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+namespace {
+
+// Constant data is split into chunks of this size which are hashed in parallel
+constexpr size_t kConstantChunkSize = 1 << 20;
+
+uint64_t hash_bytes(const char* data, size_t size) {
+    constexpr uint64_t prime = 0x9e3779b97f4a7c15ULL;
+    uint64_t h = 0xcbf29ce484222325ULL ^ size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        h = (h ^ word) * prime;
+        h ^= h >> 29;
+    }
+    for (; i < size; ++i) {
+        h = (h ^ static_cast<unsigned char>(data[i])) * prime;
+    }
+    return h ^ (h >> 32);
+}
+
+uint64_t hash_constant_data(const char* data, size_t size) {
+    const size_t chunks = (size + kConstantChunkSize - 1) / kConstantChunkSize;
+    std::vector<uint64_t> chunkHashes(chunks);
+    parallel_for(chunks, [&](size_t chunk) {
+        const size_t offset = chunk * kConstantChunkSize;
+        chunkHashes[chunk] = hash_bytes(data + offset, std::min(kConstantChunkSize, size - offset));
+    });
+    uint64_t seed = hash_combine(0, size);
+    for (auto h : chunkHashes) {
+        seed = hash_combine(seed, h);
+    }
+    return seed;
+}
+
+/**
+ * @brief Caches hashes of large constants, so the weights shared by several compiled networks are hashed once.
+ * Constant data is immutable, an entry is valid as long as the buffer it was computed for is alive.
+ */
+class ConstantHashCache {
+public:
+    uint64_t get(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+        const auto data = static_cast<const char*>(buffer->get_ptr());
+        const auto size = buffer->size();
+        if (size < kConstantChunkSize)
+            return hash_constant_data(data, size);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_entries.find(data);
+            if (it != m_entries.end() && it->second.buffer.lock() == buffer && it->second.size == size)
+                return it->second.hash;
+        }
+        const auto hash = hash_constant_data(data, size);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            it = it->second.buffer.expired() ? m_entries.erase(it) : std::next(it);
+        }
+        m_entries[data] = {buffer, size, hash};
+        return hash;
+    }
+
+private:
+    struct Entry {
+        std::weak_ptr<ngraph::runtime::AlignedBuffer> buffer;
+        size_t size;
+        uint64_t hash;
+    };
+    std::mutex m_mutex;
+    std::unordered_map<const void*, Entry> m_entries;
+};
+
+ConstantHashCache& constantHashCache() {
+    static ConstantHashCache cache;
+    return cache;
+}
+
+uint64_t hash_model(const ov::Model& model);
+
+uint64_t hash_shape(uint64_t seed, const ov::PartialShape& shape) {
+    seed = hash_combine(seed, shape.rank().is_dynamic());
+    if (shape.rank().is_dynamic())
+        return seed;
+    for (const auto& dim : shape) {
+        seed = hash_combine(seed, dim.get_min_length());
+        seed = hash_combine(seed, dim.get_max_length());
+    }
+    return seed;
+}
+
+/**
+ * @brief Combines names and values of all the visited node attributes into the hash
+ */
+class HashVisitor : public ov::AttributeVisitor {
+public:
+    explicit HashVisitor(uint64_t& seed) : m_seed(seed) {}
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        combine(name);
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            combine(constantHashCache().get(a->get()));
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            combine(info.variable_id);
+            combine(info.data_type.get_type_name());
+            m_seed = hash_shape(m_seed, info.data_shape);
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            combine(attrs.get_type_name());
+            combine(attrs.get_opset_name());
+            for (const auto& attr : attrs) {
+                combine(attr.first);
+                combine(attr.second);
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            for (const auto& value : a->get()) {
+                combine(value);
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get()) {
+                combine(type.get_type_name());
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<
+                       std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                combine(std::string(desc->get_type_info().name));
+                combine(desc->m_input_index);
+                combine(desc->m_body_parameter_index);
+                if (auto slice = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::SliceInputDescription>(desc)) {
+                    combine_slice(*slice);
+                } else if (auto merged =
+                               ov::as_type_ptr<ov::op::util::MultiSubGraphOp::MergedInputDescription>(desc)) {
+                    combine(merged->m_body_value_index);
+                }
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<
+                       std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                combine(std::string(desc->get_type_info().name));
+                combine(desc->m_body_value_index);
+                combine(desc->m_output_index);
+                if (auto concat = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::ConcatOutputDescription>(desc)) {
+                    combine_slice(*concat);
+                } else if (auto body = ov::as_type_ptr<ov::op::util::MultiSubGraphOp::BodyOutputDescription>(desc)) {
+                    combine(body->m_iteration);
+                }
+            }
+        } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            combine(a->get().current_iteration_input_idx);
+            combine(a->get().body_condition_output_idx);
+        } else {
+            IE_THROW() << "Unsupported attribute type for hash calculation: " << name;
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        combine_value(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        combine_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        combine(name);
+        combine(hash_model(*adapter.get()));
+    }
+
+private:
+    template <typename T>
+    void combine(const T& value) {
+        m_seed = hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void combine_value(const std::string& name, const T& value) {
+        combine(name);
+        combine(value);
+    }
+
+    template <typename T>
+    void combine_vector(const std::string& name, const std::vector<T>& values) {
+        combine(name);
+        combine(values.size());
+        for (const auto& value : values) {
+            combine(value);
+        }
+    }
+
+    template <typename T>
+    void combine_slice(const T& slice) {
+        combine(slice.m_start);
+        combine(slice.m_stride);
+        combine(slice.m_part_size);
+        combine(slice.m_end);
+        combine(slice.m_axis);
+    }
+
+    uint64_t& m_seed;
+};
+
+uint64_t hash_port_rt_info(uint64_t seed, const ov::RTMap& rtInfo) {
+    // only runtime attributes are the part of the serialized model, the same is considered here
+    for (const auto& item : rtInfo) {
+        if (!item.second.is<ov::RuntimeAttribute>())
+            continue;
+        auto& attribute = const_cast<ov::Any&>(item.second).as<ov::RuntimeAttribute>();
+        uint64_t attributeSeed = hash_combine(seed, item.first);
+        HashVisitor visitor(attributeSeed);
+        if (attribute.visit_attributes(visitor))
+            seed = attributeSeed;
+    }
+    return seed;
+}
+
+/**
+ * @brief Structural hash of the model: walks the ops in topological order and combines op types, attributes,
+ * connections, port types, shapes and tensor names. Unlike the hash of the serialized model it doesn't produce
+ * IR, and constant data is hashed in parallel chunks.
+ */
+uint64_t hash_model(const ov::Model& model) {
+    uint64_t seed = 0;
+    // auto generated names differ between the copies of the same model
+    if (model.get_friendly_name() != model.get_name())
+        seed = hash_combine(seed, model.get_friendly_name());
+
+    const auto orderedOps = model.get_ordered_ops();
+    std::unordered_map<const ov::Node*, size_t> opIds;
+    for (size_t i = 0; i < orderedOps.size(); ++i) {
+        opIds[orderedOps[i].get()] = i;
+    }
+
+    for (const auto& op : orderedOps) {
+        const auto& typeInfo = op->get_type_info();
+        seed = hash_combine(seed, std::string(typeInfo.name));
+        seed = hash_combine(seed, typeInfo.get_version());
+        if (op->get_friendly_name() != op->get_name())
+            seed = hash_combine(seed, op->get_friendly_name());
+
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            seed = hash_combine(seed, opIds.at(source.get_node()));
+            seed = hash_combine(seed, source.get_index());
+            seed = hash_port_rt_info(seed, input.get_rt_info());
+        }
+        for (const auto& output : op->outputs()) {
+            seed = hash_combine(seed, output.get_element_type().get_type_name());
+            seed = hash_shape(seed, output.get_partial_shape());
+            std::vector<std::string> names(output.get_names().begin(), output.get_names().end());
+            std::sort(names.begin(), names.end());
+            for (const auto& name : names) {
+                seed = hash_combine(seed, name);
+            }
+            seed = hash_port_rt_info(seed, output.get_rt_info());
+        }
+
+        HashVisitor visitor(seed);
+        if (!op->visit_attributes(visitor))
+            IE_THROW() << "Visitor API is not supported in " << op;
+    }
+
+    // parameters and results are not necessarily visited in their model order
+    for (const auto& parameter : model.get_parameters()) {
+        seed = hash_combine(seed, opIds.at(parameter.get()));
+    }
+    for (const auto& result : model.get_results()) {
+        seed = hash_combine(seed, opIds.at(result.get()));
+    }
+    for (const auto& sink : model.get_sinks()) {
+        seed = hash_combine(seed, opIds.at(sink.get()));
+    }
+    return seed;
+}
+
+}  // namespace
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -69,15 +415,14 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
 
     IE_ASSERT(network.getFunction());
 
-    uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate structural hash on function
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
     m.run_passes(net.getFunction());
+    uint64_t seed = hash_model(*net.getFunction());
 
-    // 2. Compute hash on serialized data and options
+    // 2. Compute hash on options
     for (const auto& kvp : compileOptions) {
         seed = hash_combine(seed, kvp.first + kvp.second);
     }
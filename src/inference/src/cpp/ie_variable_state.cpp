@@ -68,6 +68,10 @@ void VariableState::reset() {
     OV_VARIABLE_CALL_STATEMENT(_impl->Reset());
 }
 
+void VariableState::trim(size_t length) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->Trim(length));
+}
+
 std::string VariableState::get_name() const {
     OV_VARIABLE_CALL_STATEMENT(return _impl->GetName());
 }
@@ -109,7 +109,14 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& us
     if (isInput) {
         // ilavreno: the condition below is obsolete, but we need an exact list of precisions
         // which are supports by G-API preprocessing
-        if (foundInput->getPrecision() != userBlob->getTensorDesc().getPrecision()) {
+        auto userPrecision = userBlob->getTensorDesc().getPrecision();
+        // a compound blob of per-batch images has no own tensor desc, the images are checked instead
+        if (compoundBlobPassed && userPrecision == Precision::UNSPECIFIED) {
+            const auto images = userBlob->as<CompoundBlob>();
+            if (images->size() != 0 && images->getBlob(0))
+                userPrecision = images->getBlob(0)->getTensorDesc().getPrecision();
+        }
+        if (foundInput->getPrecision() != userPrecision) {
             IE_THROW(ParameterMismatch)
                 << "Failed to set Blob with precision not corresponding to user input precision";
         }
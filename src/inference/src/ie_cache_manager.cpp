@@ -0,0 +1,318 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#    include <sys/utime.h>
+#else
+#    include <utime.h>
+#endif
+
+#include "ie_common.h"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+constexpr char kBlobMagic[8] = {'I', 'E', 'C', 'A', 'C', 'H', 'E', '1'};
+constexpr char kBlobExt[] = ".blob";
+constexpr char kTmpExt[] = ".tmp";
+// temporary files older than this are leftovers of the crashed writers
+constexpr std::time_t kStaleTmpFileAge = 60 * 60;
+
+struct BlobHeader {
+    char magic[sizeof(kBlobMagic)];
+    uint64_t payloadSize;
+    uint64_t checksum;
+};
+
+/**
+ * @brief Streaming 64-bit checksum, processes the data in 32-byte blocks using 4 independent lanes
+ */
+class Checksum {
+public:
+    void update(const char* data, size_t size) {
+        m_size += size;
+        if (m_tailSize != 0) {
+            const auto n = std::min(size, kBlockSize - m_tailSize);
+            std::memcpy(m_tail + m_tailSize, data, n);
+            m_tailSize += n;
+            data += n;
+            size -= n;
+            if (m_tailSize < kBlockSize)
+                return;
+            processBlock(m_tail);
+            m_tailSize = 0;
+        }
+        for (; size >= kBlockSize; data += kBlockSize, size -= kBlockSize) {
+            processBlock(data);
+        }
+        std::memcpy(m_tail, data, size);
+        m_tailSize = size;
+    }
+
+    uint64_t value() const {
+        uint64_t h = kOffset;
+        for (auto lane : m_lanes) {
+            h = mix(h, lane);
+        }
+        for (size_t i = 0; i < m_tailSize; ++i) {
+            h = mix(h, static_cast<unsigned char>(m_tail[i]));
+        }
+        return mix(h, m_size);
+    }
+
+private:
+    static constexpr size_t kBlockSize = 32;
+    static constexpr uint64_t kOffset = 14695981039346656037ULL;
+    static constexpr uint64_t kPrime = 1099511628211ULL;
+
+    static uint64_t mix(uint64_t h, uint64_t v) {
+        h = (h ^ v) * kPrime;
+        return (h << 31) | (h >> 33);
+    }
+
+    void processBlock(const char* block) {
+        for (size_t i = 0; i < 4; ++i) {
+            uint64_t word;
+            std::memcpy(&word, block + i * sizeof(word), sizeof(word));
+            m_lanes[i] = mix(m_lanes[i], word);
+        }
+    }
+
+    uint64_t m_lanes[4] = {kOffset, kOffset + 1, kOffset + 2, kOffset + 3};
+    char m_tail[kBlockSize] = {};
+    size_t m_tailSize = 0;
+    uint64_t m_size = 0;
+};
+
+uint64_t computeChecksum(std::istream& stream, uint64_t size) {
+    Checksum checksum;
+    std::vector<char> buffer(1 << 20);
+    while (size > 0 && stream) {
+        const auto n = static_cast<size_t>(std::min<uint64_t>(size, buffer.size()));
+        stream.read(buffer.data(), static_cast<std::streamsize>(n));
+        const auto read = static_cast<size_t>(stream.gcount());
+        checksum.update(buffer.data(), read);
+        size -= read;
+    }
+    return checksum.value();
+}
+
+bool isValidHeader(const BlobHeader& header, uint64_t fileSize) {
+    return std::memcmp(header.magic, kBlobMagic, sizeof(kBlobMagic)) == 0 &&
+           fileSize == sizeof(BlobHeader) + header.payloadSize;
+}
+
+/**
+ * @brief Read-only stream buffer over the memory mapped blob, the stream positions match the file offsets
+ */
+class MemoryStreamBuf : public std::streambuf {
+public:
+    MemoryStreamBuf(const char* data, size_t size) {
+        auto begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        char* base = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+        char* pos = base + off;
+        if (pos < eback() || pos > egptr())
+            return pos_type(off_type(-1));
+        setg(eback(), pos, egptr());
+        return pos_type(pos - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+bool endsWith(const std::string& str, const std::string& suffix) {
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+std::string uniqueSuffix() {
+    static std::atomic<uint64_t> counter{0};
+    std::stringstream ss;
+    ss << std::hash<std::thread::id>()(std::this_thread::get_id()) << "_"
+       << std::chrono::steady_clock::now().time_since_epoch().count() << "_" << counter++;
+    return ss.str();
+}
+
+void touchFile(const std::string& fileName) {
+#ifdef _WIN32
+    _utime(fileName.c_str(), nullptr);
+#else
+    utime(fileName.c_str(), nullptr);
+#endif
+}
+
+}  // namespace
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    const auto tmpFileName = blobFileName + "." + uniqueSuffix() + kTmpExt;
+    try {
+        {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            // placeholder, the real header is written once the payload checksum is known
+            BlobHeader header = {};
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            writer(stream);
+            stream.flush();
+            if (!stream)
+                IE_THROW() << "Failed to write cache entry " << tmpFileName;
+        }
+        {
+            // writers may seek back and patch their own headers, so the checksum is computed on the final file
+            std::fstream stream(tmpFileName, std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+            stream.seekg(0, std::ios_base::end);
+            const auto fileSize = static_cast<uint64_t>(stream.tellg());
+            BlobHeader header = {};
+            std::memcpy(header.magic, kBlobMagic, sizeof(kBlobMagic));
+            header.payloadSize = fileSize - sizeof(header);
+            stream.seekg(sizeof(header));
+            header.checksum = computeChecksum(stream, header.payloadSize);
+            stream.clear();
+            stream.seekp(0);
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.flush();
+            if (!stream)
+                IE_THROW() << "Failed to write cache entry " << tmpFileName;
+        }
+#ifdef _WIN32
+        // rename does not replace an existing file on Windows
+        std::remove(blobFileName.c_str());
+#endif
+        if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0)
+            IE_THROW() << "Failed to rename " << tmpFileName << " to " << blobFileName;
+    } catch (...) {
+        std::remove(tmpFileName.c_str());
+        throw;
+    }
+
+    if (m_sizeLimit != 0) {
+        try {
+            evictEntries(id + kBlobExt);
+        } catch (...) {
+            // the entry is already stored, failed eviction is retried on the next write
+        }
+    }
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    if (!FileUtils::fileExist(blobFileName))
+        return;
+    // the access time is often not tracked by file systems (noatime), so the modification time is the LRU key
+    touchFile(blobFileName);
+
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    if (m_useMmap) {
+        try {
+            mapped = ov::util::load_mmap_object(blobFileName);
+        } catch (const std::runtime_error&) {
+            // fall back to the file stream
+        }
+    }
+
+    if (mapped) {
+        BlobHeader header = {};
+        bool valid = mapped->size() >= sizeof(header);
+        if (valid) {
+            std::memcpy(&header, mapped->data(), sizeof(header));
+            valid = isValidHeader(header, mapped->size());
+        }
+        if (valid) {
+            Checksum checksum;
+            checksum.update(mapped->data() + sizeof(header), header.payloadSize);
+            valid = checksum.value() == header.checksum;
+        }
+        if (!valid) {
+            mapped.reset();
+            std::remove(blobFileName.c_str());
+            return;
+        }
+        MemoryStreamBuf buffer(mapped->data(), mapped->size());
+        std::istream stream(&buffer);
+        stream.seekg(sizeof(header));
+        reader(stream);
+        return;
+    }
+
+    std::ifstream stream(blobFileName, std::ios_base::binary);
+    stream.seekg(0, std::ios_base::end);
+    const auto fileSize = static_cast<uint64_t>(stream.tellg());
+    stream.seekg(0);
+    BlobHeader header = {};
+    bool valid = fileSize >= sizeof(header) && stream.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+                 isValidHeader(header, fileSize) && computeChecksum(stream, header.payloadSize) == header.checksum;
+    if (!valid) {
+        stream.close();
+        std::remove(blobFileName.c_str());
+        return;
+    }
+    stream.clear();
+    stream.seekg(sizeof(header));
+    reader(stream);
+}
+
+void FileStorageCacheManager::evictEntries(const std::string& keepFile) {
+    struct Entry {
+        std::string path;
+        uint64_t size;
+        std::time_t time;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    const auto now = std::time(nullptr);
+    ov::util::iterate_files(m_cachePath, [&](const std::string& file, bool isDir) {
+        struct stat st = {};
+        if (isDir || stat(file.c_str(), &st) != 0)
+            return;
+        if (endsWith(file, kBlobExt)) {
+            entries.push_back({file, static_cast<uint64_t>(st.st_size), st.st_mtime});
+            totalSize += static_cast<uint64_t>(st.st_size);
+        } else if (endsWith(file, kTmpExt) && now - st.st_mtime > kStaleTmpFileAge) {
+            std::remove(file.c_str());
+        }
+    });
+    if (totalSize <= m_sizeLimit)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.time < b.time;
+    });
+    for (const auto& entry : entries) {
+        if (totalSize <= m_sizeLimit)
+            break;
+        if (endsWith(entry.path, keepFile))
+            continue;
+        // may fail if the entry is in use by another process, it is evicted later then
+        if (std::remove(entry.path.c_str()) == 0)
+            totalSize -= entry.size;
+    }
+}
+
+}  // namespace InferenceEngine
@@ -76,21 +76,35 @@ public:
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * Every entry is written to a temporary file first and then renamed, so a crash in the middle of the export
+ * never leaves a truncated blob. Each blob starts with a small header with the payload size and checksum,
+ * entries with a wrong checksum are removed on read. If the size limit is set, the least recently used
+ * entries are evicted after every write.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    size_t m_sizeLimit;
+    bool m_useMmap;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    void evictEntries(const std::string& keepFile);
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Path to the cache directory
+     * @param sizeLimit Maximum total size of the cached blobs in bytes, 0 means no limit
+     * @param useMmap Read the cached blobs via memory mapping rather than a file stream
      */
-    FileStorageCacheManager(std::string&& cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string&& cachePath, size_t sizeLimit = 0, bool useMmap = false)
+        : m_cachePath(std::move(cachePath)),
+          m_sizeLimit(sizeLimit),
+          m_useMmap(useMmap) {}
 
     /**
      * @brief Destructor
@@ -99,18 +113,9 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
 
     void removeCacheEntry(const std::string& id) override {
         auto blobFileName = getBlobFile(id);
@@ -6,6 +6,9 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <cctype>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -27,6 +30,7 @@
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_remote_context.hpp"
+#include "ie_warm_start_executable_network.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/opsets/opset.hpp"
@@ -123,18 +127,71 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            bool cacheChanged = false;
+
+            auto it = config.find(CONFIG_KEY(CACHE_SIZE_LIMIT));
+            if (it != config.end()) {
+                // std::stoull accepts a sign and leading spaces and wraps negative values around
+                const auto& value = it->second;
+                bool valid = !value.empty() && std::all_of(value.begin(), value.end(), [](char c) {
+                    return std::isdigit(static_cast<unsigned char>(c)) != 0;
+                });
+                unsigned long long limit = 0;
+                if (valid) {
+                    try {
+                        limit = std::stoull(value);
+                    } catch (const std::out_of_range&) {
+                        valid = false;
+                    }
+                }
+                if (!valid || limit > std::numeric_limits<size_t>::max()) {
+                    IE_THROW() << "Wrong value " << it->second << " for property key " << it->first
+                               << ". Expected unsigned integer value";
+                }
+                _cacheSizeLimit = static_cast<size_t>(limit);
+                config.erase(it);
+                cacheChanged = true;
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_MMAP));
+            if (it != config.end()) {
+                if (it->second != CONFIG_VALUE(YES) && it->second != CONFIG_VALUE(NO)) {
+                    IE_THROW() << "Wrong value " << it->second << " for property key " << it->first
+                               << ". Expected only YES/NO";
+                }
+                _cacheUseMmap = it->second == CONFIG_VALUE(YES);
+                config.erase(it);
+                cacheChanged = true;
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_WARM_START));
+            if (it != config.end()) {
+                if (it->second != CONFIG_VALUE(YES) && it->second != CONFIG_VALUE(NO)) {
+                    IE_THROW() << "Wrong value " << it->second << " for property key " << it->first
+                               << ". Expected only YES/NO";
+                }
+                _warmStart = it->second == CONFIG_VALUE(YES);
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
-                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-                _cacheConfig._cacheDir = it->second;
                 if (!it->second.empty()) {
                     FileUtils::createDirectoryRecursive(it->second);
-                    _cacheConfig._cacheManager = std::make_shared<ie::FileStorageCacheManager>(std::move(it->second));
+                }
+                _cacheConfig._cacheDir = it->second;
+                config.erase(it);
+                cacheChanged = true;
+            }
+
+            if (cacheChanged) {
+                if (!_cacheConfig._cacheDir.empty()) {
+                    _cacheConfig._cacheManager = std::make_shared<ie::FileStorageCacheManager>(
+                        std::string(_cacheConfig._cacheDir), _cacheSizeLimit, _cacheUseMmap);
                 } else {
                     _cacheConfig._cacheManager = nullptr;
                 }
-
-                config.erase(it);
             }
         }
 
@@ -144,9 +201,17 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig;
         }
 
+        bool isWarmStartEnabled() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _warmStart;
+        }
+
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        size_t _cacheSizeLimit = 0;
+        bool _cacheUseMmap = false;
+        bool _warmStart = false;
     };
 
     // Core settings (cache config, etc)
@@ -528,6 +593,71 @@ public:
         return {{res._so}, res._ptr};
     }
 
+    /**
+     * @brief Loads the network as LoadNetwork does, but if warm start is enabled and the network for the device
+     * is not cached, returns the network compiled for CPU which is replaced by the network for the device once its
+     * background compilation is finished.
+     * @note Called for the user requests only, so the plugins loading sub-networks via ICore are not affected
+     */
+    ie::SoExecutableNetworkInternal LoadNetworkWithWarmStart(const ie::CNNNetwork& network,
+                                                             const std::string& deviceName,
+                                                             const std::map<std::string, std::string>& config) {
+        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        if (!coreConfig.isWarmStartEnabled() || !IsWarmStartApplicable(network, parsed._deviceName, config)) {
+            return LoadNetwork(network, deviceName, config);
+        }
+        OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::LoadNetwork::WarmStart");
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
+        if (cacheManager && DeviceSupportsImportExport(plugin)) {
+            auto hash = CalculateNetworkHash(network, parsed._deviceName, plugin, parsed._config);
+            bool loadedFromCache = false;
+            auto lock = cacheGuard.getHashLock(hash);
+            auto res = LoadNetworkFromCache(cacheManager, hash, plugin, parsed._config, nullptr, loadedFromCache);
+            if (loadedFromCache) {
+                return {{res._so}, res._ptr};
+            }
+        }
+
+        // the keys the CPU plugin understands are passed on, the hint makes the warm network quick to compile
+        std::map<std::string, std::string> warmConfig;
+        std::vector<std::string> cpuConfigKeys = GetMetric("CPU", METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        for (auto&& item : parsed._config) {
+            if (std::find(cpuConfigKeys.begin(), cpuConfigKeys.end(), item.first) != cpuConfigKeys.end()) {
+                warmConfig.insert(item);
+            }
+        }
+        warmConfig[CONFIG_KEY(PERFORMANCE_HINT)] = CONFIG_VALUE(LATENCY);
+        auto warmNetwork = LoadNetwork(network, "CPU", warmConfig);
+        // the user may modify the network while it is compiled in background
+        auto clonedNetwork = ie::details::cloneNetwork(network);
+        auto self = shared_from_this();
+        auto execNetwork = std::make_shared<ie::WarmStartExecutableNetwork>(
+            warmNetwork,
+            [self, clonedNetwork, deviceName, config]() {
+                return self->LoadNetwork(clonedNetwork, deviceName, config);
+            });
+        return {{}, execNetwork};
+    }
+
+    bool IsWarmStartApplicable(const ie::CNNNetwork& network,
+                               const std::string& deviceName,
+                               const std::map<std::string, std::string>& config) const {
+        // virtual devices manage the devices by themselves
+        if (deviceName == "CPU" || deviceName == "HETERO" || deviceName == "MULTI" || deviceName == "AUTO")
+            return false;
+        if (config.count(CONFIG_KEY_INTERNAL(FORCE_DISABLE_CACHE)) > 0)
+            return false;
+        // the warm start is a mode of the model cache, without CACHE_DIR every load would compile twice
+        if (!coreConfig.getCacheConfig()._cacheManager)
+            return false;
+        // variable states can't be passed from the warm network to the compiled one
+        if (!network.getFunction() || !network.getFunction()->get_sinks().empty())
+            return false;
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        return pluginRegistry.find("CPU") != pluginRegistry.end();
+    }
+
     ie::SoExecutableNetworkInternal LoadNetwork(const std::string& modelPath,
                                                 const std::string& deviceName,
                                                 const std::map<std::string, std::string>& config) override {
@@ -1165,7 +1295,7 @@ CNNNetwork Core::ReadNetwork(const std::string& model, const Blob::CPtr& weights
 ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network,
                                     const std::string& deviceName,
                                     const std::map<std::string, std::string>& config) {
-    auto exec = _impl->LoadNetwork(network, deviceName, config);
+    auto exec = _impl->LoadNetworkWithWarmStart(network, deviceName, config);
     return {exec._so, exec._ptr};
 }
 
@@ -1445,7 +1575,7 @@ ExecutableNetwork Core::compile_model(const std::shared_ptr<const ov::Model>& mo
                                       const std::string& deviceName,
                                       const ConfigMap& config) {
     OV_CORE_CALL_STATEMENT({
-        auto exec = _impl->LoadNetwork(toCNN(model), deviceName, config);
+        auto exec = _impl->LoadNetworkWithWarmStart(toCNN(model), deviceName, config);
         return {exec._so, exec._ptr};
     });
 }
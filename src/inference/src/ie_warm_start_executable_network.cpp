@@ -0,0 +1,199 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_warm_start_executable_network.hpp"
+
+#include <exception>
+#include <utility>
+
+#include "ie_itt.hpp"
+#include "threading/ie_executor_manager.hpp"
+
+namespace InferenceEngine {
+
+WarmStartExecutableNetwork::WarmStartExecutableNetwork(const SoExecutableNetworkInternal& warmNetwork,
+                                                       const CompileFunction& compile)
+    : _state(std::make_shared<State>()) {
+    _state->network = warmNetwork;
+    setInputs(warmNetwork->getInputs());
+    setOutputs(warmNetwork->getOutputs());
+
+    // the executor is kept by the executor manager, so it outlives the task if the network is released
+    _executor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+        IStreamsExecutor::Config{"WarmStartAsyncLoad", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
+    auto promise = std::make_shared<std::promise<void>>();
+    _compileTask = promise->get_future().share();
+    auto state = _state;
+    _executor->run([state, compile, promise]() {
+        OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "WarmStartExecutableNetwork::BackgroundCompile");
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->released) {
+                promise->set_value();
+                return;
+            }
+        }
+        try {
+            auto network = compile();
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (!state->released) {
+                state->network = network;
+                state->generation++;
+            }
+            promise->set_value();
+        } catch (...) {
+            // the warm network keeps serving the requests
+            promise->set_exception(std::current_exception());
+        }
+    });
+}
+
+WarmStartExecutableNetwork::~WarmStartExecutableNetwork() {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    _state->released = true;
+}
+
+SoExecutableNetworkInternal WarmStartExecutableNetwork::GetCurrentNetwork(size_t& generation) const {
+    std::lock_guard<std::mutex> lock(_state->mutex);
+    generation = _state->generation;
+    return _state->network;
+}
+
+SoExecutableNetworkInternal WarmStartExecutableNetwork::GetCurrentNetwork() const {
+    size_t generation = 0;
+    return GetCurrentNetwork(generation);
+}
+
+SoExecutableNetworkInternal WarmStartExecutableNetwork::GetTargetNetwork() const {
+    // if the compilation fails, the warm network stays the final one
+    _compileTask.wait();
+    return GetCurrentNetwork();
+}
+
+std::shared_ptr<IInferRequestInternal> WarmStartExecutableNetwork::CreateInferRequest() {
+    auto request = std::make_shared<WarmStartInferRequest>(
+        std::static_pointer_cast<WarmStartExecutableNetwork>(shared_from_this()));
+    request->setPointerToExecutableNetworkInternal(shared_from_this());
+    return request;
+}
+
+ConstInputsDataMap WarmStartExecutableNetwork::GetInputsInfo() const {
+    return GetCurrentNetwork()->GetInputsInfo();
+}
+
+ConstOutputsDataMap WarmStartExecutableNetwork::GetOutputsInfo() const {
+    return GetCurrentNetwork()->GetOutputsInfo();
+}
+
+void WarmStartExecutableNetwork::Export(std::ostream& networkModel) {
+    // the warm network may be compiled for another device, only the compiled network can be exported
+    _compileTask.get();
+    GetCurrentNetwork()->Export(networkModel);
+}
+
+std::shared_ptr<ngraph::Function> WarmStartExecutableNetwork::GetExecGraphInfo() {
+    return GetCurrentNetwork()->GetExecGraphInfo();
+}
+
+void WarmStartExecutableNetwork::SetConfig(const std::map<std::string, Parameter>& config) {
+    GetTargetNetwork()->SetConfig(config);
+}
+
+Parameter WarmStartExecutableNetwork::GetConfig(const std::string& name) const {
+    return GetTargetNetwork()->GetConfig(name);
+}
+
+Parameter WarmStartExecutableNetwork::GetMetric(const std::string& name) const {
+    return GetTargetNetwork()->GetMetric(name);
+}
+
+std::shared_ptr<RemoteContext> WarmStartExecutableNetwork::GetContext() const {
+    return GetTargetNetwork()->GetContext();
+}
+
+//////////////////////////////////////////////////
+
+WarmStartInferRequest::WarmStartInferRequest(const WarmStartExecutableNetwork::Ptr& network) : _network(network) {
+    _parameters = network->getInputs();
+    _results = network->getOutputs();
+    auto current = _network->GetCurrentNetwork(_generation);
+    _request = {current._so, current->CreateInferRequest()};
+}
+
+void WarmStartInferRequest::UpdateRequest() {
+    size_t generation = 0;
+    auto current = _network->GetCurrentNetwork(generation);
+    if (generation == _generation)
+        return;
+
+    SoIInferRequestInternal request = {current._so, current->CreateInferRequest()};
+    for (const auto& input : current->GetInputsInfo()) {
+        request->SetBlob(input.first, _request->GetBlob(input.first));
+    }
+    for (const auto& output : current->GetOutputsInfo()) {
+        request->SetBlob(output.first, _request->GetBlob(output.first));
+    }
+    if (m_curBatch > 0) {
+        request->SetBatch(m_curBatch);
+    }
+    if (_callback) {
+        request->SetCallback(_callback);
+    }
+    _request = request;
+    _generation = generation;
+}
+
+void WarmStartInferRequest::Infer() {
+    UpdateRequest();
+    _request->Infer();
+}
+
+void WarmStartInferRequest::Cancel() {
+    _request->Cancel();
+}
+
+std::map<std::string, InferenceEngineProfileInfo> WarmStartInferRequest::GetPerformanceCounts() const {
+    return _request->GetPerformanceCounts();
+}
+
+void WarmStartInferRequest::SetBlob(const std::string& name, const Blob::Ptr& data) {
+    _request->SetBlob(name, data);
+}
+
+Blob::Ptr WarmStartInferRequest::GetBlob(const std::string& name) {
+    return _request->GetBlob(name);
+}
+
+void WarmStartInferRequest::SetBlob(const std::string& name, const Blob::Ptr& data, const PreProcessInfo& info) {
+    _request->SetBlob(name, data, info);
+}
+
+const PreProcessInfo& WarmStartInferRequest::GetPreProcess(const std::string& name) const {
+    return _request->GetPreProcess(name);
+}
+
+void WarmStartInferRequest::SetBatch(int batch) {
+    _request->SetBatch(batch);
+    m_curBatch = batch;
+}
+
+std::vector<std::shared_ptr<IVariableStateInternal>> WarmStartInferRequest::QueryState() {
+    return _request->QueryState();
+}
+
+void WarmStartInferRequest::StartAsync() {
+    UpdateRequest();
+    _request->StartAsync();
+}
+
+StatusCode WarmStartInferRequest::Wait(int64_t millis_timeout) {
+    return _request->Wait(millis_timeout);
+}
+
+void WarmStartInferRequest::SetCallback(Callback callback) {
+    _callback = callback;
+    _request->SetCallback(std::move(callback));
+}
+
+}  // namespace InferenceEngine
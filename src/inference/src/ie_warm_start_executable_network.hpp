@@ -0,0 +1,118 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+/**
+ * @brief This is a header file for the executable network which serves requests with a quickly compiled network
+ * while the network for the requested device is compiled in background
+ *
+ * @file ie_warm_start_executable_network.hpp
+ */
+
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
+#include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
+#include "threading/ie_istreams_executor.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Executable network which starts with a warm network (e.g. compiled for CPU) and hot-swaps it with the
+ * network compiled for the requested device once the background compilation finishes.
+ * If the background compilation fails, the warm network keeps serving the requests.
+ * The configuration keys, the metrics and the context belong to the device the network is compiled for, so
+ * SetConfig, GetConfig, GetMetric and GetContext wait for the background compilation, as Export does.
+ */
+class WarmStartExecutableNetwork : public IExecutableNetworkInternal {
+public:
+    using Ptr = std::shared_ptr<WarmStartExecutableNetwork>;
+    using CompileFunction = std::function<SoExecutableNetworkInternal()>;
+
+    /**
+     * @brief Constructs the network and starts the background compilation
+     * @param warmNetwork The network used until the compiled one is ready
+     * @param compile The function compiling the network for the requested device
+     */
+    WarmStartExecutableNetwork(const SoExecutableNetworkInternal& warmNetwork, const CompileFunction& compile);
+
+    /**
+     * @brief Doesn't wait for the background compilation: the compilation is skipped if it hasn't started yet,
+     * otherwise its result is dropped
+     */
+    ~WarmStartExecutableNetwork();
+
+    /**
+     * @brief Returns the network which serves the requests at the moment
+     * @param generation Incremented each time the network is replaced
+     * @return The current network
+     */
+    SoExecutableNetworkInternal GetCurrentNetwork(size_t& generation) const;
+
+    std::shared_ptr<IInferRequestInternal> CreateInferRequest() override;
+    ConstInputsDataMap GetInputsInfo() const override;
+    ConstOutputsDataMap GetOutputsInfo() const override;
+    void Export(std::ostream& networkModel) override;
+    std::shared_ptr<ngraph::Function> GetExecGraphInfo() override;
+    void SetConfig(const std::map<std::string, Parameter>& config) override;
+    Parameter GetConfig(const std::string& name) const override;
+    Parameter GetMetric(const std::string& name) const override;
+    std::shared_ptr<RemoteContext> GetContext() const override;
+
+private:
+    SoExecutableNetworkInternal GetCurrentNetwork() const;
+    // waits for the background compilation and returns the network which serves the requests from then on
+    SoExecutableNetworkInternal GetTargetNetwork() const;
+
+    // shared with the background compilation, which may outlive the network
+    struct State {
+        std::mutex mutex;
+        SoExecutableNetworkInternal network;
+        size_t generation = 0;
+        bool released = false;
+    };
+
+    std::shared_ptr<State> _state;
+    std::shared_future<void> _compileTask;
+    IStreamsExecutor::Ptr _executor;
+};
+
+/**
+ * @brief Infer request of the WarmStartExecutableNetwork. Forwards the calls to the request of the current network,
+ * switches to the request of the new network on the next inference after the network is replaced.
+ * The input and output blobs are passed to the new request, so the blobs obtained by the user stay valid.
+ */
+class WarmStartInferRequest : public IInferRequestInternal {
+public:
+    explicit WarmStartInferRequest(const WarmStartExecutableNetwork::Ptr& network);
+
+    void Infer() override;
+    void Cancel() override;
+    std::map<std::string, InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void SetBlob(const std::string& name, const Blob::Ptr& data) override;
+    Blob::Ptr GetBlob(const std::string& name) override;
+    void SetBlob(const std::string& name, const Blob::Ptr& data, const PreProcessInfo& info) override;
+    const PreProcessInfo& GetPreProcess(const std::string& name) const override;
+    void SetBatch(int batch) override;
+    std::vector<std::shared_ptr<IVariableStateInternal>> QueryState() override;
+    void StartAsync() override;
+    StatusCode Wait(int64_t millis_timeout) override;
+    void SetCallback(Callback callback) override;
+
+private:
+    void UpdateRequest();
+
+    WarmStartExecutableNetwork::Ptr _network;
+    SoIInferRequestInternal _request;
+    size_t _generation = 0;
+};
+
+}  // namespace InferenceEngine
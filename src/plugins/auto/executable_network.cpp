@@ -10,6 +10,9 @@
 #include <utility>
 #include <map>
 #include <unordered_map>
+#include <algorithm>
+#include <chrono>
+#include <limits>
 
 #include "ie_icore.hpp"
 #include "ie_metric_helpers.hpp"
@@ -28,6 +31,9 @@ namespace MultiDevicePlugin {
 using namespace InferenceEngine;
 
 namespace {
+// weight of the latest sample in the moving average of the per-device latency
+constexpr double kLatencyAvgWeight = 0.1;
+
 std::string GetNetworkPrecision(const InferenceEngine::CNNNetwork &network) {
     auto nGraphFunc = network.getFunction();
     bool isINTModel = ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc);
@@ -85,6 +91,13 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto policy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy == _config.end()) {
+        _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY;
+    } else {
+        _minCompletionTimeScheduling =
+            policy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME;
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -118,12 +131,19 @@ void MultiDeviceExecutableNetwork::GenerateWorkers(const std::string& device, co
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
     idleWorkerRequests.set_capacity(numRequests);
+    {
+        std::lock_guard<std::mutex> lock(_latencyMutex);
+        _deviceLatencies[device]._numWorkers = static_cast<int>(numRequests);
+    }
     for (auto&& workerRequest : workerRequests) {
         workerRequest._inferRequest = { executableNetwork._so, executableNetwork->CreateInferRequest() };
         auto* workerRequestPtr = &workerRequest;
         IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
         workerRequest._inferRequest->SetCallback(
             [workerRequestPtr, this, device, idleWorkerRequestsPtr] (std::exception_ptr exceptionPtr) mutable {
+                // the stats are updated before the request returns to the idle list,
+                // see DeferToFasterDevice for the reason
+                UpdateLatencyStats(device, *workerRequestPtr);
                 IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
                 {
@@ -422,11 +442,15 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
             std::lock_guard<std::mutex> lock(_mutex);
             return _devicePriorities;
         }();
+        if (preferred_device.empty() && _minCompletionTimeScheduling &&
+            DeferToFasterDevice(inferPipelineTask, devices)) {
+            return;
+        }
     }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
-        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], device.deviceName)) {
             return;
         }
     }
@@ -440,14 +464,25 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
 
 bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
                                             NotBusyWorkerRequests& idleWorkerRequests,
-                                            const DeviceName& preferred_device) {
+                                            const DeviceName& device) {
   WorkerInferRequest *workerRequestPtr = nullptr;
   if (idleWorkerRequests.try_pop(workerRequestPtr)) {
       IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
       _thisWorkerInferRequest = workerRequestPtr;
+      workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+      // the request is counted before it is started, as its completion callback (UpdateLatencyStats) may run
+      // on another thread before the task returns
       {
+          std::lock_guard<std::mutex> lock(_latencyMutex);
+          _deviceLatencies[device]._inFlight++;
+      }
+      try {
           auto capturedTask = std::move(inferPipelineTask);
           capturedTask();
+      } catch (...) {
+          std::lock_guard<std::mutex> lock(_latencyMutex);
+          _deviceLatencies[device]._inFlight--;
+          throw;
       }
       idleGuard.Release();
       return true;
@@ -455,6 +490,54 @@ bool MultiDeviceExecutableNetwork::RunPipelineTask(Task& inferPipelineTask,
   return false;
 }
 
+bool MultiDeviceExecutableNetwork::DeferToFasterDevice(Task& inferPipelineTask, std::vector<DeviceInformation>& devices) {
+    // the expected completion time is the average latency for a device with an idle worker request,
+    // and for a busy device the wait for the next worker to become free (latency / number of workers) is added
+    std::vector<std::pair<double, DeviceInformation>> idleDevices;
+    double bestBusyTime = std::numeric_limits<double>::max();
+    std::lock_guard<std::mutex> lock(_latencyMutex);
+    for (auto&& device : devices) {
+        auto it = _deviceLatencies.find(device.deviceName);
+        if (it == _deviceLatencies.end())
+            continue;
+        const auto& stats = it->second;
+        if (stats._inFlight < stats._numWorkers) {
+            // the devices with no measurements yet go first, so every device gets its latency estimated
+            idleDevices.emplace_back(stats._avgLatency, device);
+        } else if (stats._avgLatency > 0.0) {
+            bestBusyTime = std::min(bestBusyTime, stats._avgLatency * (1.0 + 1.0 / stats._numWorkers));
+        }
+    }
+    if (idleDevices.empty())
+        return false;
+    std::stable_sort(idleDevices.begin(), idleDevices.end(),
+                     [](const std::pair<double, DeviceInformation>& a, const std::pair<double, DeviceInformation>& b) {
+                         return a.first < b.first;
+                     });
+    if (bestBusyTime < idleDevices.front().first) {
+        // a busy device is expected to complete the request earlier, so the task waits in the common queue.
+        // It is pushed under the lock, so the worker callback (which updates the stats under the same lock
+        // before returning to the idle list) is guaranteed to see and pop it
+        _inferPipelineTasks.push(std::move(inferPipelineTask));
+        return true;
+    }
+    devices.clear();
+    for (auto&& idleDevice : idleDevices) {
+        devices.push_back(std::move(idleDevice.second));
+    }
+    return false;
+}
+
+void MultiDeviceExecutableNetwork::UpdateLatencyStats(const DeviceName& device, const WorkerInferRequest& workerRequest) {
+    const double latency =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - workerRequest._startTime).count();
+    std::lock_guard<std::mutex> lock(_latencyMutex);
+    auto& stats = _deviceLatencies[device];
+    stats._inFlight--;
+    stats._avgLatency = (stats._avgLatency == 0.0) ? latency
+                                                   : stats._avgLatency + kLatencyAvgWeight * (latency - stats._avgLatency);
+}
+
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
     ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName);
 }
@@ -588,13 +671,32 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
         IE_THROW(NotImplemented);
     }
 
+    for (auto&& kvp : config) {
+        if (kvp.first != MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES &&
+            kvp.first != MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY) {
+            IE_THROW() << "The only configs supported for the Network's SetConfig are "
+                       << "MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES and "
+                       << "MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY";
+        }
+    }
+
+    auto policy = config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != config.end()) {
+        const auto value = policy->second.as<std::string>();
+        if (value != MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY &&
+            value != MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME) {
+            IE_THROW() << "Unsupported config value: " << value << " for key: " << policy->first;
+        }
+        _minCompletionTimeScheduling = value == MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME;
+        std::lock_guard<std::mutex> lock{_confMutex};
+        _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = value;
+    }
+
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
-    if (priorities == config.end() || config.size() > 1) {
-        IE_THROW() << "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
-    } else {
+    if (priorities != config.end()) {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
-        auto metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
+        auto metaDevices = MultiDeviceInferencePlugin::GetWorkerDevices(multiPlugin->ParseMetaDevices(priorities->second, {}));
 
         if (std::any_of(metaDevices.begin(), metaDevices.end(), [](const DeviceInformation& kvp) {
                 return kvp.numRequestsPerDevices != -1;
@@ -691,7 +793,8 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(SUPPORTED_CONFIG_KEYS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
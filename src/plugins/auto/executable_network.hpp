@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -141,6 +142,13 @@ public:
         InferenceEngine::SoIInferRequestInternal  _inferRequest;
         InferenceEngine::Task                     _task;
         std::exception_ptr                        _exceptionPtr = nullptr;
+        std::chrono::steady_clock::time_point     _startTime;
+    };
+    // per-device statistics for the MULTI_MIN_COMPLETION_TIME scheduling policy
+    struct DeviceLatencyStats {
+        double  _avgLatency = 0.0;  // moving average of the request latency (microseconds), 0 until first completion
+        int     _inFlight = 0;
+        int     _numWorkers = 0;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
@@ -186,14 +194,19 @@ public:
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
+    std::atomic<bool>                                           _minCompletionTimeScheduling = {false};
+    mutable std::mutex                                          _latencyMutex;
+    DeviceMap<DeviceLatencyStats>                               _deviceLatencies;
 
 private:
     void GenerateWorkers(const std::string& device, const InferenceEngine::SoExecutableNetworkInternal& executableNetwork);
     void WaitActualNetworkReady() const;
     void WaitFirstNetworkReady();
-    static bool RunPipelineTask(InferenceEngine::Task& inferPipelineTask,
-                                NotBusyWorkerRequests& idleWorkerRequests,
-                                const DeviceName& preferred_device);
+    bool DeferToFasterDevice(InferenceEngine::Task& inferPipelineTask, std::vector<DeviceInformation>& devices);
+    void UpdateLatencyStats(const DeviceName& device, const WorkerInferRequest& workerRequest);
+    bool RunPipelineTask(InferenceEngine::Task& inferPipelineTask,
+                         NotBusyWorkerRequests& idleWorkerRequests,
+                         const DeviceName& device);
     void TryToLoadNetWork(AutoLoadContext& context,
                           const std::string& modelPath,
                           const InferenceEngine::CNNNetwork& network);
@@ -57,6 +57,7 @@ namespace {
     std::vector<std::string> supported_configKeys = []() -> decltype(PerfHintsConfig::SupportedKeys()) {
                     auto res = PerfHintsConfig::SupportedKeys();
                     res.push_back(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
+                    res.push_back(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
                     res.push_back(CONFIG_KEY_INTERNAL(MULTI_WORK_MODE_AS_AUTO));
                     res.push_back(PluginConfigParams::KEY_PERF_COUNT);
                     res.push_back(PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS);
@@ -147,6 +148,17 @@ std::vector<DeviceInformation> MultiDeviceInferencePlugin::ParseMetaDevices(cons
     return metaDevices;
 }
 
+std::vector<DeviceInformation> MultiDeviceInferencePlugin::GetWorkerDevices(std::vector<DeviceInformation> metaDevices) {
+    std::map<DeviceName, int> repetitions;
+    for (auto&& device : metaDevices) {
+        const auto repetition = repetitions[device.deviceName]++;
+        if (repetition > 0) {
+            device.deviceName += "_" + std::to_string(repetition);
+        }
+    }
+    return metaDevices;
+}
+
 InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::string& name,
         const std::map<std::string, InferenceEngine::Parameter> & options) const {
     if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
@@ -278,15 +290,25 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         metaDevices = ParseMetaDevices(priorities->second, fullConfig);
         multiNetworkConfig.insert(*priorities);
     }
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != fullConfig.end()) {
+        if (policy->second != MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY &&
+            policy->second != MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME) {
+            IE_THROW() << "Unsupported config value: " << policy->second << " for key: " << policy->first;
+        }
+        multiNetworkConfig.insert(*policy);
+    }
 
+    // the networks are loaded to the actual devices, but stored under the worker names
+    const auto workerDevices = GetWorkerDevices(metaDevices);
     DeviceMap<SoExecutableNetworkInternal> executableNetworkPerDevice;
     std::mutex load_mutex;
     std::vector<Task> loads;
     std::once_flag readNetworkFlag;
-    for (auto& p : metaDevices) {
-        loads.push_back([&]() {
-            const auto &deviceName = p.deviceName;
-            const auto &deviceConfig = p.config;
+    for (size_t i = 0; i < metaDevices.size(); i++) {
+        loads.push_back([&, i]() {
+            const auto &deviceName = metaDevices[i].deviceName;
+            const auto &deviceConfig = metaDevices[i].config;
             SoExecutableNetworkInternal exec_net;
             if (modelPath.empty()) {
                 exec_net = GetCore()->LoadNetwork(network, deviceName, deviceConfig);
@@ -299,7 +321,7 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
                 exec_net = GetCore()->LoadNetwork(network, deviceName, deviceConfig);
             }
             std::unique_lock<std::mutex> lock{load_mutex};
-            executableNetworkPerDevice.insert({deviceName, exec_net});
+            executableNetworkPerDevice.insert({workerDevices[i].deviceName, exec_net});
             multiNetworkConfig.insert(deviceConfig.begin(), deviceConfig.end());
         });
     }
@@ -326,7 +348,7 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
     // MULTI can enable the perf counters only if all  devices support/enable that
     bool enablePerfCounters = num_plugins_supporting_perf_counters == executableNetworkPerDevice.size();
     auto impl = std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
-                                                               metaDevices,
+                                                               workerDevices,
                                                                multiNetworkConfig,
                                                                enablePerfCounters);
     if (!modelPath.empty()) {
@@ -545,6 +567,12 @@ void MultiDeviceInferencePlugin::CheckConfig(const std::map<std::string, std::st
                 IE_THROW() << "Unsupported config value: " << kvp.second
                            << " for key: " << kvp.first;
             }
+        } else if (kvp.first == MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY) {
+            if (kvp.second != MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY &&
+                kvp.second != MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME) {
+                IE_THROW() << "Unsupported config value: " << kvp.second
+                           << " for key: " << kvp.first;
+            }
         } else if (kvp.first == PluginConfigParams::KEY_LOG_LEVEL) {
                auto success = MultiDevicePlugin::setLogLevel(kvp.second);
                if (!success) {
@@ -45,6 +45,9 @@ public:
                                                                        const std::map<std::string, std::string> & config) const;
 
     std::string GetDeviceList(const std::map<std::string, std::string>& config) const;
+    // a device repeated in the MULTI priorities (e.g. MULTI:CPU,CPU) gets its own network and worker requests,
+    // so its repetitions are renamed to the unique worker names "<device>_<n>" (the first one keeps the device name)
+    static std::vector<DeviceInformation> GetWorkerDevices(std::vector<DeviceInformation> metaDevices);
     MOCKTESTMACRO DeviceInformation SelectDevice(const std::vector<DeviceInformation>& metaDevices, const std::string& networkPrecision = METRIC_VALUE(FP32));
 
 protected:
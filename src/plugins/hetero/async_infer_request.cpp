@@ -18,24 +18,44 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
+            RequestExecutor(SoIInferRequestInternal& inferRequest, const HeteroPipelineStage::Ptr& stage)
+                : _inferRequest(inferRequest),
+                  _stage(stage) {
                 _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
-                    _exceptionPtr = exceptionPtr;
-                    auto capturedTask = std::move(_task);
-                    capturedTask();
+                    OnDone(exceptionPtr);
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                if (_stage) {
+                    // wait in the stage queue if the device already runs enough requests of this subgraph
+                    _stage->Run([this] {
+                        try {
+                            _inferRequest->StartAsync();
+                        } catch (...) {
+                            OnDone(std::current_exception());
+                        }
+                    });
+                } else {
+                    _inferRequest->StartAsync();
+                }
             };
+            void OnDone(std::exception_ptr exceptionPtr) {
+                _exceptionPtr = exceptionPtr;
+                if (_stage) {
+                    _stage->Release();
+                }
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            }
             SoIInferRequestInternal& _inferRequest;
+            HeteroPipelineStage::Ptr _stage;
             std::exception_ptr _exceptionPtr;
             Task _task;
         };
 
-        auto requestExecutor =
-            std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
+        auto& subRequestDesc = _heteroInferRequest->_inferRequests[requestId];
+        auto requestExecutor = std::make_shared<RequestExecutor>(subRequestDesc._request, subRequestDesc._stage);
         _pipeline.emplace_back(requestExecutor, [requestExecutor] {
             if (nullptr != requestExecutor->_exceptionPtr) {
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
@@ -7,6 +7,7 @@
 #include "executable_network.hpp"
 #include "async_infer_request.hpp"
 #include "itt.hpp"
+#include "partitioning.hpp"
 #include "ie_precision.hpp"
 #include "openvino/core/dimension.hpp"
 #include "openvino/core/except.hpp"
@@ -90,11 +91,20 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
 
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
-        if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
-        } else {
+        if (it == _config.end()) {
             IE_THROW() << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
+        auto itCostModel = _config.find(HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING));
+        if (itCostModel != _config.end() && itCostModel->second == YES) {
+            AffinityCostModel costModel{_heteroPlugin->QueryNetworkPerDevice(network, _config)};
+            queryNetworkResult.supportedLayersMap = costModel.GetDefaultAffinities();
+            _partitionReport = costModel.Refine(clonedFunction, queryNetworkResult.supportedLayersMap);
+            if (dumpDotFile) {
+                std::ofstream{"hetero_partition_" + _name + ".txt"} << _partitionReport;
+            }
+        } else {
+            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+        }
     }
 
     using Input = ngraph::Input<ngraph::Node>;
@@ -488,6 +498,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                                                                  network._device,
                                                                  metaDevices[network._device]);
     }
+    InitPipelineStages();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
@@ -643,6 +654,20 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
     this->_config = importedConfigs;
     this->_networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitPipelineStages();
+}
+
+void HeteroExecutableNetwork::InitPipelineStages() {
+    auto itPipelining = _config.find(HETERO_CONFIG_KEY(PIPELINING));
+    if (itPipelining == _config.end() || itPipelining->second != YES) {
+        return;
+    }
+    // every subgraph is fed with as many requests as its device can process concurrently,
+    // so all stages are busy while requests flow from one subgraph to the next one
+    for (auto&& desc : _networks) {
+        auto optimalNumber = desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        _pipelineStages.emplace_back(std::make_shared<HeteroPipelineStage>(optimalNumber));
+    }
 }
 
 void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
@@ -783,7 +808,11 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
-        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index));
+        if (!_pipelineStages.empty()) {
+            desc._stage = _pipelineStages[index];
+        }
+        ++index;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap);
@@ -796,7 +825,11 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
     for (auto&& subnetwork : _networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
-        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index));
+        if (!_pipelineStages.empty()) {
+            desc._stage = _pipelineStages[index];
+        }
+        ++index;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
@@ -819,6 +852,10 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINING) || name == HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING)) {
+        // networks exported by previous versions do not have these keys
+        auto it = _config.find(name);
+        result = it != _config.end() && it->second == YES;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : _networks) {
@@ -877,7 +914,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroMetrics = {METRIC_KEY(NETWORK_NAME),
                                                   METRIC_KEY(SUPPORTED_METRICS),
                                                   METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                                                  METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)};
+                                                  METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+                                                  HETERO_METRIC_KEY(PARTITION_REPORT)};
 
         {
             std::vector<::Metrics> pluginMetrics;
@@ -898,6 +936,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (EXEC_NETWORK_METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINING),
+                                                     HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -918,11 +958,15 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, heteroConfigKeys);
     } else if (EXEC_NETWORK_METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
+    } else if (HETERO_METRIC_KEY(PARTITION_REPORT) == name) {
+        IE_SET_METRIC_RETURN(HETERO_PARTITION_REPORT, _partitionReport);
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            auto optimalNumber =
+                desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            // in pipelining mode each subgraph stage should have its own set of requests in flight
+            value = _pipelineStages.empty() ? std::max(value, optimalNumber) : value + optimalNumber;
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
@@ -65,6 +65,7 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    void InitPipelineStages();
 
     struct NetworkDesc {
         std::string _device;
@@ -73,10 +74,12 @@ private:
     };
 
     std::vector<NetworkDesc> _networks;
+    std::vector<HeteroPipelineStage::Ptr> _pipelineStages;
     Engine* _heteroPlugin;
     std::string _name;
     std::map<std::string, std::string> _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    std::string _partitionReport;
 };
 
 }  // namespace HeteroPlugin
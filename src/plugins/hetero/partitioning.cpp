@@ -0,0 +1,241 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "partitioning.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <ie_algorithm.hpp>
+#include <ngraph/op/util/op_types.hpp>
+#include <set>
+#include <sstream>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+// All costs are expressed in units of estimated work needed to compute one output element
+constexpr double kTransferCostPerByte = 1.0;
+// Fixed overhead of one more subgraph boundary: extra infer request, synchronization and blob management
+constexpr double kCutCost = 16384.0;
+// Devices listed later in TARGET_FALLBACK are assumed to be slower
+constexpr double kDevicePriorityPenalty = 0.5;
+constexpr std::size_t kMaxRefinementPasses = 16;
+
+bool IsMovable(const ngraph::Node* node) {
+    return !ngraph::op::is_parameter(node) && !ngraph::op::is_constant(node) && !ngraph::op::is_output(node);
+}
+
+double ElementsCount(const ngraph::PartialShape& shape) {
+    return shape.is_static() ? static_cast<double>(ngraph::shape_size(shape.to_shape())) : 1.0;
+}
+
+double EstimateWork(const ngraph::Node* node) {
+    double outputElements = 0;
+    for (auto&& output : node->outputs()) {
+        outputElements += ElementsCount(output.get_partial_shape());
+    }
+    // Operations with constant weights (convolutions, matrix multiplications, ...) accumulate
+    // a dot product for every output element
+    double macsPerOutput = 1;
+    for (auto&& input : node->inputs()) {
+        const auto& shape = input.get_partial_shape();
+        if (ngraph::op::is_constant(input.get_source_output().get_node()) && shape.is_static() && shape.size() >= 2 &&
+            shape[0].get_length() > 0) {
+            macsPerOutput = std::max(macsPerOutput, ElementsCount(shape) / shape[0].get_length());
+        }
+    }
+    return std::max(outputElements, 1.0) * macsPerOutput;
+}
+
+template <typename NodeType>
+double TransferBytes(const ngraph::Output<NodeType>& output) {
+    return ElementsCount(output.get_partial_shape()) * output.get_element_type().size();
+}
+
+}  // namespace
+
+AffinityCostModel::AffinityCostModel(const std::vector<std::pair<std::string, QueryNetworkResult>>& queryResults) {
+    for (auto&& queryResult : queryResults) {
+        _devices.push_back(queryResult.first);
+        auto& supportedLayers = _supportedLayers[queryResult.first];
+        for (auto&& layer : queryResult.second.supportedLayersMap) {
+            supportedLayers.insert(layer.first);
+        }
+    }
+}
+
+std::map<std::string, std::string> AffinityCostModel::GetDefaultAffinities() const {
+    std::map<std::string, std::string> affinities;
+    for (auto&& device : _devices) {
+        for (auto&& layer : _supportedLayers.at(device)) {
+            affinities.emplace(layer, device);
+        }
+    }
+    return affinities;
+}
+
+double AffinityCostModel::ComputeCost(const ngraph::Node* node, const std::string& device) const {
+    auto priority = std::distance(_devices.begin(), std::find(_devices.begin(), _devices.end(), device));
+    return EstimateWork(node) * (1.0 + priority * kDevicePriorityPenalty);
+}
+
+std::string AffinityCostModel::Refine(const std::shared_ptr<const ngraph::Function>& function,
+                                      std::map<std::string, std::string>& affinities) const {
+    auto orderedOps = function->get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, std::string> placement;
+    for (auto&& node : orderedOps) {
+        auto itAffinity = affinities.find(node->get_friendly_name());
+        if (IsMovable(node.get()) && itAffinity != affinities.end()) {
+            placement.emplace(node.get(), itAffinity->second);
+        }
+    }
+
+    // get_target_inputs() is ordered by pointers, so the consumers are sorted by their topological index
+    // to make the partitioning the same from run to run
+    std::unordered_map<const ngraph::Node*, std::size_t> topologicalIndex;
+    for (auto&& node : orderedOps) {
+        topologicalIndex.emplace(node.get(), topologicalIndex.size());
+    }
+    auto orderedConsumers = [&](const std::set<ngraph::Input<ngraph::Node>>& targets) {
+        std::vector<const ngraph::Node*> consumers;
+        for (auto&& target : targets) {
+            consumers.push_back(target.get_node());
+        }
+        std::sort(consumers.begin(), consumers.end(), [&](const ngraph::Node* lhs, const ngraph::Node* rhs) {
+            return topologicalIndex.at(lhs) < topologicalIndex.at(rhs);
+        });
+        return consumers;
+    };
+
+    auto isSupported = [&](const std::string& device, const std::string& layer) {
+        auto itDevice = _supportedLayers.find(device);
+        return itDevice != _supportedLayers.end() && itDevice->second.count(layer) != 0;
+    };
+
+    // Calls func for every data edge between node and other placed operations
+    using EdgeCallback = std::function<void(const ngraph::Node* /*neighbour*/, double /*bytes*/)>;
+    auto forEachPlacedEdge = [&](const ngraph::Node* node, const EdgeCallback& func) {
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            if (contains(placement, source.get_node())) {
+                func(source.get_node(), TransferBytes(source));
+            }
+        }
+        for (auto&& output : node->outputs()) {
+            for (auto&& consumer : orderedConsumers(output.get_target_inputs())) {
+                if (contains(placement, consumer)) {
+                    func(consumer, TransferBytes(output));
+                }
+            }
+        }
+    };
+
+    auto localCost = [&](const ngraph::Node* node, const std::string& device) {
+        double cost = ComputeCost(node, device);
+        forEachPlacedEdge(node, [&](const ngraph::Node* neighbour, double bytes) {
+            if (placement.at(neighbour) != device) {
+                cost += kCutCost + bytes * kTransferCostPerByte;
+            }
+        });
+        return cost;
+    };
+
+    // Each accepted move strictly decreases the total cost, so the refinement converges
+    std::size_t moved = 0;
+    for (std::size_t pass = 0; pass < kMaxRefinementPasses; ++pass) {
+        bool changed = false;
+        for (auto&& node : orderedOps) {
+            auto itPlacement = placement.find(node.get());
+            if (itPlacement == placement.end()) {
+                continue;
+            }
+            const auto& name = node->get_friendly_name();
+            std::vector<std::string> candidates;
+            forEachPlacedEdge(node.get(), [&](const ngraph::Node* neighbour, double) {
+                const auto& device = placement.at(neighbour);
+                if (device != itPlacement->second && isSupported(device, name) &&
+                    std::find(candidates.begin(), candidates.end(), device) == candidates.end()) {
+                    candidates.push_back(device);
+                }
+            });
+            auto bestDevice = itPlacement->second;
+            auto bestCost = localCost(node.get(), bestDevice);
+            for (auto&& candidate : candidates) {
+                auto cost = localCost(node.get(), candidate);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestDevice = candidate;
+                }
+            }
+            if (bestDevice != itPlacement->second) {
+                itPlacement->second = bestDevice;
+                affinities[name] = bestDevice;
+                ++moved;
+                changed = true;
+            }
+        }
+        if (!changed) {
+            break;
+        }
+    }
+
+    // Parameters and constants follow their first consumer and results follow their producer,
+    // otherwise a moved operation leaves them behind as extra cuts or constant-only subgraphs
+    for (auto&& node : orderedOps) {
+        if (IsMovable(node.get())) {
+            continue;
+        }
+        const ngraph::Node* neighbour = nullptr;
+        if (ngraph::op::is_output(node)) {
+            neighbour = node->get_input_node_ptr(0);
+        } else {
+            for (auto&& consumer : orderedConsumers(node->output(0).get_target_inputs())) {
+                if (contains(placement, consumer)) {
+                    neighbour = consumer;
+                    break;
+                }
+            }
+        }
+        auto itNeighbour = placement.find(neighbour);
+        if (itNeighbour == placement.end()) {
+            continue;
+        }
+        const auto& name = node->get_friendly_name();
+        auto itAffinity = affinities.find(name);
+        if (itAffinity == affinities.end() || isSupported(itNeighbour->second, name)) {
+            affinities[name] = itNeighbour->second;
+        }
+    }
+
+    std::map<std::string, std::pair<std::size_t, double>> deviceStats;
+    std::size_t cutEdges = 0;
+    double cutBytes = 0;
+    for (auto&& nodePlacement : placement) {
+        auto& stats = deviceStats[nodePlacement.second];
+        ++stats.first;
+        stats.second += ComputeCost(nodePlacement.first, nodePlacement.second);
+        for (auto&& output : nodePlacement.first->outputs()) {
+            for (auto&& target : output.get_target_inputs()) {
+                auto itTarget = placement.find(target.get_node());
+                if (itTarget != placement.end() && itTarget->second != nodePlacement.second) {
+                    ++cutEdges;
+                    cutBytes += TransferBytes(output);
+                }
+            }
+        }
+    }
+
+    std::stringstream report;
+    report << "HETERO cost model partitioning of " << function->get_friendly_name() << ": moved " << moved << " of "
+           << placement.size() << " operations" << std::endl;
+    for (auto&& stats : deviceStats) {
+        report << "  " << stats.first << ": " << stats.second.first << " operations, estimated cost "
+               << stats.second.second << std::endl;
+    }
+    report << "  cut edges: " << cutEdges << ", bytes crossing cuts: " << cutBytes << std::endl;
+    return report.str();
+}
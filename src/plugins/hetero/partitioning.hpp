@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Cost model based refinement of HETERO affinities
+ * @file partitioning.hpp
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <ngraph/function.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "ie_common.h"
+
+namespace HeteroPlugin {
+
+/**
+ * @class AffinityCostModel
+ * @brief Moves operations between devices which support them, so the estimated compute cost plus
+ * the cost of tensors crossing subgraph boundaries is minimal.
+ *
+ * Operation cost is estimated from output sizes and constant weights, lower priority devices are
+ * assumed to be slower. Every edge between operations with different affinities costs a fixed
+ * overhead of an extra subgraph boundary plus the number of transferred bytes, which makes the
+ * refinement merge small fragments into their neighbours.
+ */
+class AffinityCostModel {
+public:
+    /**
+     * @brief Constructs cost model from per-device query results
+     * @param queryResults Query results of the fallback devices in priority order
+     */
+    explicit AffinityCostModel(
+        const std::vector<std::pair<std::string, InferenceEngine::QueryNetworkResult>>& queryResults);
+
+    /**
+     * @brief Affinities which follow the device priority, as plain QueryNetwork of the HETERO plugin returns
+     */
+    std::map<std::string, std::string> GetDefaultAffinities() const;
+
+    /**
+     * @brief Greedily moves operations to a device of one of their neighbours while the total cost decreases
+     * @param function Function which layer names are used in affinities
+     * @param affinities Layer name to device map, updated in place
+     * @return Human readable summary of the chosen partition
+     */
+    std::string Refine(const std::shared_ptr<const ngraph::Function>& function,
+                       std::map<std::string, std::string>& affinities) const;
+
+private:
+    double ComputeCost(const ngraph::Node* node, const std::string& device) const;
+
+    std::vector<std::string> _devices;
+    std::unordered_map<std::string, std::unordered_set<std::string>> _supportedLayers;
+};
+
+}  // namespace HeteroPlugin
@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline_stage.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipelineStage::HeteroPipelineStage(std::size_t capacity) : _capacity(std::max<std::size_t>(capacity, 1)) {}
+
+void HeteroPipelineStage::Run(Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_inFlight >= _capacity) {
+            _pending.push(std::move(task));
+            return;
+        }
+        ++_inFlight;
+    }
+    task();
+}
+
+void HeteroPipelineStage::Release() {
+    Task next;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_pending.empty()) {
+            --_inFlight;
+            return;
+        }
+        // the slot is handed over to the oldest waiting request
+        next = std::move(_pending.front());
+        _pending.pop();
+    }
+    next();
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <threading/ie_itask_executor.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Bounded queue in front of one subgraph stage of a pipelined HETERO network.
+ * At most `capacity` infer requests run the stage at the same time, the others wait in FIFO order
+ * and are started by the request which leaves the stage.
+ */
+class HeteroPipelineStage {
+public:
+    using Ptr = std::shared_ptr<HeteroPipelineStage>;
+
+    explicit HeteroPipelineStage(std::size_t capacity);
+
+    /**
+     * @brief Runs the task immediately if the stage has a free slot, otherwise enqueues it
+     * @param task A task which starts the stage sub-request. Should not throw.
+     */
+    void Run(InferenceEngine::Task task);
+
+    /**
+     * @brief Frees a slot taken by Run(). Starts the oldest waiting task, if any, in the calling thread.
+     */
+    void Release();
+
+private:
+    std::mutex _mutex;
+    std::queue<InferenceEngine::Task> _pending;
+    const std::size_t _capacity;
+    std::size_t _inFlight = 0;
+};
+
+}  // namespace HeteroPlugin
@@ -26,6 +26,8 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINING)] = NO;
+    _config[HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING)] = NO;
 }
 
 namespace {
@@ -39,6 +41,8 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(PIPELINING),
+                                                                  HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING),
                                                                   "TARGET_FALLBACK",
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
@@ -98,6 +102,12 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
             tconfig[KEY_DEVICE_ID] = deviceIDLocal;
         }
 
+        // the pipeline stages must run concurrently, so the subgraphs cannot share a single device queue
+        auto itPipelining = tconfig.find(HETERO_CONFIG_KEY(PIPELINING));
+        if (itPipelining != tconfig.end() && itPipelining->second == YES) {
+            tconfig[KEY_EXCLUSIVE_ASYNC_REQUESTS] = NO;
+        }
+
         return GetSupportedConfig(tconfig, deviceName);
     };
 
@@ -130,31 +140,14 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
         IE_THROW() << "Please, work with HETERO device via InferencEngine::Core object";
     }
 
-    auto tconfig = mergeConfigs(_config, config);
-    auto it = tconfig.find("TARGET_FALLBACK");
-    if (it == tconfig.end()) {
-        IE_THROW() << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
-    }
-
-    std::string fallbackDevicesStr = it->second;
-    DeviceMetaInformationMap metaDevices = GetDevicePlugins(fallbackDevicesStr, tconfig);
-
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "HETERO plugin supports just ngraph network representation";
     }
 
-    std::map<std::string, QueryNetworkResult> queryResults;
-    for (auto&& metaDevice : metaDevices) {
-        auto& deviceName = metaDevice.first;
-        queryResults[deviceName] = GetCore()->QueryNetwork(network, deviceName, metaDevice.second);
-    }
-
     //  WARNING: Here is devices with user set priority
-    auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
-
-    for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+    for (auto&& deviceQueryResult : QueryNetworkPerDevice(network, config)) {
+        for (auto&& layerQueryResult : deviceQueryResult.second.supportedLayersMap) {
             qr.supportedLayersMap.emplace(layerQueryResult);
         }
     }
@@ -165,6 +158,28 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
     return qr;
 }
 
+std::vector<std::pair<std::string, QueryNetworkResult>> Engine::QueryNetworkPerDevice(const CNNNetwork& network,
+                                                                                      const Configs& config) const {
+    auto tconfig = mergeConfigs(_config, config);
+    auto it = tconfig.find("TARGET_FALLBACK");
+    if (it == tconfig.end()) {
+        IE_THROW() << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
+    }
+
+    std::string fallbackDevicesStr = it->second;
+    DeviceMetaInformationMap metaDevices = GetDevicePlugins(fallbackDevicesStr, tconfig);
+
+    std::vector<std::pair<std::string, QueryNetworkResult>> queryResults;
+    std::unordered_set<std::string> queriedDevices;
+    for (auto&& deviceName : InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr)) {
+        if (queriedDevices.insert(deviceName).second) {
+            queryResults.emplace_back(deviceName,
+                                      GetCore()->QueryNetwork(network, deviceName, metaDevices[deviceName]));
+        }
+    }
+    return queryResults;
+}
+
 Parameter Engine::GetMetric(const std::string& name, const std::map<std::string, Parameter>& options) const {
     if (METRIC_KEY(SUPPORTED_METRICS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS,
@@ -215,6 +230,11 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == HETERO_CONFIG_KEY(PIPELINING) || name == HETERO_CONFIG_KEY(COST_MODEL_PARTITIONING)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        bool enabled = it->second == YES;
+        return {enabled};
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
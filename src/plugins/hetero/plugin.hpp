@@ -46,6 +46,14 @@ public:
 
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback, const Configs& localConfig) const;
 
+    /**
+     * @brief Queries every TARGET_FALLBACK device separately
+     * @return Query results of unique devices in TARGET_FALLBACK priority order
+     */
+    std::vector<std::pair<std::string, InferenceEngine::QueryNetworkResult>> QueryNetworkPerDevice(
+        const InferenceEngine::CNNNetwork& network,
+        const Configs& config) const;
+
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string& deviceName) const;
     std::string DeviceArchitecture(const std::string& targetFallback) const;